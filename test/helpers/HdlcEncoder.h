@@ -0,0 +1,134 @@
+/*
+  HdlcEncoder.h - AX.25 line encoder shared by the host tests
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TEST_HDLC_ENCODER_H
+#define TEST_HDLC_ENCODER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "Crc/Crc16.h"
+
+// Bit at a time 1 + x^12 + x^17 scrambler (s = d ^ s[-12] ^ s[-17]) and
+// descrambler (d = s ^ s[-12] ^ s[-17]), MSB first like the radio FIFO
+class G3ruh {
+public:
+  uint8_t scramble(uint8_t d)
+  {
+    uint8_t out = 0;
+    for (int k = 7; k >= 0; k--)
+    {
+      uint8_t s = ((d >> k) & 1) ^ tap(12) ^ tap(17);
+      hist = (hist << 1) | s;
+      out = (out << 1) | s;
+    }
+    return out;
+  }
+  uint8_t descramble(uint8_t s)
+  {
+    uint8_t out = 0;
+    for (int k = 7; k >= 0; k--)
+    {
+      uint8_t b = (s >> k) & 1;
+      out = (out << 1) | (b ^ tap(12) ^ tap(17));
+      hist = (hist << 1) | b;
+    }
+    return out;
+  }
+  uint32_t hist = 0;  // line bits, the newest in bit 0
+
+private:
+  uint8_t tap(int n) { return (hist >> (n - 1)) & 1; }
+};
+
+// NRZ line bits, MSB first, of AX.25 frames: flags, bit stuffing and NRZI,
+// then the G3RUH scrambler if asked for
+class HdlcEncoder {
+public:
+  explicit HdlcEncoder(bool g3ruh = false) : g3ruh(g3ruh) {}
+
+  void flag(int n = 1)
+  {
+    for (int i = 0; i < n; i++)
+      for (int k = 0; k < 8; k++)
+        line((0x7E >> k) & 1);
+  }
+  void frame(const uint8_t* data, size_t len)
+  {
+    uint16_t crc = Crc16X25::compute(data, len);
+    for (size_t i = 0; i < len; i++)
+      byte(data[i]);
+    byte((uint8_t)crc);
+    byte((uint8_t)(crc >> 8));
+    flag();
+  }
+  // the capture so far, a partial last byte is padded with ZEROs
+  std::vector<uint8_t> bytes()
+  {
+    std::vector<uint8_t> b = out;
+    if (nbits)
+    {
+      G3ruh s = scrambler;
+      uint8_t last = acc << (8 - nbits);
+      b.push_back(g3ruh ? s.scramble(last) : last);
+    }
+    return b;
+  }
+
+  // line bits encoded so far
+  size_t bits() const { return out.size() * 8 + nbits; }
+
+  G3ruh scrambler;  // its state can be set before encoding, the receiver does not know it
+
+private:
+  void byte(uint8_t v)
+  {
+    for (int k = 0; k < 8; k++)
+    {
+      uint8_t b = (v >> k) & 1;
+      line(b);
+      ones = b ? ones + 1 : 0;
+      if (ones == 5)
+      {
+        line(0);
+        ones = 0;
+      }
+    }
+  }
+  // NRZI: a ZERO changes the level, a ONE keeps it
+  void line(uint8_t b)
+  {
+    if (!b)
+      level ^= 1;
+    acc = (acc << 1) | level;
+    if (++nbits == 8)
+    {
+      out.push_back(g3ruh ? scrambler.scramble(acc) : acc);
+      acc = 0;
+      nbits = 0;
+    }
+    if (b == 0)
+      ones = 0;
+  }
+  bool g3ruh;
+  std::vector<uint8_t> out;
+  uint8_t acc = 0, nbits = 0, level = 0, ones = 0;
+};
+
+#endif
@@ -0,0 +1,67 @@
+/*
+  Arduino.h - The part of the Arduino core the host tests need
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Only what the modules built in [env:native] use. Serial output is dropped.
+
+#ifndef ARDUINO_STUB_H
+#define ARDUINO_STUB_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <string>
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define vsnprintf_P vsnprintf
+#define snprintf_P snprintf
+typedef const char *PGM_P;
+#define strlen_P strlen
+#define strstr_P strstr
+#define memcpy_P memcpy
+
+class __FlashStringHelper;
+#define F(s) ((const __FlashStringHelper *)(s))
+
+struct HardwareSerialStub {
+  int printf(const char *, ...) { return 0; }
+};
+static HardwareSerialStub Serial;
+
+class String {
+public:
+  String(const char *s = "") : s(s) {}
+  const char *c_str() const { return s.c_str(); }
+  unsigned int length() const { return s.length(); }
+
+private:
+  std::string s;
+};
+
+// millis() only moves when a test moves it
+inline unsigned long &stubMillis()
+{
+  static unsigned long ms = 0;
+  return ms;
+}
+inline unsigned long millis() { return stubMillis(); }
+
+#endif
@@ -0,0 +1,142 @@
+/*
+  LittleFS.h - In memory LittleFS for the host tests
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Only the calls the Journal makes. Files live in a map keyed by their full
+// path, a directory is any prefix of them. writeBudget makes the flash fill
+// up: a write past it is cut short like on a full partition.
+
+#ifndef LITTLEFS_STUB_H
+#define LITTLEFS_STUB_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#define FILE_READ   "r"
+#define FILE_APPEND "a"
+
+class LittleFSStub;
+
+class File {
+public:
+  File() {}
+  File(LittleFSStub *fs, const std::string &path, bool dir) : fs(fs), path(path), dir(dir) {}
+
+  explicit operator bool() const { return fs != nullptr; }
+  size_t size() { return fs ? data().size() : 0; }
+  bool seek(size_t p)
+  {
+    if (!fs || p > size())
+      return false;
+    pos = p;
+    return true;
+  }
+  size_t read(uint8_t *buf, size_t n);
+  size_t write(const uint8_t *buf, size_t n);
+  const char *name() const
+  {
+    size_t slash = path.rfind('/');
+    return path.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+  }
+  void close() { fs = nullptr; }
+  File openNextFile();
+
+private:
+  std::vector<uint8_t> &data();
+
+  LittleFSStub *fs = nullptr;
+  std::string path;
+  bool dir = false;
+  size_t pos = 0;
+  std::string last;  // last file openNextFile() returned
+};
+
+class LittleFSStub {
+public:
+  std::map<std::string, std::vector<uint8_t>> files;
+  size_t writeBudget = SIZE_MAX;  // bytes that can still be written
+
+  bool begin(bool formatOnFail = false) { return true; }
+  bool mkdir(const char *) { return true; }
+  bool remove(const char *path) { return files.erase(path) > 0; }
+  File open(const char *path, const char *mode = FILE_READ)
+  {
+    if (files.count(path))
+      return File(this, path, false);
+    if (mode[0] == 'a')
+    {
+      files[path];
+      return File(this, path, false);
+    }
+    return File(this, path, true);
+  }
+  void reset()
+  {
+    files.clear();
+    writeBudget = SIZE_MAX;
+  }
+};
+
+inline LittleFSStub &littleFsStub()
+{
+  static LittleFSStub fs;
+  return fs;
+}
+#define LittleFS littleFsStub()
+
+inline std::vector<uint8_t> &File::data() { return fs->files[path]; }
+
+inline size_t File::read(uint8_t *buf, size_t n)
+{
+  if (!fs || dir)
+    return 0;
+  std::vector<uint8_t> &d = data();
+  n = pos + n > d.size() ? d.size() - pos : n;
+  memcpy(buf, d.data() + pos, n);
+  pos += n;
+  return n;
+}
+
+inline size_t File::write(const uint8_t *buf, size_t n)
+{
+  if (!fs || dir)
+    return 0;
+  n = n > fs->writeBudget ? fs->writeBudget : n;
+  fs->writeBudget -= n;
+  std::vector<uint8_t> &d = data();
+  d.insert(d.end(), buf, buf + n);
+  return n;
+}
+
+inline File File::openNextFile()
+{
+  if (!fs || !dir)
+    return File();
+  std::string prefix = path + "/";
+  auto it = last.empty() ? fs->files.lower_bound(prefix) : fs->files.upper_bound(last);
+  if (it == fs->files.end() || it->first.compare(0, prefix.size(), prefix) != 0)
+    return File();
+  last = it->first;
+  return File(fs, it->first, false);
+}
+
+#endif
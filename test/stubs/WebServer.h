@@ -0,0 +1,62 @@
+/*
+  WebServer.h - Response side of the ESP32 WebServer for the host tests
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Keeps the body and the size of every sendContent() instead of writing to
+// a socket. An empty sendContent() is the last chunk of a chunked response.
+
+#ifndef WEBSERVER_STUB_H
+#define WEBSERVER_STUB_H
+
+#include <Arduino.h>
+#include <string>
+#include <vector>
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+class WebServer {
+public:
+  void setContentLength(size_t len) { contentLength = len; }
+  void send(int code, const char *contentType, const char *content)
+  {
+    status = code;
+    type = contentType;
+    clear();
+    body = content;
+  }
+  void sendContent(const char *data, size_t len)
+  {
+    body.append(data, len);
+    chunks.push_back(len);
+  }
+  void sendContent(const char *data) { sendContent(data, strlen(data)); }
+  void sendContent_P(PGM_P data, size_t len) { sendContent(data, len); }
+  void clear()
+  {
+    body.clear();
+    chunks.clear();
+  }
+
+  int status = 0;
+  std::string type;
+  size_t contentLength = 0;
+  std::string body;
+  std::vector<size_t> chunks;
+};
+
+#endif
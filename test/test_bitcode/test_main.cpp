@@ -0,0 +1,224 @@
+/*
+  test_main.cpp - Binary AX.25 deframer against the hex string path
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "BitCode/BitCode.h"
+#include "../helpers/HdlcEncoder.h"
+
+#define HEX_CAP 255  // byteStr_fsk size the hex path was limited to in Radio::listen()
+
+void setUp() {}
+void tearDown() {}
+
+// BitCode::nrz2ax25 as it was before the binary deframer: the hex string
+// goes through nrz2nrzi, remove_bit_stuffing, invierte_bytes_de_un_array and
+// crc_check, each with its own buffer of buffSize
+static void hexNrz2ax25(char* entrada, size_t buffSize, char* ax25, uint8_t* ax25bin, size_t* sizeAx25bin)
+{
+  std::vector<char> ax25hdlc(buffSize + 1), ax25inv(buffSize + 1);
+  std::vector<uint8_t> ax25hdlcbin(buffSize), ax25invbin(buffSize);
+  size_t sizeAx25inv = 0, sizeAx25invbin = 0;
+  BitCode::nrz2nrzi(entrada, buffSize, ax25hdlc.data(), ax25hdlcbin.data());
+  if (BitCode::remove_bit_stuffing(ax25hdlc.data(), buffSize, ax25inv.data(), &sizeAx25inv, ax25invbin.data(), &sizeAx25invbin) == 0)
+  {
+    BitCode::invierte_bytes_de_un_array(ax25inv.data(), sizeAx25inv, ax25, ax25bin, sizeAx25bin);
+    ax25[sizeAx25inv] = 0;
+    if (BitCode::crc_check(ax25inv.data()) != 0)
+    {
+      strcpy(ax25, "CRC error!");
+      *sizeAx25bin = 10;
+      memcpy(ax25bin, ax25, 10);
+    }
+  }
+  else
+  {
+    strcpy(ax25, "Frame error!");
+    *sizeAx25bin = 12;
+    memcpy(ax25bin, ax25, 12);
+  }
+}
+
+// A capture as the radio reads it: the synch word (the opening flag) and the
+// frame, maybe corrupted, followed by whatever the FIFO got after it
+static std::vector<uint8_t> capture(const std::vector<uint8_t>& frame, int mode)
+{
+  if (mode == 3)  // noise
+  {
+    std::vector<uint8_t> noise(2 + rand() % 120);
+    for (auto& b : noise)
+      b = rand();
+    return noise;
+  }
+  HdlcEncoder enc;
+  enc.flag();
+  enc.frame(frame.data(), frame.size());
+  std::vector<uint8_t> b = enc.bytes();
+  for (int pad = rand() % 3; pad > 0; pad--)
+    b.push_back(rand());
+  if (mode == 2)  // a bit error inside the frame
+    b[1 + rand() % (b.size() - 2)] ^= 1 << (rand() % 8);
+  return b;
+}
+
+static std::vector<uint8_t> randomFrame(size_t maxLen)
+{
+  std::vector<uint8_t> f(1 + rand() % maxLen);
+  bool ones = rand() % 3 == 0;  // runs of ONEs, lots of bit stuffing
+  for (auto& b : f)
+    b = ones ? rand() | 0xF8 : (rand() % 4 == 0 ? 0xFF : rand());
+  return f;
+}
+
+// the wrapper and the binary deframer give what the hex path gave
+static void test_matches_hex_path()
+{
+  const int frames = 50000;
+  int ok = 0, crcErrors = 0, frameErrors = 0;
+  char hex[2 * HEX_CAP + 2], oldStr[2 * HEX_CAP + 2], newStr[2 * HEX_CAP + 2];
+  uint8_t oldBin[HEX_CAP + 1], newBin[HEX_CAP + 1], bin[HEX_CAP + 1];
+  for (int t = 0; t < frames; t++)
+  {
+    int mode = rand() % 4;
+    std::vector<uint8_t> nrz = capture(randomFrame(100), mode);
+    if (2 * nrz.size() + 1 > HEX_CAP)
+      nrz.resize((HEX_CAP - 1) / 2);
+    for (size_t i = 0; i < nrz.size(); i++)
+      sprintf(hex + 2 * i, "%02X", nrz[i]);
+    size_t buffSize = 2 * nrz.size();
+
+    size_t oldLen = 0, newLen = 0, binLen = 0;
+    hexNrz2ax25(hex, buffSize, oldStr, oldBin, &oldLen);
+    BitCode::nrz2ax25(hex, buffSize, newStr, newBin, &newLen);
+    BitCode::AX25Result r = BitCode::deframeAX25(nrz.data(), 1, nrz.data() + 1, nrz.size() - 1, bin, sizeof(bin), &binLen);
+
+    char msg[2 * HEX_CAP + 64];
+    snprintf(msg, sizeof(msg), "mode %d capture %s", mode, hex);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE(oldStr, newStr, msg);
+    TEST_ASSERT_EQUAL_MESSAGE(oldLen, newLen, msg);
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(oldBin, newBin, oldLen, msg);
+    if (!strcmp(oldStr, "CRC error!"))
+    {
+      crcErrors++;
+      TEST_ASSERT_EQUAL_MESSAGE(BitCode::AX25_CRC_ERROR, r, msg);
+    }
+    else if (!strcmp(oldStr, "Frame error!"))
+    {
+      frameErrors++;
+      TEST_ASSERT_EQUAL_MESSAGE(BitCode::AX25_FRAME_ERROR, r, msg);
+    }
+    else
+    {
+      ok++;
+      TEST_ASSERT_EQUAL_MESSAGE(BitCode::AX25_OK, r, msg);
+      TEST_ASSERT_EQUAL_MESSAGE(oldLen, binLen, msg);
+      TEST_ASSERT_EQUAL_MEMORY_MESSAGE(oldBin, bin, binLen, msg);
+    }
+  }
+  char msg[160];
+  snprintf(msg, sizeof(msg), "%d captures: %d frames, %d CRC errors, %d frame errors", frames, ok, crcErrors, frameErrors);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_GREATER_THAN(frames / 5, ok);
+  TEST_ASSERT_GREATER_THAN(frames / 10, crcErrors);
+  TEST_ASSERT_GREATER_THAN(frames / 10, frameErrors);
+}
+
+// frames longer than the 255 character hex string could hold
+static void test_long_frames()
+{
+  uint8_t out[256];
+  for (size_t len = 120; len <= 200; len++)
+  {
+    std::vector<uint8_t> frame(len);
+    for (auto& b : frame)
+      b = rand();
+    HdlcEncoder enc;
+    enc.flag();
+    enc.frame(frame.data(), frame.size());
+    std::vector<uint8_t> nrz = enc.bytes();
+    size_t outLen = 0;
+    TEST_ASSERT_EQUAL(BitCode::AX25_OK, BitCode::deframeAX25(nrz.data(), 1, nrz.data() + 1, nrz.size() - 1, out, sizeof(out), &outLen));
+    TEST_ASSERT_EQUAL(len + 2, outLen);
+    TEST_ASSERT_EQUAL_MEMORY(frame.data(), out, len);
+  }
+}
+
+// time per frame, and the buffers each path needs for a frame of n bytes
+static void test_benchmark()
+{
+  std::vector<uint8_t> frame(100);
+  for (auto& b : frame)
+    b = rand();
+  HdlcEncoder enc;
+  enc.flag();
+  enc.frame(frame.data(), frame.size());
+  std::vector<uint8_t> nrz = enc.bytes();
+  nrz.resize(std::min<size_t>(nrz.size(), (HEX_CAP - 1) / 2));
+  char hex[2 * HEX_CAP + 2], str[2 * HEX_CAP + 2];
+  for (size_t i = 0; i < nrz.size(); i++)
+    sprintf(hex + 2 * i, "%02X", nrz[i]);
+  size_t buffSize = 2 * nrz.size() + 1;
+
+  const int runs = 20000;
+  uint8_t bin[HEX_CAP + 1];
+  size_t len = 0;
+  volatile size_t sink = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; i++)
+  {
+    hexNrz2ax25(hex, buffSize, str, bin, &len);
+    sink += len;
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; i++)
+  {
+    BitCode::deframeAX25(nrz.data(), 1, nrz.data() + 1, nrz.size() - 1, bin, sizeof(bin), &len);
+    sink += len;
+  }
+  auto t2 = std::chrono::steady_clock::now();
+  TEST_ASSERT_EQUAL(frame.size() + 2, len);
+
+  double hexUs = std::chrono::duration<double, std::micro>(t1 - t0).count() / runs;
+  double binUs = std::chrono::duration<double, std::micro>(t2 - t1).count() / runs;
+  // hex path: Radio::listen() allocated the hex string, ax25 and ax25bin and
+  // nrz2ax25() five more, ax25hdlcbin twice, all of buffSize. The binary
+  // path only needs the output, it reads the FIFO bytes in place.
+  size_t hexBytes = 8 * buffSize;
+  size_t binBytes = frame.size() + 2;
+  char msg[160];
+  snprintf(msg, sizeof(msg), "%u byte capture: hex path %.2f us and %u bytes, binary %.3f us and %u bytes, %.1fx faster",
+           (unsigned)nrz.size(), hexUs, (unsigned)hexBytes, binUs, (unsigned)binBytes, hexUs / binUs);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_TRUE(binUs * 3 < hexUs);
+  TEST_ASSERT_TRUE(binBytes * 4 < hexBytes);
+}
+
+int main()
+{
+  srand(1);
+  UNITY_BEGIN();
+  RUN_TEST(test_matches_hex_path);
+  RUN_TEST(test_long_frames);
+  RUN_TEST(test_benchmark);
+  return UNITY_END();
+}
@@ -0,0 +1,108 @@
+/*
+  test_main.cpp - Board template parser tests
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <unity.h>
+#include <string.h>
+#include "ConfigManager/BoardTemplate.h"
+
+void setUp() {}
+void tearDown() {}
+
+// an SX1268 with TCXO and RF switch on the VSPI pins, and an SX1262 on HSPI
+static const char twoRadios[] =
+  "{\"aADDR\":60,\"oSDA\":21,\"oSCL\":22,\"oRST\":16,\"pBut\":0,\"led\":25,"
+  "\"radio\":2,\"lNSS\":18,\"lDIO0\":26,\"lDIO1\":33,\"lBUSSY\":32,\"lRST\":23,"
+  "\"lMISO\":19,\"lMOSI\":27,\"lSCK\":5,\"lTCXOV\":1.6,\"RXEN\":4,\"TXEN\":2,"
+  "\"radios\":[{\"radio\":6,\"lNSS\":15,\"lDIO0\":0,\"lDIO1\":34,\"lBUSSY\":35,"
+  "\"lRST\":17,\"lMISO\":12,\"lMOSI\":13,\"lSCK\":14,\"lTCXOV\":1.8}]}";
+
+static void test_two_radios_fit()
+{
+  // the config field takes it with room to spare
+  TEST_ASSERT_GREATER_THAN(TEMPLATE_LEN_V05, sizeof(twoRadios));
+  TEST_ASSERT_LESS_OR_EQUAL(TEMPLATE_LEN, sizeof(twoRadios));
+
+  board_t board;
+  board_t extra[MAX_RADIOS - 1];
+  uint8_t count = 0;
+  TEST_ASSERT_TRUE(BoardTemplate::parse(twoRadios, board, extra, count));
+  TEST_ASSERT_EQUAL(2, count);
+
+  TEST_ASSERT_EQUAL(60, board.OLED__address);
+  TEST_ASSERT_EQUAL(16, board.OLED__RST);
+  TEST_ASSERT_EQUAL(25, board.BOARD_LED);
+  TEST_ASSERT_EQUAL(2, board.L_radio);
+  TEST_ASSERT_EQUAL(18, board.L_NSS);
+  TEST_ASSERT_EQUAL(5, board.L_SCK);
+  TEST_ASSERT_EQUAL_FLOAT(1.6f, board.L_TCXO_V);
+  TEST_ASSERT_EQUAL(4, board.RX_EN);
+  TEST_ASSERT_EQUAL(2, board.TX_EN);
+
+  // the second radio has its own pins and the board's display and button
+  TEST_ASSERT_EQUAL(6, extra[0].L_radio);
+  TEST_ASSERT_EQUAL(15, extra[0].L_NSS);
+  TEST_ASSERT_EQUAL(34, extra[0].L_DI01);
+  TEST_ASSERT_EQUAL(35, extra[0].L_BUSSY);
+  TEST_ASSERT_EQUAL(12, extra[0].L_MISO);
+  TEST_ASSERT_EQUAL(13, extra[0].L_MOSI);
+  TEST_ASSERT_EQUAL(14, extra[0].L_SCK);
+  TEST_ASSERT_EQUAL_FLOAT(1.8f, extra[0].L_TCXO_V);
+  TEST_ASSERT_EQUAL(UNUSED, extra[0].RX_EN);
+  TEST_ASSERT_EQUAL(UNUSED, extra[0].TX_EN);
+  TEST_ASSERT_EQUAL(60, extra[0].OLED__address);
+  TEST_ASSERT_EQUAL(0, extra[0].PROG__BUTTON);
+}
+
+// radios past MAX_RADIOS are left out
+static void test_too_many_radios()
+{
+  char tpl[TEMPLATE_LEN];
+  strcpy(tpl, twoRadios);
+  strcpy(strstr(tpl, "]}"), ",{\"radio\":1,\"lNSS\":2}]}");
+
+  board_t board;
+  board_t extra[MAX_RADIOS - 1];
+  uint8_t count = 0;
+  TEST_ASSERT_TRUE(BoardTemplate::parse(tpl, board, extra, count));
+  TEST_ASSERT_EQUAL(MAX_RADIOS, count);
+  TEST_ASSERT_EQUAL(15, extra[0].L_NSS);
+}
+
+static void test_invalid()
+{
+  board_t board;
+  board_t extra[MAX_RADIOS - 1];
+  uint8_t count = 0;
+  TEST_ASSERT_FALSE(BoardTemplate::parse("{\"aADDR\":60}", board, extra, count));
+
+  // a template cut at the old field length is not valid either
+  char cut[TEMPLATE_LEN_V05];
+  strncpy(cut, twoRadios, sizeof(cut) - 1);
+  cut[sizeof(cut) - 1] = '\0';
+  TEST_ASSERT_FALSE(BoardTemplate::parse(cut, board, extra, count));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_two_radios_fit);
+  RUN_TEST(test_too_many_radios);
+  RUN_TEST(test_invalid);
+  return UNITY_END();
+}
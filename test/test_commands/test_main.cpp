@@ -0,0 +1,159 @@
+/*
+  test_main.cpp - MQTT command table and dispatch tests
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <unity.h>
+#include <string>
+#include "Mqtt/CommandTable.h"
+
+void setUp() {}
+void tearDown() {}
+
+static const CommandInfo* find(const char* name)
+{
+  return commandLookup(commandTable, numCommands, name);
+}
+
+static void test_table_sorted_and_found()
+{
+  TEST_ASSERT_TRUE(commandTableSorted(commandTable, numCommands));
+  for (size_t i = 0; i < numCommands; i++)
+    TEST_ASSERT_EQUAL_PTR(&commandTable[i], find(commandTable[i].name));
+  TEST_ASSERT_NULL(find(""));
+  TEST_ASSERT_NULL(find("Freq"));
+  TEST_ASSERT_NULL(find("zzz"));
+
+  // every handler of MQTT_Client::runCommand has exactly one name
+  TEST_ASSERT_EQUAL(CMD_COUNT, numCommands);
+  bool seen[CMD_COUNT] = {};
+  for (size_t i = 0; i < numCommands; i++)
+  {
+    TEST_ASSERT_LESS_THAN(CMD_COUNT, commandTable[i].handler);
+    TEST_ASSERT_FALSE_MESSAGE(seen[commandTable[i].handler], commandTable[i].name);
+    seen[commandTable[i].handler] = true;
+  }
+}
+
+static void test_flags()
+{
+  const char* global[] = {"frame", "log", "reset", "sat_pos_oled", "status", "tx", "update"};
+  const char* batch[] = {"Fd", "SPIsetRegValue", "SPIwriteRegister", "aldro", "begin_fsk", "begin_lora", "br", "bw",
+                         "crc", "dec", "fbw", "filter", "fldro", "fok", "freq", "fsw", "lsw", "pl", "rxb", "sat", "sf"};
+  size_t numGlobal = 0, numBatch = 0;
+  for (size_t i = 0; i < numCommands; i++)
+  {
+    numGlobal += (commandTable[i].flags & COMMAND_GLOBAL) != 0;
+    numBatch += (commandTable[i].flags & COMMAND_BATCH) != 0;
+  }
+  TEST_ASSERT_EQUAL(sizeof(global) / sizeof(global[0]), numGlobal);
+  TEST_ASSERT_EQUAL(sizeof(batch) / sizeof(batch[0]), numBatch);
+  for (const char* name : global)
+  {
+    const CommandInfo* cmd = find(name);
+    TEST_ASSERT_TRUE_MESSAGE(cmd && cmd->flags & COMMAND_GLOBAL, name);
+  }
+  for (const char* name : batch)
+  {
+    const CommandInfo* cmd = find(name);
+    TEST_ASSERT_TRUE_MESSAGE(cmd && cmd->flags & COMMAND_BATCH, name);
+  }
+}
+
+// One message through dispatchCommand: the handler that ran (or "-") and on
+// which radio, the ack sent back and the rest of the topic the frame handler
+// reads. The handlers that do not ack in MQTT_Client return COMMAND_NO_ACK here too.
+static std::string dispatch(const char* topicIn, uint8_t radios)
+{
+  char topic[128];
+  strcpy(topic, topicIn);
+  std::string ran = "-";
+  char ackTopic[64];
+  uint16_t ack = 0;
+  bool sent = dispatchCommand(topic, radios, [&](const CommandInfo& cmd, uint8_t radio) -> int32_t {
+    ran = std::string(cmd.name) + " radio " + std::to_string(radio);
+    return cmd.handler == CMD_STATUS || cmd.handler == CMD_SAT_POS_OLED ? COMMAND_NO_ACK : cmd.handler;
+  }, ackTopic, sizeof(ackTopic), ack);
+
+  std::string result = ran;
+  if (sent)
+    result += std::string(" ack ") + ackTopic + "=" + std::to_string(ack);
+  const char* rest = strtok(NULL, "/");
+  if (rest)
+    result += std::string(" rest ") + rest;
+  return result;
+}
+
+// topics received by a two radio station after connecting, then remote tuning
+static void test_recorded_stream()
+{
+  char frame[16], begine[16], batchConf[16], freq[16], sf[16];
+  snprintf(frame, sizeof(frame), "%d", CMD_FRAME);
+  snprintf(begine, sizeof(begine), "%d", CMD_BEGINE);
+  snprintf(batchConf, sizeof(batchConf), "%d", CMD_BATCH_CONF);
+  snprintf(freq, sizeof(freq), "%d", CMD_FREQ);
+  snprintf(sf, sizeof(sf), "%d", CMD_SF);
+  std::string unknown = std::to_string(COMMAND_UNKNOWN);
+
+  struct {
+    const char* topic;
+    std::string expected;
+  } stream[] = {
+    {"tinygs/global/cmnd/sat_pos_oled", "sat_pos_oled radio 0"},
+    {"tinygs/global/cmnd/frame/2", "frame radio 0 rest 2"},
+    {"tinygs/global/cmnd/freq", "-"},  // remote tune is not accepted globally, and global is never acked
+    {"tinygs/global/cmnd/update", "update radio 0"},
+    {"tinygs/user1/station1/cmnd/begine", std::string("begine radio 0 ack begine=") + begine},
+    {"tinygs/user1/station1/cmnd/1/begine", std::string("begine radio 1 ack 1/begine=") + begine},
+    {"tinygs/user1/station1/cmnd/batch_conf", std::string("batch_conf radio 0 ack batch_conf=") + batchConf},
+    {"tinygs/user1/station1/cmnd/1/freq", std::string("freq radio 1 ack 1/freq=") + freq},
+    {"tinygs/user1/station1/cmnd/0/sf", std::string("sf radio 0 ack 0/sf=") + sf},
+    {"tinygs/user1/station1/cmnd/2/sf", "-"},  // no third radio
+    {"tinygs/user1/station1/cmnd/1", "-"},
+    {"tinygs/user1/station1/cmnd/nosuchcommand", "- ack nosuchcommand=" + unknown},
+    {"tinygs/user1/station1/cmnd/frame/0", std::string("frame radio 0 ack frame=") + frame + " rest 0"},
+    {"tinygs/user1/station1/cmnd/status", "status radio 0"},
+    {"tinygs/user1/station1/cmnd", "-"},
+    {"tinygs", "-"},
+  };
+  for (auto& m : stream)
+    TEST_ASSERT_EQUAL_STRING_MESSAGE(m.expected.c_str(), dispatch(m.topic, 2).c_str(), m.topic);
+}
+
+// keys of a recorded batch_conf: only the COMMAND_BATCH ones are applied
+static void test_recorded_batch_conf()
+{
+  const char* keys[] = {"begin_lora", "freq", "sf", "bw", "cr", "sat", "dec", "filter", "reset", "unknown"};
+  std::string applied;
+  for (const char* key : keys)
+  {
+    const CommandInfo* cmd = findBatchCommand(key);
+    if (cmd)
+      applied += applied.empty() ? cmd->name : std::string(",") + cmd->name;
+  }
+  TEST_ASSERT_EQUAL_STRING("begin_lora,freq,sf,bw,sat,dec,filter", applied.c_str());
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_table_sorted_and_found);
+  RUN_TEST(test_flags);
+  RUN_TEST(test_recorded_stream);
+  RUN_TEST(test_recorded_batch_conf);
+  return UNITY_END();
+}
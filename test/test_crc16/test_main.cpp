@@ -0,0 +1,200 @@
+/*
+  test_main.cpp - CRC-16 known answer tests and benchmark
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include "Crc/Crc16.h"
+#include "BitCode/BitCode.h"
+
+void setUp() {}
+void tearDown() {}
+
+static const uint8_t check[] = "123456789";
+
+// bit at a time reference of the Rocksoft model
+static uint16_t reference(uint16_t poly, uint16_t init, bool reflect, uint16_t xorOut, const uint8_t* data, size_t len)
+{
+  uint16_t crc = init;
+  for (size_t i = 0; i < len; i++)
+  {
+    uint8_t b = reflect ? BitCode::reverse_byte(data[i]) : data[i];
+    crc ^= (uint16_t)b << 8;
+    for (int k = 0; k < 8; k++)
+      crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ poly) : (uint16_t)(crc << 1);
+  }
+  if (reflect)
+    crc = (uint16_t)(BitCode::reverse_byte(crc >> 8) | BitCode::reverse_byte(crc) << 8);
+  return crc ^ xorOut;
+}
+
+template <typename Crc>
+static void checkVariant(uint16_t poly, uint16_t init, bool reflect, uint16_t xorOut, uint16_t checkValue, uint16_t empty)
+{
+  TEST_ASSERT_EQUAL_HEX16(checkValue, Crc::compute(check, 9));
+  TEST_ASSERT_EQUAL_HEX16(checkValue, Crc::computeSlice4(check, 9));
+  TEST_ASSERT_EQUAL_HEX16(checkValue, Crc::of((const char*)check, 9));
+  TEST_ASSERT_EQUAL_HEX16(empty, Crc::compute(check, 0));
+  TEST_ASSERT_EQUAL_HEX16(empty, Crc::computeSlice4(check, 0));
+
+  // every length and every split point of a random buffer
+  uint8_t data[300];
+  for (size_t i = 0; i < sizeof(data); i++)
+    data[i] = rand();
+  for (size_t len = 0; len <= sizeof(data); len++)
+  {
+    uint16_t expected = reference(poly, init, reflect, xorOut, data, len);
+    TEST_ASSERT_EQUAL_HEX16(expected, Crc::compute(data, len));
+    TEST_ASSERT_EQUAL_HEX16(expected, Crc::computeSlice4(data, len));
+    size_t split = len ? rand() % len : 0;
+    uint16_t crc = Crc::update(Crc::begin(), data, split);
+    crc = Crc::updateSlice4(crc, data + split, len - split);
+    TEST_ASSERT_EQUAL_HEX16(expected, Crc::end(crc));
+  }
+}
+
+// reveng catalogue: check value of "123456789" and of the empty message
+static void test_x25() { checkVariant<Crc16X25>(0x1021, 0xFFFF, true, 0xFFFF, 0x906E, 0x0000); }
+static void test_ccitt_false() { checkVariant<Crc16CcittFalse>(0x1021, 0xFFFF, false, 0x0000, 0x29B1, 0xFFFF); }
+static void test_sx126x() { checkVariant<Crc16Sx126x>(0x1021, 0x1D0F, false, 0xFFFF, 0x1A33, 0xE2F0); }
+static void test_arc() { checkVariant<Crc16Arc>(0x8005, 0x0000, true, 0x0000, 0xBB3D, 0x0000); }
+
+// an AX.25 frame followed by its FCS (low byte first) leaves the X.25 residue
+static void test_x25_residue()
+{
+  uint8_t frame[64 + 2];
+  for (int n = 0; n < 1000; n++)
+  {
+    size_t len = 1 + rand() % 64;
+    for (size_t i = 0; i < len; i++)
+      frame[i] = rand();
+    uint16_t fcs = Crc16X25::compute(frame, len);
+    frame[len] = (uint8_t)fcs;
+    frame[len + 1] = (uint8_t)(fcs >> 8);
+    TEST_ASSERT_EQUAL_HEX16(0xF0B8, Crc16X25::update(Crc16X25::begin(), frame, len + 2));
+  }
+}
+
+// BitCode::crc_check before the table: the bit helpers kept in BitCode
+static int crcCheckBitwise(char *ax25inv)
+{
+  unsigned char crc[2] = {0, 0};
+  BitCode::crc_ones(crc);
+  int largo = BitCode::stringSize(ax25inv);
+  for (int i = 0; i < largo - 4; i += 2)
+  {
+    unsigned char byte = BitCode::compone_byte_en_hexadecimal(ax25inv[i], ax25inv[i + 1]);
+    for (int k = 8; k >= 1; k--)
+    {
+      unsigned char feedback = BitCode::read_bit_from_byte(byte, k) ^ BitCode::read_bit_from_byte(crc[1], 8);
+      BitCode::shift_one_bit_on_CRC_to_left(crc);
+      BitCode::set_bit_on_CRC(crc, 1, feedback);
+      BitCode::xor_bit_on_CRC(crc, 6, feedback);
+      BitCode::xor_bit_on_CRC(crc, 13, feedback);
+    }
+  }
+  crc[1] ^= 0xFF;
+  crc[0] ^= 0xFF;
+  return (crc[1] == BitCode::compone_byte_en_hexadecimal(ax25inv[largo - 4], ax25inv[largo - 3]) &&
+          crc[0] == BitCode::compone_byte_en_hexadecimal(ax25inv[largo - 2], ax25inv[largo - 1])) ? 0 : 1;
+}
+
+// crc_check input: hex string of the frame and FCS with the bits of every byte reversed
+static void toAx25inv(const uint8_t* frame, size_t len, char* out)
+{
+  uint16_t fcs = Crc16X25::compute(frame, len);
+  for (size_t i = 0; i < len + 2; i++)
+  {
+    uint8_t b = i < len ? frame[i] : (uint8_t)(i == len ? fcs : fcs >> 8);
+    sprintf(out + 2 * i, "%02X", BitCode::reverse_byte(b));
+  }
+}
+
+static void test_crc_check_matches_bitwise()
+{
+  static char frames[2000][2 * 258 + 1];
+  int good = 0;
+  for (int n = 0; n < 2000; n++)
+  {
+    uint8_t frame[256];
+    size_t len = 1 + rand() % 256;
+    for (size_t i = 0; i < len; i++)
+      frame[i] = rand();
+    toAx25inv(frame, len, frames[n]);
+    if (n % 3 == 0)
+      frames[n][rand() % (2 * len + 4)] ^= 0x01;  // flip a bit of one hex digit
+    int expected = crcCheckBitwise(frames[n]);
+    TEST_ASSERT_EQUAL(expected, BitCode::crc_check(frames[n]));
+    good += expected == 0;
+  }
+  TEST_ASSERT_GREATER_THAN(1000, good);
+  TEST_ASSERT_LESS_THAN(2000, good);
+}
+
+template <typename F>
+static double nsPerCall(F f, int calls)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < calls; i++)
+    f(i);
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / calls;
+}
+
+static volatile uint32_t sink;
+
+static void test_benchmark()
+{
+  const int frames = 64;
+  static char hex[frames][2 * 258 + 1];
+  static uint8_t bin[frames][256];
+  for (int n = 0; n < frames; n++)
+  {
+    for (int i = 0; i < 256; i++)
+      bin[n][i] = rand();
+    toAx25inv(bin[n], 254, hex[n]);
+  }
+
+  double bitwise = nsPerCall([&](int i) { sink += crcCheckBitwise(hex[i % frames]); }, 20000);
+  double table = nsPerCall([&](int i) { sink += BitCode::crc_check(hex[i % frames]); }, 20000);
+  double ref = nsPerCall([&](int i) { sink += reference(0x1021, 0xFFFF, true, 0xFFFF, bin[i % frames], 256); }, 20000);
+  double byte = nsPerCall([&](int i) { sink += Crc16X25::compute(bin[i % frames], 256); }, 200000);
+  double slice4 = nsPerCall([&](int i) { sink += Crc16X25::computeSlice4(bin[i % frames], 256); }, 200000);
+
+  char msg[160];
+  snprintf(msg, sizeof(msg), "crc_check, 256 byte frame: bitwise %.0f ns, table %.0f ns (%.1fx)", bitwise, table, bitwise / table);
+  TEST_MESSAGE(msg);
+  snprintf(msg, sizeof(msg), "CRC-16/X-25 over 256 bytes: bit loop %.0f ns, table %.0f ns, slice-by-4 %.0f ns (%.1fx the table)",
+           ref, byte, slice4, byte / slice4);
+  TEST_MESSAGE(msg);
+}
+
+int main()
+{
+  srand(1);
+  UNITY_BEGIN();
+  RUN_TEST(test_x25);
+  RUN_TEST(test_ccitt_false);
+  RUN_TEST(test_sx126x);
+  RUN_TEST(test_arc);
+  RUN_TEST(test_x25_residue);
+  RUN_TEST(test_crc_check_matches_bitwise);
+  RUN_TEST(test_benchmark);
+  return UNITY_END();
+}
@@ -0,0 +1,343 @@
+/*
+  test_main.cpp - FEC decoder tests and benchmark
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <unity.h>
+#include <chrono>
+#include <initializer_list>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Fec/Fec.h"
+#include "Fec/ReedSolomon.h"
+#include "Fec/Viterbi.h"
+
+void setUp() {}
+void tearDown() {}
+
+// Systematic CCSDS RS(255,223) encoder, written from the code definition:
+// g(x) = prod (x - a^(11 * (112 + i))), i = 0..31, over GF(2^8) / 0x187
+class RsEncoder {
+public:
+  RsEncoder()
+  {
+    int sr = 1;
+    for (int i = 0; i < 255; i++)
+    {
+      exp[i] = sr;
+      log[sr] = i;
+      sr <<= 1;
+      if (sr & 0x100)
+        sr ^= 0x187;
+    }
+    memset(gen, 0, sizeof(gen));
+    gen[0] = 1;
+    for (int i = 0; i < RS_NROOTS; i++)
+    {
+      uint8_t root = exp[(11 * (112 + i)) % 255];
+      for (int j = i + 1; j > 0; j--)
+        gen[j] = gen[j - 1] ^ mul(gen[j], root);
+      gen[0] = mul(gen[0], root);
+    }
+  }
+  // block: RS_NN - pad symbols, the data first; fills in the parity
+  void encode(uint8_t* block, int pad)
+  {
+    uint8_t parity[RS_NROOTS] = {0};
+    for (int i = 0; i < RS_KK - pad; i++)
+    {
+      uint8_t fb = block[i] ^ parity[0];
+      memmove(parity, parity + 1, RS_NROOTS - 1);
+      parity[RS_NROOTS - 1] = 0;
+      for (int j = 0; j < RS_NROOTS; j++)
+        parity[j] ^= mul(fb, gen[RS_NROOTS - 1 - j]);
+    }
+    memcpy(block + RS_KK - pad, parity, RS_NROOTS);
+  }
+  uint8_t mul(uint8_t a, uint8_t b) { return a && b ? exp[(log[a] + log[b]) % 255] : 0; }
+
+private:
+  uint8_t exp[255], log[256];
+  uint8_t gen[RS_NROOTS + 1];  // gen[i] is the coefficient of x^i
+};
+
+static RsEncoder rs;
+
+// CCSDS 131.0-B annex F, Berlekamp's dual basis: T alpha rows
+static uint8_t toDual(uint8_t c)
+{
+  static const uint8_t tal[8] = { 0x8d, 0xef, 0xec, 0x86, 0xfa, 0x99, 0xaf, 0x7b };
+  uint8_t v = 0;
+  for (int k = 0; k < 8; k++)
+    if (c & (1 << k))
+      v ^= tal[7 - k];
+  return v;
+}
+
+static void randomCodeword(uint8_t* block, int pad)
+{
+  for (int i = 0; i < RS_KK - pad; i++)
+    block[i] = rand();
+  rs.encode(block, pad);
+}
+
+// flips 'errors' distinct symbols with random non zero values
+static void corrupt(uint8_t* block, int n, int errors)
+{
+  bool hit[RS_NN] = {false};
+  for (int e = 0; e < errors; e++)
+  {
+    int pos;
+    do
+      pos = rand() % n;
+    while (hit[pos]);
+    hit[pos] = true;
+    block[pos] ^= 1 + rand() % 255;
+  }
+}
+
+static void test_rs_corrects_up_to_16()
+{
+  uint8_t block[RS_NN], sent[RS_NN];
+  for (int errors = 0; errors <= RS_NROOTS / 2; errors++)
+  {
+    for (int n = 0; n < 50; n++)
+    {
+      int pad = n % 2 ? rand() % 100 : 0;
+      randomCodeword(sent, pad);
+      memcpy(block, sent, RS_NN - pad);
+      corrupt(block, RS_NN - pad, errors);
+      TEST_ASSERT_EQUAL(errors, ReedSolomon::decode(block, pad));
+      TEST_ASSERT_EQUAL_HEX8_ARRAY(sent, block, RS_NN - pad);
+    }
+  }
+}
+
+// beyond 16 errors the block must be reported uncorrectable, not miscorrected
+static void test_rs_beyond_capability()
+{
+  uint8_t block[RS_NN], sent[RS_NN];
+  for (int errors = 17; errors <= 40; errors++)
+  {
+    for (int n = 0; n < 20; n++)
+    {
+      randomCodeword(sent, 0);
+      memcpy(block, sent, RS_NN);
+      corrupt(block, RS_NN, errors);
+      TEST_ASSERT_EQUAL(-1, ReedSolomon::decode(block));
+    }
+  }
+  TEST_ASSERT_EQUAL(-1, ReedSolomon::decode(block, -1));
+  TEST_ASSERT_EQUAL(-1, ReedSolomon::decode(block, RS_KK));
+}
+
+static void test_rs_dual_basis_interleaved()
+{
+  const int depth = 4, pad = 60, n = RS_NN - pad;
+  uint8_t sent[depth * RS_NN], data[depth * RS_NN], block[RS_NN];
+  for (int d = 0; d < depth; d++)
+  {
+    randomCodeword(block, pad);
+    for (int i = 0; i < n; i++)
+      sent[i * depth + d] = toDual(block[i]);
+  }
+  memcpy(data, sent, depth * n);
+  for (int e = 0; e < 16 * depth; e++)
+    data[e * 3 % (depth * n)] ^= 0x5A;  // 16 errors in every codeword
+  TEST_ASSERT_EQUAL(16 * depth, ReedSolomon::decodeInterleaved(data, depth * n, depth, true));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(sent, data, depth * n);
+
+  TEST_ASSERT_EQUAL(-1, ReedSolomon::decodeInterleaved(data, depth * n + 1, depth, true));
+  TEST_ASSERT_EQUAL(-1, ReedSolomon::decodeInterleaved(data, depth * n, 0, true));
+}
+
+// K=7 r=1/2, G1 = 171, G2 = 133 inverted, G1 first, MSB first
+static size_t convEncode(const uint8_t* in, size_t len, uint8_t* out)
+{
+  uint8_t sr = 0;
+  memset(out, 0, 2 * len);
+  for (size_t i = 0; i < 8 * len; i++)
+  {
+    sr = ((sr << 1) | ((in[i / 8] >> (7 - i % 8)) & 1)) & 0x7F;
+    uint8_t pair = (__builtin_parity(sr & 0x4F) << 1) | (__builtin_parity(sr & 0x6D) ^ 1);
+    out[i / 4] |= pair << (6 - 2 * (i % 4));
+  }
+  return 2 * len;
+}
+
+static size_t flipBits(uint8_t* data, size_t len, double rate)
+{
+  size_t flips = 0;
+  for (size_t i = 0; i < 8 * len; i++)
+  {
+    if (rand() < rate * RAND_MAX)
+    {
+      data[i / 8] ^= 0x80 >> (i % 8);
+      flips++;
+    }
+  }
+  return flips;
+}
+
+static size_t bitDiff(const uint8_t* a, const uint8_t* b, size_t len)
+{
+  size_t d = 0;
+  for (size_t i = 0; i < len; i++)
+    d += __builtin_popcount(a[i] ^ b[i]);
+  return d;
+}
+
+static void test_viterbi_clean_and_sparse_errors()
+{
+  uint8_t data[300], sym[600], out[300];
+  for (int n = 0; n < 20; n++)
+  {
+    size_t len = 10 + rand() % 290;
+    for (size_t i = 0; i < len; i++)
+      data[i] = rand();
+    convEncode(data, len, sym);
+    uint32_t bitErrors;
+    TEST_ASSERT_EQUAL(len, Viterbi::decode(sym, 2 * len, out, &bitErrors));
+    TEST_ASSERT_EQUAL(0, bitErrors);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(data, out, len);
+
+    // one channel error every 40 bits, away from the unterminated tail
+    for (size_t i = 20; i < 16 * len - 64; i += 40)
+      sym[i / 8] ^= 0x80 >> (i % 8);
+    size_t flips = (16 * len - 64 - 20 + 39) / 40;
+    Viterbi::decode(sym, 2 * len, out, &bitErrors);
+    TEST_ASSERT_EQUAL(flips, bitErrors);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(data, out, len);
+  }
+}
+
+// randomizer, RS in dual basis with I = 2, as sent by the satellites
+static void test_ccsds_pipeline()
+{
+  const uint8_t first[] = {0xFF, 0x48, 0x0E, 0xC0, 0x9A, 0x0D, 0x70, 0xBC};
+  uint8_t zeros[8] = {0};
+  Fec::derandomize(zeros, sizeof(zeros));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(first, zeros, sizeof(first));
+
+  const int depth = 2;
+  uint8_t sent[depth * RS_NN], frame[depth * RS_NN], out[depth * RS_NN + 1], block[RS_NN];
+  for (int d = 0; d < depth; d++)
+  {
+    randomCodeword(block, 0);
+    for (int i = 0; i < RS_NN; i++)
+      sent[i * depth + d] = toDual(block[i]);
+  }
+  memcpy(frame, sent, sizeof(frame));
+  Fec::derandomize(frame, sizeof(frame));
+  for (int e = 0; e < 20; e++)
+    frame[e * 7] ^= 0x81;
+  FecResult r;
+  size_t len = Fec::decode(FEC_CCSDS_DEFAULT, depth, frame, sizeof(frame), out, &r);
+  TEST_ASSERT_EQUAL(depth * RS_KK, len);
+  TEST_ASSERT_EQUAL(20, r.rsCorrected);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(sent, out, len);
+}
+
+template <typename F>
+static double usPerCall(F f, int calls)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < calls; i++)
+    f();
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / calls;
+}
+
+static void test_benchmark()
+{
+  char msg[200];
+  uint8_t sent[RS_NN], block[RS_NN];
+  randomCodeword(sent, 0);
+
+  // decode time against the number of symbol errors
+  for (int errors : {0, 1, 4, 8, 16})
+  {
+    double us = usPerCall([&]() {
+      memcpy(block, sent, RS_NN);
+      corrupt(block, RS_NN, errors);
+      ReedSolomon::decode(block);
+    }, 2000);
+    snprintf(msg, sizeof(msg), "RS(255,223) decode, %2d symbol errors: %.1f us", errors, us);
+    TEST_MESSAGE(msg);
+  }
+
+  // correction capability on noisy frames: symbol error rate -> frames recovered
+  for (double ser : {0.02, 0.04, 0.06, 0.07, 0.08, 0.10})
+  {
+    int ok = 0, bad = 0;
+    const int frames = 500;
+    for (int n = 0; n < frames; n++)
+    {
+      randomCodeword(sent, 0);
+      memcpy(block, sent, RS_NN);
+      for (int i = 0; i < RS_NN; i++)
+        if (rand() < ser * RAND_MAX)
+          block[i] ^= 1 + rand() % 255;
+      if (ReedSolomon::decode(block) >= 0)
+      {
+        if (memcmp(block, sent, RS_NN) == 0)
+          ok++;
+        else
+          bad++;
+      }
+    }
+    snprintf(msg, sizeof(msg), "RS symbol error rate %.2f: %5.1f%% frames recovered, %d miscorrected",
+             ser, 100.0 * ok / frames, bad);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_EQUAL(0, bad);
+  }
+
+  // Viterbi: time per 223 byte frame and decoded BER against channel BER
+  uint8_t data[RS_KK], sym[2 * RS_KK], out[RS_KK];
+  for (double ber : {0.0, 0.01, 0.02, 0.04, 0.06})
+  {
+    size_t channel = 0, residual = 0, bits = 0;
+    uint32_t bitErrors;
+    double us = 0;
+    for (int n = 0; n < 200; n++)
+    {
+      for (int i = 0; i < RS_KK; i++)
+        data[i] = rand();
+      convEncode(data, RS_KK, sym);
+      channel += flipBits(sym, sizeof(sym), ber);
+      us += usPerCall([&]() { Viterbi::decode(sym, sizeof(sym), out, &bitErrors); }, 1);
+      residual += bitDiff(data, out, RS_KK);
+      bits += 8 * RS_KK;
+    }
+    snprintf(msg, sizeof(msg), "Viterbi, channel BER %.4f: decoded BER %.2e, %.0f us per 223 byte frame",
+             (double)channel / (2 * bits), (double)residual / bits, us / 200);
+    TEST_MESSAGE(msg);
+  }
+}
+
+int main()
+{
+  srand(1);
+  UNITY_BEGIN();
+  RUN_TEST(test_rs_corrects_up_to_16);
+  RUN_TEST(test_rs_beyond_capability);
+  RUN_TEST(test_rs_dual_basis_interleaved);
+  RUN_TEST(test_viterbi_clean_and_sparse_errors);
+  RUN_TEST(test_ccsds_pipeline);
+  RUN_TEST(test_benchmark);
+  return UNITY_END();
+}
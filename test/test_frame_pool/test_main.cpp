@@ -0,0 +1,336 @@
+/*
+  test_main.cpp - FramePool leak and exhaustion tests over the RX paths
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <unity.h>
+#include <thread>
+#include <atomic>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "FramePool/FramePool.h"
+#include "BitCode/BitCode.h"
+#include "BitCode/HdlcDeframer.h"
+#include "Crc/Crc16.h"
+#include "../helpers/HdlcEncoder.h"
+#include "Fec/Fec.h"
+#include "Fec/ReedSolomon.h"
+#include "Radio/RxPath.h"
+#include "Satellites/Satellites.h"
+
+// The pool is a singleton and its high water mark is never reset, so the
+// RX path test runs first. Every test starts and ends with every slot free.
+static FramePool& pool = FramePool::getInstance();
+
+void setUp() { TEST_ASSERT_EQUAL(0, pool.inUse()); }
+void tearDown() {}
+
+static void test_borrow_all_and_exhaust()
+{
+  FrameHandle h[FRAME_POOL_SLOTS];
+  for (int i = 0; i < FRAME_POOL_SLOTS; i++)
+  {
+    h[i] = pool.borrow();
+    TEST_ASSERT_TRUE(h[i].valid());
+    memset(pool.data(h[i]), i, FRAME_POOL_SLOT_SIZE);
+  }
+  TEST_ASSERT_EQUAL(FRAME_POOL_SLOTS, pool.inUse());
+  TEST_ASSERT_EQUAL(FRAME_POOL_SLOTS, pool.highWaterMark());
+
+  uint32_t exhausted = pool.exhausted();
+  FrameHandle extra = pool.borrow();
+  TEST_ASSERT_FALSE(extra.valid());
+  TEST_ASSERT_NULL(pool.data(extra));
+  TEST_ASSERT_EQUAL(exhausted + 1, pool.exhausted());
+
+  // slots do not overlap
+  for (int i = 0; i < FRAME_POOL_SLOTS; i++)
+    for (int j = 0; j < FRAME_POOL_SLOT_SIZE; j++)
+      TEST_ASSERT_EQUAL(i, pool.data(h[i])[j]);
+
+  // a freed slot in the middle is found again, releasing twice is harmless
+  FrameHandle middle = h[7];
+  pool.release(h[7]);
+  TEST_ASSERT_FALSE(h[7].valid());
+  pool.release(h[7]);
+  h[7] = pool.borrow();
+  TEST_ASSERT_EQUAL(middle.idx, h[7].idx);
+
+  for (int i = 0; i < FRAME_POOL_SLOTS; i++)
+    pool.release(h[i]);
+  TEST_ASSERT_EQUAL(0, pool.inUse());
+}
+
+static void test_pooled_buffer_scope()
+{
+  {
+    PooledBuffer<uint8_t> a;
+    PooledBuffer<char> b(false);
+    TEST_ASSERT_TRUE(a.valid());
+    TEST_ASSERT_FALSE(b.valid());
+    TEST_ASSERT_EQUAL(1, pool.inUse());
+    TEST_ASSERT_TRUE(b.acquire());
+    TEST_ASSERT_TRUE(b.acquire());  // already holds one
+    TEST_ASSERT_EQUAL(2, pool.inUse());
+    TEST_ASSERT_EQUAL(FRAME_POOL_SLOT_SIZE / 4, PooledBuffer<uint32_t>::capacity());
+  }
+  TEST_ASSERT_EQUAL(0, pool.inUse());
+
+  // detach hands the slot over, the new owner releases it
+  FrameHandle h;
+  {
+    PooledBuffer<uint8_t> a;
+    h = a.detach();
+    TEST_ASSERT_FALSE(a.valid());
+  }
+  TEST_ASSERT_EQUAL(1, pool.inUse());
+  pool.release(h);
+}
+
+enum Path { PATH_RAW, PATH_FEC, PATH_MANCHESTER, PATH_HDLC, PATH_FEC_HDLC, PATHS };
+
+// Radio::readPacket(), processPacket() and listen() around the real RxPath.
+// Returns the frames published, -1 if the RX task had to drop the packet.
+static int receive(RxPath& rx, Path path, const std::vector<uint8_t>& capture)
+{
+  // RX task: the frame read out of the FIFO travels in RxPacket
+  RxPacket* pkt = rx.prepare();
+  if (!pkt)
+    return -1;
+  pkt->len = capture.size();
+  memcpy(rx.data(pkt), capture.data(), pkt->len);
+  rx.commit();
+
+  pkt = rx.front();
+  TEST_ASSERT_NOT_NULL(pkt);
+  int published = 0;
+  {
+    RxFrame frame(rx.data(pkt), pkt->len);
+    RxPath::logHex(frame.data, frame.len);
+    uint8_t fec = path == PATH_FEC || path == PATH_FEC_HDLC ? FEC_RANDOMIZER : 0;
+    uint8_t decoder = path == PATH_HDLC || path == PATH_FEC_HDLC ? DECODER_AX25_NRZI
+                    : path == PATH_MANCHESTER ? DECODER_MANCHESTER : DECODER_RAW;
+    RxDecode decoded = rx.decode(frame, decoder, fec, 1, nullptr, 0);
+    if (decoded == RX_DECODE_HDLC)
+    {
+      rx.deframer().pop();
+      published = 1;
+    }
+    else if (decoded == RX_DECODE_FRAME && decoder != DECODER_AX25_NRZI)
+      published = 1;
+  }
+  rx.pop();
+
+  // listen() publishes the rest of the frames of the capture one by one
+  while (rx.deframer().available())
+  {
+    rx.deframer().pop();
+    published++;
+  }
+  return published;
+}
+
+static std::vector<uint8_t> hdlcCapture(int frames, bool randomized)
+{
+  HdlcEncoder enc;
+  enc.flag(3);
+  for (int f = 0; f < frames; f++)
+  {
+    uint8_t data[40];
+    for (size_t i = 0; i < sizeof(data); i++)
+      data[i] = rand();
+    enc.frame(data, sizeof(data));
+  }
+  std::vector<uint8_t> b = enc.bytes();
+  if (randomized)
+    Fec::derandomize(b.data(), b.size());  // the randomizer is its own inverse
+  return b;
+}
+
+// every path, many times: nothing leaks and the pool never runs out
+static void test_rx_paths_do_not_leak()
+{
+  srand(1);
+  uint32_t exhausted = pool.exhausted();
+  {
+    RxPath rx;
+    for (int i = 0; i < 20000; i++)
+    {
+      Path path = (Path)(i % PATHS);
+      int frames = 1 + i % HDLC_PENDING_FRAMES;
+      std::vector<uint8_t> capture;
+      if (path == PATH_HDLC || path == PATH_FEC_HDLC)
+        capture = hdlcCapture(frames, path == PATH_FEC_HDLC);
+      else
+        capture.assign(64 + i % 190, (uint8_t)i);
+
+      int published = receive(rx, path, capture);
+      TEST_ASSERT_EQUAL(path == PATH_HDLC || path == PATH_FEC_HDLC ? frames : 1, published);
+      // only the deframer work slot outlives a packet
+      TEST_ASSERT_LESS_OR_EQUAL(1, pool.inUse());
+    }
+    TEST_ASSERT_EQUAL(0, rx.deframer().stats().crcErrors);
+    TEST_ASSERT_EQUAL(0, rx.deframer().stats().dropped);
+    TEST_ASSERT_EQUAL(0, rx.dropped());
+  }
+  TEST_ASSERT_EQUAL(0, pool.inUse());
+  TEST_ASSERT_EQUAL(exhausted, pool.exhausted());
+
+  // RX frame, the decoding stages, deframer work slot and the pending frames
+  char msg[64];
+  snprintf(msg, sizeof(msg), "high water mark %u of %u slots", pool.highWaterMark(), FRAME_POOL_SLOTS);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_LESS_OR_EQUAL(1 + RX_WORK_FRAMES + 1 + HDLC_PENDING_FRAMES, pool.highWaterMark());
+}
+
+// with the pool almost empty the stages drop frames and count it, and every
+// slot comes back once the pressure is gone
+static void test_exhaustion_drops_and_recovers()
+{
+  FrameHandle held[FRAME_POOL_SLOTS];
+  int n = 0;
+  while (n < FRAME_POOL_SLOTS - 1)
+    held[n++] = pool.borrow();
+
+  uint32_t exhausted = pool.exhausted();
+  {
+    RxPath rx;
+    // the RX frame takes the last slot, none left for the hex dump or the deframer
+    std::vector<uint8_t> capture = hdlcCapture(3, false);
+    int published = receive(rx, PATH_HDLC, capture);
+    TEST_ASSERT_EQUAL(0, published);
+    TEST_ASSERT_EQUAL(3, rx.deframer().stats().dropped);
+    TEST_ASSERT_EQUAL(0, rx.deframer().stats().crcErrors);
+    TEST_ASSERT_GREATER_THAN(exhausted, pool.exhausted());
+    TEST_ASSERT_EQUAL(FRAME_POOL_SLOTS - 1, pool.inUse());
+
+    // a Manchester packet has nowhere to be decoded to
+    TEST_ASSERT_EQUAL(0, receive(rx, PATH_MANCHESTER, capture));
+
+    // no slot left for the RX frame at all, the RX task drops the packet
+    held[n++] = pool.borrow();
+    TEST_ASSERT_EQUAL(-1, receive(rx, PATH_RAW, capture));
+    TEST_ASSERT_EQUAL(1, rx.dropped());
+  }
+  while (n)
+    pool.release(held[--n]);
+  TEST_ASSERT_EQUAL(0, pool.inUse());
+
+  // and the whole pool can be borrowed again
+  for (n = 0; n < FRAME_POOL_SLOTS; n++)
+  {
+    held[n] = pool.borrow();
+    TEST_ASSERT_TRUE(held[n].valid());
+  }
+  while (n)
+    pool.release(held[--n]);
+}
+
+// without a slot the deframer still checks the FCS: flag fill and noise are
+// not counted as dropped frames, a corrupted frame is a CRC error
+static void test_exhausted_deframer_counts()
+{
+  FrameHandle held[FRAME_POOL_SLOTS];
+  for (int n = 0; n < FRAME_POOL_SLOTS; n++)
+    held[n] = pool.borrow();
+  {
+    HdlcDeframer hdlc;
+    HdlcEncoder enc;
+    enc.flag(200);
+    std::vector<uint8_t> fill = enc.bytes();
+    hdlc.resync();
+    hdlc.feed(fill.data(), fill.size());
+    TEST_ASSERT_EQUAL(0, hdlc.stats().dropped);
+    TEST_ASSERT_EQUAL(0, hdlc.stats().crcErrors);
+    TEST_ASSERT_EQUAL(0, hdlc.stats().frameErrors);
+
+    uint8_t data[40];
+    for (size_t i = 0; i < sizeof(data); i++)
+      data[i] = rand();
+    enc.frame(data, sizeof(data));
+    size_t second = enc.bits() / 8 + 10;
+    enc.frame(data, sizeof(data));
+    std::vector<uint8_t> capture = enc.bytes();
+    capture[second] ^= 0x08;  // one line bit inside the second frame
+
+    hdlc.resync();
+    hdlc.feed(capture.data(), capture.size());
+    TEST_ASSERT_FALSE(hdlc.available());
+    TEST_ASSERT_EQUAL(1, hdlc.stats().dropped);
+    TEST_ASSERT_EQUAL(1, hdlc.stats().crcErrors + hdlc.stats().frameErrors);
+  }
+  for (int n = 0; n < FRAME_POOL_SLOTS; n++)
+    pool.release(held[n]);
+}
+
+// the RX task borrows while the loop borrows and releases
+static void test_concurrent_borrow_release()
+{
+  const int packets = 200000;
+  std::atomic<int> handoff(FrameHandle::INVALID);  // one packet in flight, like a queue slot
+  std::atomic<int> failed(0);
+
+  std::thread rxTask([&] {
+    for (int i = 0; i < packets; i++)
+    {
+      FrameHandle h = pool.borrow();
+      if (!h.valid())
+      {
+        failed++;
+        continue;
+      }
+      while (handoff.load() != FrameHandle::INVALID)
+        std::this_thread::yield();
+      handoff.store(h.idx);
+    }
+  });
+
+  int released = 0;
+  while (released + failed < packets)
+  {
+    int idx = handoff.exchange(FrameHandle::INVALID);
+    if (idx == FrameHandle::INVALID)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+    // a scratch buffer of the loop at the same time
+    PooledBuffer<uint8_t> scratch;
+    TEST_ASSERT_TRUE(scratch.valid());
+    FrameHandle h;
+    h.idx = idx;
+    pool.release(h);
+    released++;
+  }
+  rxTask.join();
+  TEST_ASSERT_EQUAL(packets, released);
+  TEST_ASSERT_EQUAL(0, failed.load());
+  TEST_ASSERT_EQUAL(0, pool.inUse());
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_rx_paths_do_not_leak);
+  RUN_TEST(test_borrow_all_and_exhaust);
+  RUN_TEST(test_pooled_buffer_scope);
+  RUN_TEST(test_exhaustion_drops_and_recovers);
+  RUN_TEST(test_exhausted_deframer_counts);
+  RUN_TEST(test_concurrent_borrow_release);
+  return UNITY_END();
+}
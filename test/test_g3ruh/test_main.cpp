@@ -0,0 +1,187 @@
+/*
+  test_main.cpp - G3RUH descrambler tests
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <unity.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "BitCode/BitCode.h"
+#include "BitCode/HdlcDeframer.h"
+#include "Crc/Crc16.h"
+#include "../helpers/HdlcEncoder.h"
+
+void setUp() {}
+void tearDown() {}
+
+static void check(const uint8_t* in, const uint8_t* expected, size_t len)
+{
+  uint8_t out[64];
+  uint32_t state = 0;
+  BitCode::g3ruhDescramble(in, out, len, &state);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, out, len);
+}
+
+// worked by hand from the polynomial
+static void test_known_vectors()
+{
+  // a single line ONE comes out again 12 and 17 bits later
+  const uint8_t impulse[] = {0x80, 0x00, 0x00, 0x00};
+  const uint8_t impulseOut[] = {0x80, 0x08, 0x40, 0x00};
+  check(impulse, impulseOut, sizeof(impulse));
+
+  // the last bit of the first byte: taps land in bits 19 and 24
+  const uint8_t late[] = {0x01, 0x00, 0x00, 0x00};
+  const uint8_t lateOut[] = {0x01, 0x00, 0x10, 0x80};
+  check(late, lateOut, sizeof(late));
+
+  // zeros stay zeros, an all ONE line descrambles to ONEs (1 ^ 1 ^ 1) once both taps are full
+  const uint8_t zeros[4] = {0};
+  check(zeros, zeros, sizeof(zeros));
+  const uint8_t ones[] = {0xFF, 0xFF, 0xFF, 0xFF};
+  const uint8_t onesOut[] = {0xFF, 0xF0, 0x7F, 0xFF};
+  check(ones, onesOut, sizeof(ones));
+
+  // the scrambler output for an idle (all ZERO) line from state 1 is the
+  // 2^17 - 1 bit m-sequence, which descrambles back to ZEROs after the first bit
+  G3ruh tx;
+  tx.hist = 1;
+  uint8_t seq[64], out[64];
+  for (size_t i = 0; i < sizeof(seq); i++)
+    seq[i] = tx.scramble(0);
+  uint32_t state = 1;
+  BitCode::g3ruhDescramble(seq, out, sizeof(seq), &state);
+  for (size_t i = 0; i < sizeof(out); i++)
+    TEST_ASSERT_EQUAL_HEX8(0, out[i]);
+}
+
+// matches the bit at a time reference on random data, for any split of the input
+static void test_matches_reference_and_splits()
+{
+  uint8_t data[512], line[512], ref[512], out[512];
+  for (int n = 0; n < 200; n++)
+  {
+    size_t len = 1 + rand() % sizeof(data);
+    for (size_t i = 0; i < len; i++)
+      data[i] = rand();
+    G3ruh tx, rx;
+    tx.hist = rand() & 0x1FFFF;
+    rx.hist = tx.hist;  // receiver already in sync
+    for (size_t i = 0; i < len; i++)
+    {
+      line[i] = tx.scramble(data[i]);
+      ref[i] = rx.descramble(line[i]);
+    }
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(data, ref, len);
+
+    // from a zero state, fed in random pieces or one byte per call
+    G3ruh start;
+    uint32_t state = 0;
+    size_t pos = 0;
+    while (pos < len)
+    {
+      size_t piece = 1 + rand() % (len - pos);
+      if (n % 4 == 0)
+        piece = 1;
+      BitCode::g3ruhDescramble(line + pos, out + pos, piece, &state);
+      pos += piece;
+    }
+    // from a zero state the first 17 bits differ, then it is self synchronising
+    for (size_t i = 0; i < len; i++)
+      ref[i] = start.descramble(line[i]);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(ref, out, len);
+    if (len > 3)
+      TEST_ASSERT_EQUAL_HEX8_ARRAY(data + 3, out + 3, len - 3);
+  }
+}
+
+// in and out may be the same buffer
+static void test_in_place()
+{
+  uint8_t buf[100], copy[100], out[100];
+  for (size_t i = 0; i < sizeof(buf); i++)
+    buf[i] = rand();
+  memcpy(copy, buf, sizeof(buf));
+  uint32_t s1 = 0, s2 = 0;
+  BitCode::g3ruhDescramble(copy, out, sizeof(copy), &s1);
+  BitCode::g3ruhDescramble(buf, buf, sizeof(buf), &s2);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(out, buf, sizeof(buf));
+  TEST_ASSERT_EQUAL_HEX32(s1, s2);
+}
+
+// a scrambled capture split across feeds at every byte boundary decodes the
+// same frames, each one placed at the end of its opening flag
+static void test_deframer_split_feeds()
+{
+  uint8_t frames[3][120];
+  size_t lens[3];
+  size_t offsets[3];
+  HdlcEncoder enc(true);
+  enc.scrambler.hist = 0x1ABCD;  // the transmitter state is unknown to the receiver
+  for (int i = 0; i < 8; i++)
+    enc.scrambler.scramble(rand());
+  enc.flag(4);
+  for (int f = 0; f < 3; f++)
+  {
+    lens[f] = 20 + rand() % 100;
+    for (size_t i = 0; i < lens[f]; i++)
+      frames[f][i] = rand();
+    offsets[f] = enc.bits();
+    enc.frame(frames[f], lens[f]);
+    enc.flag(f);
+  }
+  std::vector<uint8_t> capture = enc.bytes();
+
+  HdlcDeframer d;
+  for (size_t split = 0; split <= capture.size(); split++)
+  {
+    uint32_t before = d.stats().frames;
+    d.resync(true);
+    d.feed(capture.data(), split);
+    d.feed(capture.data() + split, capture.size() - split);
+    TEST_ASSERT_EQUAL(before + 3, d.stats().frames);
+    for (int f = 0; f < 3; f++)
+    {
+      TEST_ASSERT_TRUE(d.available());
+      TEST_ASSERT_EQUAL(lens[f] + 2, d.frameLen());
+      TEST_ASSERT_EQUAL_HEX8_ARRAY(frames[f], d.frame(), lens[f]);
+      TEST_ASSERT_EQUAL(offsets[f], d.frameOffset());
+      d.pop();
+    }
+    TEST_ASSERT_FALSE(d.available());
+  }
+
+  // without the descrambler nothing valid comes out
+  uint32_t before = d.stats().frames;
+  d.resync(false);
+  d.feed(capture.data(), capture.size());
+  TEST_ASSERT_EQUAL(before, d.stats().frames);
+  while (d.available())
+    d.pop();
+}
+
+int main()
+{
+  srand(1);
+  UNITY_BEGIN();
+  RUN_TEST(test_known_vectors);
+  RUN_TEST(test_matches_reference_and_splits);
+  RUN_TEST(test_in_place);
+  RUN_TEST(test_deframer_split_feeds);
+  return UNITY_END();
+}
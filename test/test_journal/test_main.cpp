@@ -0,0 +1,241 @@
+/*
+  test_main.cpp - Journal tests over an in memory LittleFS
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <unity.h>
+#include <stdio.h>
+#include <vector>
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "Journal/Journal.h"
+
+// begin() is a reboot: the RAM cache is lost, the flash is read again
+static Journal& journal = Journal::getInstance();
+
+void setUp()
+{
+  LittleFS.reset();
+  stubMillis() = 0;
+  journal.begin();
+}
+void tearDown() {}
+
+// record i: its number followed by len - 4 bytes derived from it
+static void append(uint32_t i, size_t len = 100)
+{
+  uint8_t rec[JOURNAL_RECORD_MAX];
+  memcpy(rec, &i, sizeof(i));
+  for (size_t k = sizeof(i); k < len; k++)
+    rec[k] = i + k;
+  TEST_ASSERT_TRUE(journal.append(rec, len));
+}
+
+// number of the oldest record, -1 if the journal is empty
+static int32_t peek()
+{
+  uint8_t rec[JOURNAL_RECORD_MAX];
+  size_t len = journal.next(rec, sizeof(rec));
+  if (!len)
+    return -1;
+  uint32_t i;
+  memcpy(&i, rec, sizeof(i));
+  for (size_t k = sizeof(i); k < len; k++)
+    TEST_ASSERT_EQUAL_HEX8((uint8_t)(i + k), rec[k]);
+  return i;
+}
+
+static std::vector<int32_t> drain()
+{
+  std::vector<int32_t> out;
+  for (int32_t i = peek(); i >= 0; i = peek())
+  {
+    out.push_back(i);
+    journal.pop();
+  }
+  return out;
+}
+
+static size_t segments()
+{
+  return LittleFS.files.size();
+}
+
+static void test_fifo_through_cache_and_flash()
+{
+  const int n = 1000;
+  for (int i = 0; i < n; i++)
+  {
+    append(i);
+    stubMillis() += 100;
+    journal.loop();
+  }
+  TEST_ASSERT_EQUAL(n, journal.depth());
+  TEST_ASSERT_GREATER_THAN(1, segments());
+
+  std::vector<int32_t> got = drain();
+  TEST_ASSERT_EQUAL(n, got.size());
+  for (int i = 0; i < n; i++)
+    TEST_ASSERT_EQUAL(i, got[i]);
+  TEST_ASSERT_EQUAL(0, journal.depth());
+  TEST_ASSERT_EQUAL(0, journal.dropped());
+  TEST_ASSERT_EQUAL(0, segments());
+}
+
+// past JOURNAL_MAX_SEGMENTS the oldest segment goes, the rest stays in order
+static void test_rotation_drops_oldest()
+{
+  const int n = 2000;
+  for (int i = 0; i < n; i++)
+    append(i, JOURNAL_RECORD_MAX);
+  journal.flush();
+  TEST_ASSERT_LESS_OR_EQUAL(JOURNAL_MAX_SEGMENTS, segments());
+  TEST_ASSERT_GREATER_THAN(0, journal.dropped());
+  TEST_ASSERT_EQUAL(n, journal.depth() + journal.dropped());
+
+  std::vector<int32_t> got = drain();
+  TEST_ASSERT_EQUAL(n - journal.dropped(), got.size());
+  TEST_ASSERT_EQUAL(journal.dropped(), got.front());
+  for (size_t i = 1; i < got.size(); i++)
+    TEST_ASSERT_EQUAL(got[i - 1] + 1, got[i]);
+}
+
+// after a reboot the flushed records come back from the start of the segment
+// being read, the ones still in RAM are lost
+static void test_reboot_replays()
+{
+  for (int i = 0; i < 300; i++)
+    append(i);
+  journal.flush();
+  for (int i = 300; i < 310; i++)
+    append(i);
+  for (int i = 0; i < 250; i++)
+  {
+    TEST_ASSERT_EQUAL(i, peek());
+    journal.pop();
+  }
+
+  journal.begin();
+  TEST_ASSERT_GREATER_OR_EQUAL(50, journal.depth());
+  std::vector<int32_t> got = drain();
+  TEST_ASSERT_LESS_OR_EQUAL(250, got.front());
+  TEST_ASSERT_EQUAL(299, got.back());
+  for (size_t i = 1; i < got.size(); i++)
+    TEST_ASSERT_EQUAL(got[i - 1] + 1, got[i]);
+}
+
+// a record read from the cache that moves to flash before pop() is read again
+static void test_flush_between_next_and_pop()
+{
+  append(0);
+  append(1);
+  TEST_ASSERT_EQUAL(0, peek());
+  journal.flush();
+  journal.pop();
+  TEST_ASSERT_EQUAL(0, peek());
+  journal.pop();
+
+  // and one read from flash is popped across a flush
+  append(2);
+  TEST_ASSERT_EQUAL(1, peek());
+  journal.flush();
+  journal.pop();
+
+  std::vector<int32_t> got = drain();
+  TEST_ASSERT_EQUAL(1, got.size());
+  TEST_ASSERT_EQUAL(2, got[0]);
+}
+
+// a short write loses the cache but not the journal: the records before it
+// are still read and the next flush goes to a new segment
+static void test_failed_write()
+{
+  for (int i = 0; i < 10; i++)
+    append(i);
+  journal.flush();
+
+  for (int i = 10; i < 20; i++)
+    append(i);
+  LittleFS.writeBudget = 250;  // two records and a piece of the third
+  journal.flush();
+  TEST_ASSERT_EQUAL(8, journal.dropped());
+  TEST_ASSERT_EQUAL(12, journal.depth());
+
+  // the cache is usable again, the flash too once there is room
+  LittleFS.writeBudget = SIZE_MAX;
+  for (int i = 20; i < 40; i++)
+    append(i);
+  journal.flush();
+  TEST_ASSERT_EQUAL(2, segments());
+
+  std::vector<int32_t> got = drain();
+  TEST_ASSERT_EQUAL(32, got.size());
+  for (int i = 0; i < 12; i++)
+    TEST_ASSERT_EQUAL(i, got[i]);
+  for (int i = 12; i < 32; i++)
+    TEST_ASSERT_EQUAL(i + 8, got[i]);
+}
+
+// with the flash full the cache keeps taking records after every failed flush
+static void test_full_flash_keeps_appending()
+{
+  LittleFS.writeBudget = 0;
+  uint32_t accepted = 0;
+  for (int i = 0; i < 200; i++)
+  {
+    append(i);
+    accepted++;
+  }
+  TEST_ASSERT_EQUAL(200, accepted);
+  TEST_ASSERT_EQUAL(200, journal.depth() + journal.dropped());
+}
+
+// a segment torn by a power cut is not appended to after the reboot
+static void test_torn_segment_after_reboot()
+{
+  for (int i = 0; i < 10; i++)
+    append(i);
+  journal.flush();
+  std::vector<uint8_t>& seg = LittleFS.files.begin()->second;
+  seg.resize(seg.size() - 30);
+
+  journal.begin();
+  TEST_ASSERT_EQUAL(9, journal.depth());
+  for (int i = 10; i < 20; i++)
+    append(i);
+  journal.flush();
+  TEST_ASSERT_EQUAL(2, segments());
+
+  std::vector<int32_t> got = drain();
+  TEST_ASSERT_EQUAL(19, got.size());
+  TEST_ASSERT_EQUAL(8, got[8]);
+  TEST_ASSERT_EQUAL(10, got[9]);
+  TEST_ASSERT_EQUAL(19, got.back());
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_fifo_through_cache_and_flash);
+  RUN_TEST(test_rotation_drops_oldest);
+  RUN_TEST(test_reboot_replays);
+  RUN_TEST(test_flush_between_next_and_pop);
+  RUN_TEST(test_failed_write);
+  RUN_TEST(test_full_flash_keeps_appending);
+  RUN_TEST(test_torn_segment_after_reboot);
+  return UNITY_END();
+}
@@ -0,0 +1,132 @@
+/*
+  test_main.cpp - Log level filter tests and benchmark
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <unity.h>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLES() __rdtsc()
+#else
+#define CYCLES() 0ull
+#endif
+#include "Logger/Logger.h"
+
+void setUp() { Log::setLogLevel(Log::LOG_LEVEL_NONE); }
+void tearDown() {}
+
+static void test_levels()
+{
+  uint32_t seq = Log::getNextSeq();
+  Log::debug(PSTR("debug %d"), 1);
+  Log::info(PSTR("info %d"), 1);
+  Log::error(PSTR("error %d"), 1);
+  TEST_ASSERT_EQUAL(seq, Log::getNextSeq());
+  Log::console(PSTR("console %d"), 1);
+  TEST_ASSERT_EQUAL(seq + 1, Log::getNextSeq());
+
+  Log::setLogLevel(Log::LOG_LEVEL_ERROR);
+  Log::debug(PSTR("debug %d"), 2);
+  Log::info(PSTR("info %d"), 2);
+  Log::error(PSTR("error %d"), 2);
+  TEST_ASSERT_EQUAL(seq + 2, Log::getNextSeq());
+
+  Log::setLogLevel(Log::LOG_LEVEL_DEBUG);
+  Log::debug(PSTR("debug %d"), 3);
+#if LOG_MAX_LEVEL >= 3
+  TEST_ASSERT_EQUAL(seq + 3, Log::getNextSeq());
+  char line[LOG_LINE_SIZE];
+  size_t len = Log::getLog(seq + 2, line, sizeof(line) - 1);
+  line[len] = '\0';
+  TEST_ASSERT_NOT_NULL(strstr(line, "debug 3"));
+#else
+  TEST_ASSERT_EQUAL(seq + 2, Log::getNextSeq());  // above the compile time ceiling
+#endif
+}
+
+// the level check does not skip the evaluation of the arguments
+static void test_arguments_evaluated()
+{
+  int calls = 0;
+  Log::debug(PSTR("%d"), ++calls);
+  Log::info(PSTR("%d"), ++calls);
+  TEST_ASSERT_EQUAL(2, calls);
+}
+
+// dmode can not go above LOG_MAX_LEVEL (build with -DLOG_MAX_LEVEL=1 to check the release setting)
+static void test_compile_time_ceiling()
+{
+  Log::setLogLevel(Log::LOG_LEVEL_DEBUG);
+  TEST_ASSERT_EQUAL(Log::LOG_LEVEL_DEBUG <= LOG_MAX_LEVEL, Log::enabled(Log::LOG_LEVEL_DEBUG));
+  TEST_ASSERT_TRUE(Log::enabled(Log::LOG_LEVEL_NONE));
+}
+
+// Log::debug before the level was checked first: the message was always
+// formatted and AddLog then dropped it
+static Log::LoggingLevels oldLevel = Log::LOG_LEVEL_NONE;
+static volatile char oldSink;
+static void oldDebug(const char* formatP, ...)
+{
+  va_list arg;
+  char buffer[256];
+  va_start(arg, formatP);
+  vsnprintf_P(buffer, sizeof(buffer), formatP, arg);
+  va_end(arg);
+  if (Log::LOG_LEVEL_DEBUG > oldLevel)
+    return;
+  oldSink = buffer[0];
+}
+
+static void test_benchmark()
+{
+  const int calls = 1000000;
+  float rssi = -120.25f, snr = -5.5f;
+  const char* sat = "Norbi";
+  char msg[160];
+
+  uint64_t c0 = CYCLES();
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < calls / 100; i++)
+    oldDebug(PSTR("Listening Satellite: %s NORAD: %u RSSI %f SNR %f"), sat, (unsigned)i, rssi, snr);
+  uint64_t c1 = CYCLES();
+  auto t1 = std::chrono::steady_clock::now();
+  for (int i = 0; i < calls; i++)
+  {
+    Log::debug(PSTR("Listening Satellite: %s NORAD: %u RSSI %f SNR %f"), sat, (unsigned)i, rssi, snr);
+    asm volatile("" ::: "memory");
+  }
+  uint64_t c2 = CYCLES();
+  auto t2 = std::chrono::steady_clock::now();
+
+  snprintf(msg, sizeof(msg), "filtered debug call, format first: %.0f cycles, %.0f ns",
+           (double)(c1 - c0) / (calls / 100), std::chrono::duration<double, std::nano>(t1 - t0).count() / (calls / 100));
+  TEST_MESSAGE(msg);
+  snprintf(msg, sizeof(msg), "filtered debug call, level first: %.1f cycles, %.1f ns",
+           (double)(c2 - c1) / calls, std::chrono::duration<double, std::nano>(t2 - t1).count() / calls);
+  TEST_MESSAGE(msg);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_levels);
+  RUN_TEST(test_arguments_evaluated);
+  RUN_TEST(test_compile_time_ceiling);
+  RUN_TEST(test_benchmark);
+  return UNITY_END();
+}
@@ -0,0 +1,207 @@
+/*
+  test_main.cpp - Log ring buffer tests and benchmark
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <unity.h>
+#include <chrono>
+#include <deque>
+#include <string>
+#include <stdlib.h>
+#include "Logger/Logger.h"
+
+// Text log only: the model below follows the byte layout of LOG_BINARY=0 lines
+#if LOG_BINARY
+#error "test_log_ring checks the text log, build it without LOG_BINARY"
+#endif
+
+#define TIME_LEN 9  // "13:45:21 ", the host clock is always set
+
+void setUp() {}
+void tearDown() {}
+
+// What the log must hold: the same eviction rules as Log::store, and where
+// the next line goes so the ones that wrap around log[] are known. Every
+// line of the program goes through logLine(), so it starts from an empty log.
+struct Line {
+  uint32_t seq;
+  std::string text;
+};
+
+static struct Model {
+  std::deque<Line> lines;
+  size_t start = 0, used = 0;
+
+  // returns true if the new line wraps around the end of the buffer
+  bool add(uint32_t seq, const std::string& text)
+  {
+    size_t total = TIME_LEN + text.size();
+    while (lines.size() == LOG_INDEX_SIZE || used + total > MAX_LOG_SIZE)
+    {
+      size_t len = TIME_LEN + lines.front().text.size();
+      start = (start + len) % MAX_LOG_SIZE;
+      used -= len;
+      lines.pop_front();
+    }
+    size_t offset = (start + used) % MAX_LOG_SIZE;
+    lines.push_back({seq, text});
+    used += total;
+    return offset + total > MAX_LOG_SIZE;
+  }
+} model;
+
+static bool logLine(const std::string& text)
+{
+  Log::console(PSTR("%s"), text.c_str());
+  return model.add(Log::getNextSeq() - 1, text);
+}
+
+static std::string randomText(size_t len)
+{
+  std::string s;
+  for (size_t i = 0; i < len; i++)
+    s += (char)('a' + rand() % 26);
+  return s;
+}
+
+static void checkLog()
+{
+  const Model& m = model;
+  TEST_ASSERT_EQUAL(m.lines.front().seq, Log::getFirstSeq());
+  TEST_ASSERT_EQUAL(m.lines.back().seq + 1, Log::getNextSeq());
+  for (const Line& l : m.lines)
+  {
+    char buf[LOG_LINE_SIZE];
+    size_t len = Log::getLog(l.seq, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL(TIME_LEN + l.text.size(), len);
+    TEST_ASSERT_EQUAL(':', buf[2]);
+    TEST_ASSERT_EQUAL_STRING_LEN(l.text.c_str(), buf + TIME_LEN, l.text.size());
+  }
+}
+
+// short lines: the index fills up before the bytes do
+static void test_evict_when_index_full()
+{
+  for (int i = 0; i < 3 * LOG_INDEX_SIZE; i++)
+    logLine("line " + std::to_string(i));
+  TEST_ASSERT_EQUAL(LOG_INDEX_SIZE, Log::getNextSeq() - Log::getFirstSeq());
+  TEST_ASSERT_LESS_THAN(MAX_LOG_SIZE, model.used);
+  checkLog();
+}
+
+// long lines: the bytes fill up with far fewer lines than the index holds
+static void test_evict_when_bytes_full()
+{
+  std::string text(240, 'x');
+  for (int i = 0; i < 100; i++)
+  {
+    text[0] = 'a' + i % 26;
+    logLine(text);
+  }
+  uint32_t kept = Log::getNextSeq() - Log::getFirstSeq();
+  TEST_ASSERT_EQUAL(MAX_LOG_SIZE / (TIME_LEN + text.size()), kept);
+  TEST_ASSERT_LESS_THAN(LOG_INDEX_SIZE, kept);
+  checkLog();
+}
+
+// random lengths, every line read back after every write, including lines
+// split across the end of log[]
+static void test_lines_wrapping_around()
+{
+  int wrapped = 0;
+  for (int i = 0; i < 5000; i++)
+  {
+    std::string text = randomText(1 + rand() % 250);
+    if (logLine(text))
+    {
+      wrapped++;
+      char buf[LOG_LINE_SIZE];
+      size_t len = Log::getLog(Log::getNextSeq() - 1, buf, sizeof(buf));
+      TEST_ASSERT_EQUAL(TIME_LEN + text.size(), len);
+      TEST_ASSERT_EQUAL_STRING_LEN(text.c_str(), buf + TIME_LEN, text.size());
+    }
+    if (i % 50 == 0)
+      checkLog();
+  }
+  checkLog();
+  TEST_ASSERT_GREATER_THAN(10, wrapped);
+}
+
+static void test_read_evicted_and_future()
+{
+  for (int i = 0; i < 2 * LOG_INDEX_SIZE; i++)
+    logLine("fill " + std::to_string(i));
+  char buf[LOG_LINE_SIZE];
+  uint32_t first = Log::getFirstSeq();
+  uint32_t next = Log::getNextSeq();
+  TEST_ASSERT_GREATER_THAN(1, first);
+  TEST_ASSERT_EQUAL(0, Log::getLog(first - 1, buf, sizeof(buf)));
+  TEST_ASSERT_EQUAL(0, Log::getLog(1, buf, sizeof(buf)));
+  TEST_ASSERT_EQUAL(0, Log::getLog(0, buf, sizeof(buf)));
+  TEST_ASSERT_EQUAL(0, Log::getLog(next, buf, sizeof(buf)));
+  TEST_ASSERT_EQUAL(0, Log::getLog(next + LOG_INDEX_SIZE, buf, sizeof(buf)));
+  TEST_ASSERT_GREATER_THAN(0, Log::getLog(first, buf, sizeof(buf)));
+
+  // a line evicted while a reader still holds its seq is not read from the slot reused by a newer line
+  uint32_t old = Log::getNextSeq() - 1;
+  for (int i = 0; i < LOG_INDEX_SIZE; i++)
+    logLine("push " + std::to_string(i));
+  TEST_ASSERT_EQUAL(0, Log::getLog(old, buf, sizeof(buf)));
+
+  // a short buffer gets the start of the line
+  uint32_t last = Log::getNextSeq() - 1;
+  TEST_ASSERT_EQUAL(5, Log::getLog(last, buf, 5));
+}
+
+static void test_benchmark()
+{
+  const int lines = 200000;
+  std::string text(60, 'x');
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < lines; i++)
+    Log::console(PSTR("%s %06d"), text.c_str(), i);
+  auto t1 = std::chrono::steady_clock::now();
+
+  char buf[LOG_LINE_SIZE];
+  size_t bytes = 0;
+  int reads = 0;
+  for (int r = 0; r < 1000; r++)
+    for (uint32_t seq = Log::getFirstSeq(); seq != Log::getNextSeq(); seq++, reads++)
+      bytes += Log::getLog(seq, buf, sizeof(buf));
+  auto t2 = std::chrono::steady_clock::now();
+  TEST_ASSERT_GREATER_THAN(0, bytes);
+
+  char msg[160];
+  snprintf(msg, sizeof(msg), "Log::console, 67 character line: %.0f ns per line, %.1f MB/s",
+           std::chrono::duration<double, std::nano>(t1 - t0).count() / lines,
+           lines * (TIME_LEN + 67) / std::chrono::duration<double, std::micro>(t1 - t0).count());
+  TEST_MESSAGE(msg);
+  snprintf(msg, sizeof(msg), "Log::getLog: %.0f ns per line", std::chrono::duration<double, std::nano>(t2 - t1).count() / reads);
+  TEST_MESSAGE(msg);
+}
+
+int main()
+{
+  srand(1);
+  UNITY_BEGIN();
+  RUN_TEST(test_evict_when_index_full);
+  RUN_TEST(test_evict_when_bytes_full);
+  RUN_TEST(test_lines_wrapping_around);
+  RUN_TEST(test_read_evicted_and_future);
+  RUN_TEST(test_benchmark);
+  return UNITY_END();
+}
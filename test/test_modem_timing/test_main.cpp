@@ -0,0 +1,168 @@
+/*
+  test_main.cpp - ModemTiming against the Semtech time on air formulas
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <unity.h>
+#include <initializer_list>
+#include <math.h>
+#include <stdio.h>
+#include "Radio/ModemTiming.h"
+
+// the float settings are truncated to whole us, up to 1 us per term
+#define TOLERANCE_US 2
+
+void setUp() {}
+void tearDown() {}
+
+// Semtech AN1200.13, SX1276 datasheet 4.1.1.7 and SX1268 datasheet 6.1.4
+// (SF5 and SF6), in us
+static double semtechLoRa(double bw, int sf, int cr, bool ldro, bool crc, bool implicitHeader, int preamble, int len)
+{
+  double symbol = pow(2, sf) / bw * 1000;
+  double bits = 8.0 * len - 4 * sf + 16 * crc - 20 * implicitHeader + (sf < 7 ? 20 : 28);
+  double payload = 8 + fmax(ceil(bits / (4.0 * (sf - 2 * ldro))) * cr, 0);
+  return (preamble + (sf < 7 ? 6.25 : 4.25) + payload) * symbol;
+}
+
+// preamble in bits, sync word in bytes, Manchester doubles the payload bits
+static double semtechFsk(double bitrate, int preamble, int syncWord, bool lengthByte, bool manchester, int len)
+{
+  return (preamble + 8 * syncWord + 8 * (lengthByte + len) * (manchester ? 2 : 1)) * 1000 / bitrate;
+}
+
+// Values worked out by hand with the formulas above, they match the Semtech
+// LoRa calculator
+static void test_reference_airtimes()
+{
+  struct {
+    float bw;
+    uint8_t sf, cr, ldro;
+    bool crc, implicitHeader;
+    uint16_t preamble;
+    uint8_t len;
+    uint32_t us;
+  } ref[] = {
+    {125, 7, 5, 0, true, false, 8, 10, 41216},
+    {125, 12, 5, 1, true, false, 8, 10, 991232},
+    {125, 12, 5, 1, true, false, 8, 51, 2465792},    // LDRO
+    {125, 12, 5, 0, true, false, 8, 51, 2138112},
+    {125, 11, 5, 2, true, false, 8, 20, 741376},     // 16.384 ms symbol, LDRO on
+    {250, 11, 5, 2, true, false, 8, 20, 329728},     // 8.192 ms, off
+    {500, 5, 5, 0, true, false, 8, 10, 3024},        // sx126x SF5
+    {125, 6, 5, 0, true, false, 8, 20, 31872},       // sx126x SF6
+    {125, 7, 5, 0, true, true, 8, 10, 36096},        // implicit header
+    {125, 9, 5, 0, false, true, 8, 0, 82944},
+    {125, 6, 8, 0, false, true, 8, 4, 15488},
+  };
+  for (auto& r : ref)
+  {
+    char msg[160];
+    snprintf(msg, sizeof(msg), "SF%u BW%g CR4/%u ldro %u crc %d ih %d len %u", r.sf, r.bw, r.cr, r.ldro, r.crc, r.implicitHeader, r.len);
+    ModemTiming t;
+    t.setLoRa(r.bw, r.sf, r.cr, r.ldro, r.crc, r.preamble, r.implicitHeader);
+    TEST_ASSERT_TRUE_MESSAGE(t.valid() && t.isLoRa(), msg);
+    TEST_ASSERT_UINT32_WITHIN_MESSAGE(TOLERANCE_US, r.us, t.airtime(r.len), msg);
+  }
+
+  ModemTiming fsk;
+  fsk.setFsk(9.6, 32, 4, 0, false);   // variable length
+  TEST_ASSERT_FALSE(fsk.isLoRa());
+  TEST_ASSERT_UINT32_WITHIN(TOLERANCE_US, 24167, fsk.airtime(20));
+  fsk.setFsk(4.8, 32, 4, 64, true);   // fixed length, Manchester
+  TEST_ASSERT_UINT32_WITHIN(TOLERANCE_US, 226667, fsk.airtime(64));
+}
+
+static void test_lora_sweep()
+{
+  const float bws[] = {7.8, 10.4, 15.6, 20.8, 31.25, 41.7, 62.5, 125, 250, 500};
+  for (float bw : bws)
+    for (int sf = 5; sf <= 12; sf++)
+      for (int cr = 5; cr <= 8; cr++)
+        for (int ldro = 0; ldro <= 2; ldro++)
+          for (int flags = 0; flags < 4; flags++)
+            for (int preamble : {6, 8, 12})
+            {
+              bool crc = flags & 1, implicitHeader = flags & 2;
+              ModemTiming t;
+              t.setLoRa(bw, sf, cr, ldro, crc, preamble, implicitHeader);
+              double symbol = pow(2, sf) / bw * 1000;
+              bool lowRate = ldro == 2 ? symbol > 16000 : ldro;
+              TEST_ASSERT_UINT32_WITHIN(1, (uint32_t)symbol, t.symbol());
+              for (int len = 0; len <= 255; len++)
+              {
+                double us = semtechLoRa(bw, sf, cr, lowRate, crc, implicitHeader, preamble, len);
+                if (fabs(t.airtime(len) - us) > TOLERANCE_US + 2e-7 * us)
+                {
+                  char msg[160];
+                  snprintf(msg, sizeof(msg), "BW%g SF%d CR4/%d ldro %d crc %d ih %d preamble %d len %d: %u us, expected %.1f",
+                           bw, sf, cr, ldro, crc, implicitHeader, preamble, len, t.airtime(len), us);
+                  TEST_FAIL_MESSAGE(msg);
+                }
+              }
+            }
+}
+
+static void test_fsk_sweep()
+{
+  for (float bitrate : {1.2f, 4.8f, 9.6f, 19.2f, 50.0f, 100.0f, 300.0f})
+    for (int manchester = 0; manchester <= 1; manchester++)
+      for (int syncWord : {0, 2, 4, 8})
+        for (int fixed : {0, 64, 255})
+        {
+          ModemTiming t;
+          t.setFsk(bitrate, 32, syncWord, fixed, manchester);
+          // a frame found 80 bits into the capture
+          TEST_ASSERT_UINT32_WITHIN(1, (uint32_t)(80 * 1000 / bitrate * (manchester ? 2 : 1)), t.bits(80));
+          for (int len = 1; len <= 255; len++)
+          {
+            if (fixed && len != fixed)
+              continue;
+            double us = semtechFsk(bitrate, 32, syncWord, !fixed, manchester, len);
+            if (fabs(t.airtime(len) - us) > TOLERANCE_US + 2e-7 * us)
+            {
+              char msg[160];
+              snprintf(msg, sizeof(msg), "FSK %g kbps manchester %d sync %d fixed %d len %d: %u us, expected %.1f",
+                       bitrate, manchester, syncWord, fixed, len, t.airtime(len), us);
+              TEST_FAIL_MESSAGE(msg);
+            }
+          }
+        }
+}
+
+static void test_invalid()
+{
+  ModemTiming t;
+  TEST_ASSERT_FALSE(t.valid());
+  t.setLoRa(0, 0, 5, 0, true, 8);
+  TEST_ASSERT_FALSE(t.valid());
+  t.setLoRa(125, 7, 4, 0, true, 8);   // cr is 5..8
+  TEST_ASSERT_FALSE(t.valid());
+  t.setFsk(0, 32, 4, 0, false);
+  TEST_ASSERT_FALSE(t.valid());
+  TEST_ASSERT_EQUAL(0, t.airtime(10));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_reference_airtimes);
+  RUN_TEST(test_lora_sweep);
+  RUN_TEST(test_fsk_sweep);
+  RUN_TEST(test_invalid);
+  return UNITY_END();
+}
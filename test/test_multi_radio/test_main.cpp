@@ -0,0 +1,281 @@
+/*
+  test_main.cpp - Two radio instances sharing the frame pool and the uplink
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <unity.h>
+#include <thread>
+#include <atomic>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "FramePool/FramePool.h"
+#include "Crc/Crc16.h"
+#include "../helpers/HdlcEncoder.h"
+#include "Radio/RxPath.h"
+#include "Satellites/Satellites.h"
+#include "Mqtt/RxBinary.h"
+
+static FramePool& pool = FramePool::getInstance();
+
+void setUp() { TEST_ASSERT_EQUAL(0, pool.inUse()); }
+void tearDown() {}
+
+// frames of a capture carry the radio, the packet number and their position
+#define FRAME_LEN 6
+
+static std::vector<uint8_t> capture(uint8_t radio, uint32_t seq)
+{
+  HdlcEncoder enc;
+  enc.flag(2);
+  for (uint8_t k = 0; k < 1 + seq % HDLC_PENDING_FRAMES; k++)
+  {
+    uint8_t f[FRAME_LEN] = {radio, 0, 0, 0, 0, k};
+    memcpy(f + 1, &seq, 4);
+    enc.frame(f, sizeof(f));
+  }
+  return enc.bytes();
+}
+
+// The parts of Radio that run per instance: interrupt flag, RX task and the
+// loop side of listen(), around the real RxPath
+class SimRadio {
+public:
+  explicit SimRadio(uint8_t index) : index(index) { instances[index] = this; }
+  ~SimRadio() { instances[index] = nullptr; }
+
+  // RadioLib takes plain functions, one interrupt handler per instance
+  template <uint8_t N>
+  static void setFlag() { instances[N]->received = true; }
+
+  // Radio::readPacket()
+  void readPacket(const std::vector<uint8_t>& data)
+  {
+    if (!received.exchange(false))
+      return;
+    RxPacket* pkt = rx.prepare();
+    if (!pkt)
+      return;
+    memcpy(rx.data(pkt), data.data(), data.size());
+    pkt->len = data.size();
+    rx.commit();
+  }
+
+  // Radio::listen(): a pending frame or the next packet, the frame is
+  // published through the rxb uplink with the radio index
+  bool listen()
+  {
+    HdlcDeframer& hdlc = rx.deframer();
+    if (hdlc.available())
+    {
+      publish(hdlc.frame(), hdlc.frameLen());
+      hdlc.pop();
+      return true;
+    }
+    RxPacket* pkt = rx.front();
+    if (!pkt)
+      return false;
+    {
+      RxFrame frame(rx.data(pkt), pkt->len);
+      RxPath::logHex(frame.data, frame.len);
+      if (rx.decode(frame, DECODER_AX25_NRZI, 0, 0, nullptr, 0) == RX_DECODE_HDLC)
+      {
+        publish(hdlc.frame(), hdlc.frameLen());
+        hdlc.pop();
+      }
+    }
+    rx.pop();
+    return true;
+  }
+
+  uint8_t index;
+  std::atomic<bool> received{false};
+  std::atomic<bool> loopBusy{false};  // the loop skips this radio, as if publishing took long
+  RxPath rx;
+  uint32_t sent = 0;  // frames in the packets the RX task queued
+  uint32_t published = 0;
+  uint64_t last = 0;  // packet << 8 | frame of the last one published
+  bool outOfOrder = false;
+
+private:
+  void publish(const uint8_t* frame, size_t len)
+  {
+    RxbHeader h = {};
+    h.radio = index;
+    uint8_t msg[sizeof(RxbHeader) + FRAME_LEN + 2];
+    size_t n = rxbEncode(h, frame, len, msg, sizeof(msg));
+    RxbHeader o;
+    const uint8_t* data;
+    TEST_ASSERT_TRUE(n && rxbDecode(msg, n, &o, &data));
+    TEST_ASSERT_EQUAL(index, o.radio);
+    TEST_ASSERT_EQUAL(FRAME_LEN + 2, o.dataLen);
+    TEST_ASSERT_EQUAL(index, data[0]);
+
+    uint32_t seq;
+    memcpy(&seq, data + 1, 4);
+    uint64_t id = (uint64_t)seq << 8 | data[5];
+    if (published && id <= last)
+      outOfOrder = true;
+    last = id;
+    published++;
+  }
+
+  static SimRadio* instances[MAX_RADIOS];
+};
+
+SimRadio* SimRadio::instances[MAX_RADIOS] = {};
+static void (*const irqHandlers[MAX_RADIOS])() = {SimRadio::setFlag<0>, SimRadio::setFlag<1>};
+
+// every radio holds as much as it can while the loop works on a packet:
+// the pool still has a slot for each of them
+static void test_worst_case_fits()
+{
+  uint32_t exhausted = pool.exhausted();
+  {
+    SimRadio r0(0), r1(1);
+    SimRadio* radios[MAX_RADIOS] = {&r0, &r1};
+    for (SimRadio* r : radios)
+    {
+      // a capture with more frames than fit, the deframer keeps its work slot
+      HdlcEncoder enc;
+      enc.flag(2);
+      for (int k = 0; k < HDLC_PENDING_FRAMES + 1; k++)
+      {
+        uint8_t f[FRAME_LEN] = {r->index, 0, 0, 0, 0, (uint8_t)k};
+        enc.frame(f, sizeof(f));
+      }
+      std::vector<uint8_t> b = enc.bytes();
+      r->rx.deframer().feed(b.data(), b.size());
+      TEST_ASSERT_EQUAL(1, r->rx.deframer().stats().dropped);
+
+      for (int i = 0; i < RX_QUEUE_SIZE; i++)
+      {
+        irqHandlers[r->index]();
+        r->readPacket(capture(r->index, i));
+      }
+      TEST_ASSERT_EQUAL(RX_QUEUE_SIZE, r->rx.queued());
+      TEST_ASSERT_EQUAL(0, r->rx.dropped());
+    }
+
+    PooledBuffer<uint8_t> work[RX_WORK_FRAMES];
+    for (auto& w : work)
+      TEST_ASSERT_TRUE(w.valid());
+    TEST_ASSERT_EQUAL(MAX_RADIOS * (RX_QUEUE_SIZE + HDLC_PENDING_FRAMES + 1) + RX_WORK_FRAMES, pool.inUse());
+    TEST_ASSERT_EQUAL(exhausted, pool.exhausted());
+
+    // a full queue drops in the RX task, before it takes a slot
+    irqHandlers[1]();
+    r1.readPacket(capture(1, RX_QUEUE_SIZE));
+    TEST_ASSERT_EQUAL(1, r1.rx.dropped());
+    TEST_ASSERT_EQUAL(exhausted, pool.exhausted());
+  }
+  TEST_ASSERT_EQUAL(0, pool.inUse());
+}
+
+// both RX tasks against the loop, overrunning it now and then: each radio
+// publishes its own frames in order and the pool never runs out
+static void test_two_radios_concurrent()
+{
+  const uint32_t packets = 20000;
+  uint32_t exhausted = pool.exhausted();
+  uint32_t frames[MAX_RADIOS] = {0};
+  {
+    SimRadio r0(0), r1(1);
+    SimRadio* radios[MAX_RADIOS] = {&r0, &r1};
+
+    std::atomic<int> running(MAX_RADIOS);
+    auto rxTask = [&](SimRadio* r) {
+      for (uint32_t i = 0; i < packets; i++)
+      {
+        // mostly keep pace with the loop, now and then it is busy for longer
+        // than a queue of packets and at least one is dropped
+        bool burst = i % 500 <= RX_QUEUE_SIZE;
+        r->loopBusy = burst;
+        if (!burst)
+          while (r->rx.queued() == RX_QUEUE_SIZE)
+            std::this_thread::yield();
+        std::vector<uint8_t> data = capture(r->index, i);
+        uint32_t dropped = r->rx.dropped();
+        irqHandlers[r->index]();
+        r->readPacket(data);
+        if (r->rx.dropped() == dropped)
+          r->sent += 1 + i % HDLC_PENDING_FRAMES;
+        if (i % 64 == 0)
+          std::this_thread::yield();
+      }
+      r->loopBusy = false;
+      running--;
+    };
+    std::thread t0(rxTask, &r0), t1(rxTask, &r1);
+
+    // the loop takes one step of every radio in turn, as tinyGS.ino does
+    for (;;)
+    {
+      bool any = false;
+      for (SimRadio* r : radios)
+        any |= !r->loopBusy && r->listen();
+      if (!any && !running)
+      {
+        bool pending = false;
+        for (SimRadio* r : radios)
+          pending |= r->rx.pending();
+        if (!pending)
+          break;
+      }
+      if (!any)
+        std::this_thread::yield();
+    }
+    t0.join();
+    t1.join();
+
+    // the ping reports the sum of the radios
+    HdlcStats total;
+    uint32_t rxDropped = 0;
+    for (SimRadio* r : radios)
+    {
+      char msg[160];
+      snprintf(msg, sizeof(msg), "radio %u: %u frames published, %u packets dropped", r->index, r->published, r->rx.dropped());
+      TEST_MESSAGE(msg);
+      TEST_ASSERT_FALSE(r->outOfOrder);
+      TEST_ASSERT_GREATER_OR_EQUAL(packets / 500, r->rx.dropped());
+      TEST_ASSERT_EQUAL(r->sent, r->published);
+      TEST_ASSERT_EQUAL(r->rx.deframer().stats().frames, r->published);
+      TEST_ASSERT_EQUAL(0, r->rx.deframer().stats().crcErrors);
+      TEST_ASSERT_EQUAL(0, r->rx.deframer().stats().dropped);
+      total.frames += r->rx.deframer().stats().frames;
+      total.dropped += r->rx.deframer().stats().dropped;
+      rxDropped += r->rx.dropped();
+      frames[r->index] = r->published;
+    }
+    TEST_ASSERT_EQUAL(frames[0] + frames[1], total.frames);
+    TEST_ASSERT_EQUAL(r0.rx.dropped() + r1.rx.dropped(), rxDropped);
+  }
+  TEST_ASSERT_EQUAL(0, pool.inUse());
+  TEST_ASSERT_EQUAL(exhausted, pool.exhausted());
+
+  char msg[64];
+  snprintf(msg, sizeof(msg), "high water mark %u of %u slots", pool.highWaterMark(), FRAME_POOL_SLOTS);
+  TEST_MESSAGE(msg);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_worst_case_fits);
+  RUN_TEST(test_two_radios_concurrent);
+  return UNITY_END();
+}
@@ -0,0 +1,225 @@
+/*
+  test_main.cpp - RxQueue host tests and burst stress test
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <unity.h>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <string.h>
+#include <stdio.h>
+#include "Radio/RxPath.h"
+
+struct Packet {
+  uint32_t seq;
+  uint8_t data[64];
+};
+
+void setUp() {}
+void tearDown() {}
+
+static void test_empty_and_full()
+{
+  RxQueue<Packet, RX_QUEUE_SIZE> q;
+  TEST_ASSERT_TRUE(q.empty());
+  TEST_ASSERT_NULL(q.front());
+
+  for (uint32_t i = 0; i < RX_QUEUE_SIZE; i++)
+  {
+    Packet *p = q.prepare();
+    TEST_ASSERT_NOT_NULL(p);
+    p->seq = i;
+    q.commit();
+  }
+  TEST_ASSERT_EQUAL(RX_QUEUE_SIZE, q.size());
+  TEST_ASSERT_NULL(q.prepare());
+
+  // a slot prepared but not committed is not visible
+  q.pop();
+  Packet *p = q.prepare();
+  TEST_ASSERT_NOT_NULL(p);
+  p->seq = 100;
+  TEST_ASSERT_EQUAL(RX_QUEUE_SIZE - 1, q.size());
+  q.commit();
+
+  for (uint32_t i = 1; i < RX_QUEUE_SIZE; i++)
+  {
+    TEST_ASSERT_EQUAL(i, q.front()->seq);
+    q.pop();
+  }
+  TEST_ASSERT_EQUAL(100, q.front()->seq);
+  q.pop();
+  TEST_ASSERT_TRUE(q.empty());
+}
+
+// the slots are reused in order for many times the queue size
+static void test_wraparound()
+{
+  RxQueue<Packet, RX_QUEUE_SIZE> q;
+  uint32_t next = 0, expected = 0;
+  for (int round = 0; round < 100000; round++)
+  {
+    int n = round % (RX_QUEUE_SIZE + 1);
+    for (int i = 0; i < n; i++)
+    {
+      Packet *p = q.prepare();
+      TEST_ASSERT_NOT_NULL(p);
+      p->seq = next++;
+      q.commit();
+    }
+    while (Packet *p = q.front())
+    {
+      TEST_ASSERT_EQUAL(expected++, p->seq);
+      q.pop();
+    }
+  }
+  TEST_ASSERT_EQUAL(next, expected);
+}
+
+// Burst rate the queue is rated for: BURST_LEN back to back packets every
+// BURST_GAP_US while the loop takes LOOP_SERVICE_US per packet. Override
+// with -D to check another rate, it must stay within the rating below.
+#ifndef BURST_LEN
+#define BURST_LEN        RX_QUEUE_SIZE
+#endif
+#ifndef BURST_GAP_US
+#define BURST_GAP_US     20000
+#endif
+#ifndef LOOP_SERVICE_US
+#define LOOP_SERVICE_US  200
+#endif
+#ifndef BURSTS
+#define BURSTS           200
+#endif
+
+static_assert(BURST_LEN <= RX_QUEUE_SIZE, "a burst longer than the queue always drops");
+static_assert(BURST_GAP_US > 2 * BURST_LEN * LOOP_SERVICE_US, "the loop needs time to drain a burst");
+
+struct BurstResult {
+  uint32_t sent = 0;
+  uint32_t received = 0;
+  uint32_t dropped = 0;
+  uint32_t corrupt = 0;
+  bool ordered = true;
+};
+
+static void busyWait(uint32_t us)
+{
+  auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(us);
+  while (std::chrono::steady_clock::now() < end)
+    ;
+}
+
+// The RX task pushes bursts of back to back packets, faster than the loop
+// takes them, and sleeps gapUs between bursts. Every packet is either
+// delivered once and in order or counted as dropped.
+static BurstResult runBursts(uint32_t bursts, uint32_t burstLen, uint32_t gapUs, uint32_t serviceUs)
+{
+  static RxQueue<Packet, RX_QUEUE_SIZE> q;
+  std::atomic<uint32_t> dropped(0);
+  BurstResult r;
+  r.sent = bursts * burstLen;
+
+  std::thread rxTask([&] {
+    uint32_t seq = 0;
+    for (uint32_t b = 0; b < bursts; b++)
+    {
+      for (uint32_t i = 0; i < burstLen; i++, seq++)
+      {
+        Packet *p = q.prepare();
+        if (!p)
+        {
+          dropped++;
+          continue;
+        }
+        p->seq = seq;
+        memset(p->data, (uint8_t)seq, sizeof(p->data));
+        q.commit();
+      }
+      std::this_thread::sleep_for(std::chrono::microseconds(gapUs));
+    }
+  });
+
+  uint32_t last = 0;
+  bool first = true;
+  auto drain = [&] {
+    while (Packet *p = q.front())
+    {
+      if (!first && p->seq <= last)
+        r.ordered = false;
+      for (size_t i = 0; i < sizeof(p->data); i++)
+        if (p->data[i] != (uint8_t)p->seq)
+          r.corrupt++;
+      first = false;
+      last = p->seq;
+      r.received++;
+      busyWait(serviceUs);  // processing and publishing the packet
+      q.pop();
+    }
+  };
+  while (r.received + dropped < r.sent)
+  {
+    drain();
+    std::this_thread::yield();
+  }
+  rxTask.join();
+  drain();
+  r.dropped = dropped;
+  TEST_ASSERT_TRUE(q.empty());
+  return r;
+}
+
+// at the rated burst rate nothing is lost
+static void test_burst_rated()
+{
+  BurstResult r = runBursts(BURSTS, BURST_LEN, BURST_GAP_US, LOOP_SERVICE_US);
+  char msg[160];
+  snprintf(msg, sizeof(msg), "%u bursts of %u packets every %u us, %u us per packet: %u received, %u dropped",
+           BURSTS, BURST_LEN, BURST_GAP_US, LOOP_SERVICE_US, r.received, r.dropped);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_TRUE(r.ordered);
+  TEST_ASSERT_EQUAL(0, r.corrupt);
+  TEST_ASSERT_EQUAL(0, r.dropped);
+  TEST_ASSERT_EQUAL(r.sent, r.received);
+}
+
+// bursts longer than the queue: the excess is dropped and counted, what gets
+// through is intact and in order
+static void test_burst_overload()
+{
+  const uint32_t burstLen = RX_QUEUE_SIZE + 4;
+  BurstResult r = runBursts(BURSTS, burstLen, BURST_GAP_US, LOOP_SERVICE_US);
+  char msg[96];
+  snprintf(msg, sizeof(msg), "%u packets, %u received, %u dropped", r.sent, r.received, r.dropped);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_TRUE(r.ordered);
+  TEST_ASSERT_EQUAL(0, r.corrupt);
+  TEST_ASSERT_EQUAL(r.sent, r.received + r.dropped);
+  TEST_ASSERT_GREATER_OR_EQUAL(BURSTS * RX_QUEUE_SIZE, r.received);
+  TEST_ASSERT_GREATER_THAN(0, r.dropped);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_empty_and_full);
+  RUN_TEST(test_wraparound);
+  RUN_TEST(test_burst_rated);
+  RUN_TEST(test_burst_overload);
+  return UNITY_END();
+}
@@ -0,0 +1,254 @@
+/*
+  test_main.cpp - Binary RX uplink encoder/decoder tests and benchmark
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <unity.h>
+#include <chrono>
+#include <initializer_list>
+#include <string>
+#include <stdio.h>
+#include <stdlib.h>
+#include <ArduinoJson.h>
+#include "Mqtt/RxBinary.h"
+
+void setUp() {}
+void tearDown() {}
+
+static RxbHeader sample(bool lora)
+{
+  RxbHeader h;
+  memset(&h, 0, sizeof(h));
+  h.flags = lora ? RXB_LORA | RXB_FEC : RXB_CRC_ERROR;
+  h.sf = 10;
+  h.norad = 51658;
+  h.usecTime = 1700000000123456ll;
+  h.timeOffset = -0.25f;
+  h.frequency = 436.703f;
+  h.freqOffset = 1200.0f;
+  h.bw = 125.0f;
+  h.bitrate = 9.6f;
+  h.freqDev = 5.0f;
+  h.rssi = -118.5f;
+  h.snr = -7.25f;
+  h.frequencyError = -3141.0f;
+  h.latitude = 40.4f;
+  h.longitude = -3.7f;
+  h.fecCorrected = 5;
+  h.cr = 5;
+  h.radio = 1;
+  h.fecBitErrors = 17;
+  h.usecError = 250;
+  return h;
+}
+
+static void assertSameFields(const RxbHeader& a, const RxbHeader& b)
+{
+  TEST_ASSERT_EQUAL(a.flags, b.flags);
+  TEST_ASSERT_EQUAL(a.sf, b.sf);
+  TEST_ASSERT_EQUAL(a.norad, b.norad);
+  TEST_ASSERT_TRUE(a.usecTime == b.usecTime);
+  TEST_ASSERT_EQUAL_FLOAT(a.frequency, b.frequency);
+  TEST_ASSERT_EQUAL_FLOAT(a.rssi, b.rssi);
+  TEST_ASSERT_EQUAL_FLOAT(a.snr, b.snr);
+  TEST_ASSERT_EQUAL_FLOAT(a.longitude, b.longitude);
+  TEST_ASSERT_EQUAL(a.fecCorrected, b.fecCorrected);
+  TEST_ASSERT_EQUAL(a.cr, b.cr);
+  TEST_ASSERT_EQUAL(a.fecBitErrors, b.fecBitErrors);
+}
+
+static void test_round_trip()
+{
+  uint8_t frame[300], msg[400];
+  for (size_t i = 0; i < sizeof(frame); i++)
+    frame[i] = rand();
+  RxbHeader in = sample(true);
+
+  size_t len = rxbEncode(in, frame, sizeof(frame), msg, sizeof(msg));
+  TEST_ASSERT_EQUAL(74 + sizeof(frame), len);
+  TEST_ASSERT_EQUAL(RXB_VERSION, msg[0]);
+  TEST_ASSERT_EQUAL(74, msg[2]);
+
+  RxbHeader out;
+  const uint8_t* data;
+  TEST_ASSERT_TRUE(rxbDecode(msg, len, &out, &data));
+  TEST_ASSERT_EQUAL(RXB_VERSION, out.version);
+  TEST_ASSERT_EQUAL(sizeof(frame), out.dataLen);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(frame, data, sizeof(frame));
+  assertSameFields(in, out);
+  TEST_ASSERT_EQUAL(in.radio, out.radio);
+  TEST_ASSERT_EQUAL(in.usecError, out.usecError);
+  TEST_ASSERT_EQUAL(sizeof(RxbHeader), rxbHeaderSize(RXB_VERSION));
+}
+
+static void test_encode_rejects()
+{
+  uint8_t frame[16] = {0}, msg[128];
+  RxbHeader h = sample(false);
+  TEST_ASSERT_EQUAL(0, rxbEncode(h, frame, sizeof(frame), msg, sizeof(msg), 0));
+  TEST_ASSERT_EQUAL(0, rxbEncode(h, frame, sizeof(frame), msg, sizeof(msg), RXB_VERSION + 1));
+  TEST_ASSERT_EQUAL(0, rxbEncode(h, frame, sizeof(frame), msg, sizeof(RxbHeader) + sizeof(frame) - 1));
+  TEST_ASSERT_EQUAL(sizeof(RxbHeader) + sizeof(frame), rxbEncode(h, frame, sizeof(frame), msg, sizeof(RxbHeader) + sizeof(frame)));
+  TEST_ASSERT_FALSE(rxbSetLength(h, 0x10000));
+  TEST_ASSERT_TRUE(rxbSetLength(h, 0xFFFF));
+}
+
+static void test_decode_rejects_malformed()
+{
+  uint8_t frame[32] = {1, 2, 3}, msg[128];
+  size_t len = rxbEncode(sample(true), frame, sizeof(frame), msg, sizeof(msg));
+  RxbHeader h;
+  const uint8_t* data;
+
+  TEST_ASSERT_FALSE(rxbDecode(msg, sizeof(RxbHeader) - 1, &h, &data));   // short
+  TEST_ASSERT_FALSE(rxbDecode(msg, len - 1, &h, &data));                 // truncated frame
+  msg[0] = 0;
+  TEST_ASSERT_FALSE(rxbDecode(msg, len, &h, &data));                     // no version
+  msg[0] = RXB_VERSION;
+  msg[2] = sizeof(RxbHeader) - 1;
+  TEST_ASSERT_FALSE(rxbDecode(msg, len, &h, &data));                     // header too short
+  msg[2] = 0xFF;
+  TEST_ASSERT_FALSE(rxbDecode(msg, len, &h, &data));                     // header past the end
+}
+
+// a later version appends fields, an older decoder skips them
+static void test_decode_skips_appended_fields()
+{
+  uint8_t frame[10] = {9, 8, 7, 6, 5, 4, 3, 2, 1, 0}, msg[128];
+  RxbHeader in = sample(false);
+  size_t len = rxbEncode(in, frame, sizeof(frame), msg, sizeof(msg));
+  const size_t extra = 6;
+  memmove(msg + sizeof(RxbHeader) + extra, msg + sizeof(RxbHeader), sizeof(frame));
+  memset(msg + sizeof(RxbHeader), 0xEE, extra);
+  msg[0] = RXB_VERSION + 1;
+  msg[2] = sizeof(RxbHeader) + extra;
+
+  RxbHeader out;
+  const uint8_t* data;
+  TEST_ASSERT_TRUE(rxbDecode(msg, len + extra, &out, &data));
+  assertSameFields(in, out);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(frame, data, sizeof(frame));
+}
+
+static std::string base64(const uint8_t* data, size_t len)
+{
+  static const char tab[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string s;
+  for (size_t i = 0; i < len; i += 3)
+  {
+    uint32_t v = data[i] << 16 | (i + 1 < len ? data[i + 1] << 8 : 0) | (i + 2 < len ? data[i + 2] : 0);
+    s += tab[v >> 18 & 63];
+    s += tab[v >> 12 & 63];
+    s += i + 1 < len ? tab[v >> 6 & 63] : '=';
+    s += i + 2 < len ? tab[v & 63] : '=';
+  }
+  return s;
+}
+
+// tele/rx document built like MQTT_Client::publishRx
+static size_t encodeJson(const RxbHeader& hdr, const uint8_t* frame, size_t len, char* out, size_t outSize)
+{
+  std::string packet = base64(frame, len);
+  const size_t capacity = JSON_ARRAY_SIZE(2) + JSON_OBJECT_SIZE(26) + 25;
+  DynamicJsonDocument doc(capacity);
+  JsonArray station_location = doc.createNestedArray("station_location");
+  station_location.add(hdr.latitude);
+  station_location.add(hdr.longitude);
+  doc["mode"] = (hdr.flags & RXB_LORA) ? "LoRa" : "FSK";
+  doc["frequency"] = hdr.frequency;
+  doc["frequency_offset"] = hdr.freqOffset;
+  doc["satellite"] = "INS-2TD";
+  if (hdr.flags & RXB_LORA)
+  {
+    doc["sf"] = hdr.sf;
+    doc["cr"] = hdr.cr;
+    doc["bw"] = hdr.bw;
+  }
+  else
+  {
+    doc["bitrate"] = hdr.bitrate;
+    doc["freqdev"] = hdr.freqDev;
+    doc["rxBw"] = hdr.bw;
+  }
+  doc["rssi"] = hdr.rssi;
+  doc["snr"] = hdr.snr;
+  doc["frequency_error"] = hdr.frequencyError;
+  doc["unix_GS_time"] = (long long)(hdr.usecTime / 1000000ll);
+  doc["usec_time"] = hdr.usecTime;
+  doc["usec_err"] = hdr.usecError;
+  doc["time_offset"] = hdr.timeOffset;
+  doc["crc_error"] = (bool)(hdr.flags & RXB_CRC_ERROR);
+  doc["data"] = packet.c_str();
+  doc["NORAD"] = hdr.norad;
+  doc["noisy"] = (bool)(hdr.flags & RXB_NOISY);
+  if (hdr.flags & RXB_FEC)
+  {
+    doc["fec_corrected"] = hdr.fecCorrected;
+    doc["fec_bit_errors"] = hdr.fecBitErrors;
+  }
+  if (hdr.radio)
+    doc["radio"] = hdr.radio;
+  return serializeJson(doc, out, outSize);
+}
+
+static volatile size_t sink;
+
+static void test_benchmark_against_json()
+{
+  static uint8_t msg[2048];
+  static char json[4096];
+  uint8_t frame[255];
+  for (size_t i = 0; i < sizeof(frame); i++)
+    frame[i] = rand();
+  RxbHeader hdr = sample(true);
+  char text[160];
+
+  for (size_t len : {16, 64, 255})
+  {
+    size_t binSize = rxbEncode(hdr, frame, len, msg, sizeof(msg));
+    size_t jsonSize = encodeJson(hdr, frame, len, json, sizeof(json));
+    TEST_ASSERT_GREATER_THAN(0, jsonSize);
+    TEST_ASSERT_LESS_THAN(jsonSize, binSize);
+
+    const int calls = 20000;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < calls; i++)
+      sink += rxbEncode(hdr, frame, len, msg, sizeof(msg));
+    auto t1 = std::chrono::steady_clock::now();
+    for (int i = 0; i < calls; i++)
+      sink += encodeJson(hdr, frame, len, json, sizeof(json));
+    auto t2 = std::chrono::steady_clock::now();
+    double binNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / calls;
+    double jsonNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / calls;
+
+    snprintf(text, sizeof(text), "%3u byte frame: rxb %3u bytes %6.0f ns, JSON %4u bytes %6.0f ns",
+             (unsigned)len, (unsigned)binSize, binNs, (unsigned)jsonSize, jsonNs);
+    TEST_MESSAGE(text);
+  }
+}
+
+int main()
+{
+  srand(1);
+  UNITY_BEGIN();
+  RUN_TEST(test_round_trip);
+  RUN_TEST(test_encode_rejects);
+  RUN_TEST(test_decode_rejects_malformed);
+  RUN_TEST(test_decode_skips_appended_fields);
+  RUN_TEST(test_benchmark_against_json);
+  return UNITY_END();
+}
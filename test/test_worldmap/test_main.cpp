@@ -0,0 +1,208 @@
+/*
+  test_main.cpp - Dashboard world map tests and benchmark
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <unity.h>
+#include <chrono>
+#include <set>
+#include <tuple>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <Arduino.h>
+#include <WebServer.h>
+// Arduino binary.h constants used by graphics.h
+#define B00000000 0x00
+#define B00011000 0x18
+#define B00100100 0x24
+#define B01000010 0x42
+#include "Display/graphics.h"
+#include "ConfigManager/worldmap.h"
+#include "ConfigManager/HtmlWriter.h"
+
+void setUp() {}
+void tearDown() {}
+
+typedef std::set<std::tuple<int, int, int>> Rects;  // x, y, width
+
+// heap use of the HeapString below
+static size_t heapNow, heapPeak, reallocs;
+
+// Arduino-ESP32 WString growth: every concat reallocates to exactly the new length
+struct HeapString {
+  char* buf = nullptr;
+  size_t cap = 0, len = 0;
+  HeapString() {}
+  HeapString(const char* s) { concat(s, strlen(s)); }
+  HeapString(const HeapString& o) { *this += o; }
+  HeapString(unsigned v) { char t[16]; snprintf(t, sizeof(t), "%u", v); concat(t, strlen(t)); }
+  HeapString(float v) { char t[33]; snprintf(t, sizeof(t), "%.2f", v); concat(t, strlen(t)); }
+  ~HeapString()
+  {
+    if (buf)
+    {
+      heapNow -= cap + 1;
+      free(buf);
+    }
+  }
+  void concat(const char* s, size_t n)
+  {
+    if (len + n > cap)
+    {
+      heapNow += len + n - cap + (buf ? 0 : 1);
+      if (heapNow > heapPeak)
+        heapPeak = heapNow;
+      reallocs++;
+      buf = (char*)realloc(buf, len + n + 1);
+      cap = len + n;
+    }
+    memcpy(buf + len, s, n);
+    len += n;
+    buf[len] = 0;
+  }
+  HeapString& operator+=(const HeapString& o)
+  {
+    if (o.len)
+      concat(o.buf, o.len);
+    return *this;
+  }
+  HeapString& operator+=(const char* s) { concat(s, strlen(s)); return *this; }
+  friend HeapString operator+(const HeapString& a, const HeapString& b) { HeapString r(a); r += b; return r; }
+  friend HeapString operator+(const char* a, const HeapString& b) { HeapString r(a); r += b; return r; }
+  friend HeapString operator+(const HeapString& a, const char* b) { HeapString r(a); r += b; return r; }
+};
+
+static float satPos[2] = {10, 20};
+
+// handleDashboard before the map was prebuilt, one <rect> per run of land pixels
+static size_t oldMap(Rects* rects)
+{
+  unsigned ix = 0;
+  unsigned sx = 0;
+  HeapString svg = "<div style=""margin-left:35px""><svg width""100%"" height=""auto"" viewBox=""0 0 262 134"" xmlns=""http://www.w3.org/2000/svg"">";
+  svg += "<rect x=""1"" y=""1"" width=""262"" height=""134"" stroke=""gray"" fill=""none"" stroke-width=""2"" />";
+  for (unsigned y = 0; y < earth_height; y++)
+  {
+    unsigned n = 0;
+    for (unsigned x = 0; x < earth_width / 8; x++)
+    {
+      for (unsigned i = 0; i < 8; i++)
+      {
+        if ((earth_bits[ix] >> i) & 1)
+        {
+          if (n == 0)
+            sx = (x * 8) + i;
+          n++;
+        }
+        if (!((earth_bits[ix] >> i) & 1) || ((x == earth_width / 8 - 1) && (i == 7)))
+        {
+          if (n > 0)
+          {
+            svg += "<rect x="""+ HeapString(sx * 2 + 3) + """ y=""" + HeapString(y * 2 + 3) + """ width=""" + HeapString(n * 2) + """ height=""2"" />";
+            if (rects)
+              rects->insert(std::make_tuple((int)(sx * 2 + 3), (int)(y * 2 + 3), (int)(n * 2)));
+            n = 0;
+          }
+        }
+      }
+      ix++;
+    }
+  }
+  svg += "<circle id=""wmsatpos"" cx=""" + HeapString(satPos[0] * 2 + 3) + """ cy=""" + HeapString(satPos[1] * 2 + 3) + """ stroke=""red"" fill=""none"" stroke-width=""2"">";
+  svg += "  <animate attributeName=""r"" values=""2;4;6"" dur=""0.75s"" repeatCount=""indefinite"" />";
+  svg += "</circle>";
+  svg += "</svg></div>";
+  return svg.len;
+}
+
+// ConfigManager::handleWorldmap
+static size_t newMap(WebServer& server)
+{
+  const size_t size = sizeof(WORLDMAP_SVG) - 1;
+  server.setContentLength(size);
+  server.send(200, "image/svg+xml", "");
+  HtmlWriter::sendP(server, WORLDMAP_SVG, size);
+  return server.body.size();
+}
+
+// the blob goes out whole, in pieces no larger than the writer buffer
+static void test_sent_in_chunks()
+{
+  WebServer server;
+  newMap(server);
+  TEST_ASSERT_EQUAL(sizeof(WORLDMAP_SVG) - 1, server.contentLength);
+  TEST_ASSERT_TRUE(server.body == WORLDMAP_SVG);
+  TEST_ASSERT_EQUAL((sizeof(WORLDMAP_SVG) - 1 + HTML_WRITER_BUFFER_SIZE - 1) / HTML_WRITER_BUFFER_SIZE, server.chunks.size());
+  for (size_t i = 0; i + 1 < server.chunks.size(); i++)
+    TEST_ASSERT_EQUAL(HTML_WRITER_BUFFER_SIZE, server.chunks[i]);
+}
+
+// the generated path draws the same land runs the old loop did
+static void test_blob_matches_earth_bits()
+{
+  Rects before, after;
+  oldMap(&before);
+  const char* p = strstr(WORLDMAP_SVG, "d='");
+  TEST_ASSERT_NOT_NULL(p);
+  p += 3;
+  int x, y, w, back, n;
+  while (sscanf(p, "M%d %dh%dv2h-%dz%n", &x, &y, &w, &back, &n) == 4)
+  {
+    TEST_ASSERT_EQUAL(w, back);
+    after.insert(std::make_tuple(x, y, w));
+    p += n;
+  }
+  TEST_ASSERT_EQUAL_STRING_LEN("'/>", p, 3);
+  TEST_ASSERT_GREATER_THAN(100, before.size());
+  TEST_ASSERT_TRUE(before == after);
+}
+
+static void test_benchmark()
+{
+  const int requests = 2000;
+  size_t oldLen = 0, newLen = 0;
+  WebServer server;
+  heapNow = heapPeak = reallocs = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < requests; i++)
+    oldLen = oldMap(nullptr);
+  auto t1 = std::chrono::steady_clock::now();
+  for (int i = 0; i < requests; i++)
+    newLen = newMap(server);
+  auto t2 = std::chrono::steady_clock::now();
+  TEST_ASSERT_EQUAL(0, heapNow);
+
+  char msg[160];
+  snprintf(msg, sizeof(msg), "String build: %u bytes, %.1f us per request, peak heap %u bytes, %u reallocations",
+           (unsigned)oldLen, std::chrono::duration<double, std::micro>(t1 - t0).count() / requests,
+           (unsigned)heapPeak, (unsigned)(reallocs / requests));
+  TEST_MESSAGE(msg);
+  snprintf(msg, sizeof(msg), "prebuilt blob: %u bytes, %.2f us per request, no heap in the firmware",
+           (unsigned)newLen, std::chrono::duration<double, std::micro>(t2 - t1).count() / requests);
+  TEST_MESSAGE(msg);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_blob_matches_earth_bits);
+  RUN_TEST(test_sent_in_chunks);
+  RUN_TEST(test_benchmark);
+  return UNITY_END();
+}
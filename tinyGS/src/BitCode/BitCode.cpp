@@ -121,7 +121,10 @@
 */
 //////////////////////////////////////////////////////////////////////*/
 #include <stdio.h>
+#include <string.h>
 #include "BitCode.h"
+#include "../FramePool/FramePool.h"
+#include "../Crc/Crc16.h"
 #include <stdint.h> //uint8_t
 
 //////////////////////////////////////////////////////////////////////
@@ -200,10 +203,10 @@ void BitCode::xor_bit_on_byte(unsigned char *byte, int k, int dato){
   if (dato==1){*byte = *byte ^ byte_aux;}
 }
 
-size_t BitCode::stringSize(char *cadena){
+size_t BitCode::stringSize(const char *cadena){
     //Measure the size of data string.
-    int size=0;
-    while (cadena[size]!=0 && size<255){
+    size_t size=0;
+    while (cadena[size]!=0){
       size++;
     }
     return size;
@@ -491,102 +494,197 @@ void BitCode::shift_one_bit_on_CRC_to_left(unsigned char *crc){
 }
 
 int BitCode::crc_check(char *ax25inv){
-  //printf("\n");
-  int largo=0;
-  unsigned char crcmsb=0;
-  unsigned char byte_recibido=0;
-  unsigned char crc_recibido[2]={0,0};
-  unsigned char crc[2]={0,0};
-  unsigned char bit=0;
-  unsigned char feedback=0;
-  unsigned char compmsb=0;
-  unsigned char complsb=0;
-  //printf("Datos en la variable CRC antes de entrar en crc_ones...:%2X%2X\n",crc[1],crc[0]);
-  crc_ones(crc);
-  //printf("Datos en la variable CRC despues de salir de crc_ones...:%2X%2X\n",crc[1],crc[0]);
-  //for (int i=1;i<=16;i++){
-  //  printf("\n");
-  //  set_bit_on_CRC(crc,i,0);}
-  //for (int i=1;i<=16;i++){
-  //  printf("\n");
-  //  set_bit_on_CRC(crc,i,1);}
-  //for (int i=1;i<=16;i++){
-  //  printf("\n");
-  //  shift_one_bit_on_CRC_to_left(crc);
-  //}
-    
-  largo=stringSize(ax25inv);
-  //printf("Cadena de datos AX.25 Bytes Invertidos:");
-  for (int i=0;i<largo-4;i+=2){
-  //for (int i=0;i<2;i+=2){
-    //printf("%c%c ",ax25inv[i],ax25inv[i+1]);
-    byte_recibido=compone_byte_en_hexadecimal(ax25inv[i],ax25inv[i+1]);
-    for (int k=8;k>=1;k--){
-      //printf("Byte a procesar:%X\n",byte_recibido);
-      //printf("\n");
-      bit=read_bit_from_byte(byte_recibido,k);
-      crcmsb=read_bit_from_byte(crc[1],8);
-      feedback=bit ^ crcmsb;
-      //printf("Bit:%X crcmsb:%X feedback:%X\n",bit,crcmsb,feedback);
-      //printf("CRC Calculado....:%2X%2X\n",crc[1],crc[0]);
-      shift_one_bit_on_CRC_to_left(crc);
-      set_bit_on_CRC(crc,1,feedback);
-      xor_bit_on_CRC(crc,6,feedback);
-      xor_bit_on_CRC(crc,13,feedback);
-      //printf("CRC Calculado....:%2X%2X\n",crc[1],crc[0]);
-    }
+  //The bit helpers above are kept for reference, the FCS is now computed with
+  //the CRC-16/X.25 table over the frame bytes in their normal bit order.
+  size_t largo=stringSize(ax25inv)/2;
+  uint8_t byte_recibido=0;
+  uint16_t crc=Crc16X25::begin();
+  if (largo<3){return 1;}
+  for (size_t i=0;i<largo-2;i++){
+    byte_recibido=reverse_byte(compone_byte_en_hexadecimal(ax25inv[2*i],ax25inv[2*i+1]));
+    crc=Crc16X25::update(crc,&byte_recibido,1);
   }
-  //Se complementa a 1 el crc
-  crc[1]=crc[1]^(0xFF);
-  crc[0]=crc[0]^(0XFF);
-  crc_recibido[1]=compone_byte_en_hexadecimal(ax25inv[largo-4],ax25inv[largo-3]);
-  crc_recibido[0]=compone_byte_en_hexadecimal(ax25inv[largo-2],ax25inv[largo-1]);
-  //printf("\n");
-  //printf("CRC Recibido.....:%2X%2X\n",crc_recibido[1],crc_recibido[0]);
-  //printf("\n");
-  //printf("CRC Calculado....:%2X%2X\n",crc[1],crc[0]);
-  compmsb=crc[1] ^ crc_recibido[1];
-  complsb=crc[0] ^ crc_recibido[0];
-  //printf("Comparacion......:%2X%2X\n",compmsb,complsb);
-  
-  //Si la comparacion (xor) de ambos bytes es cero es que ambos bytes son iguales
-  if (compmsb==0 && complsb==0){
+  crc=Crc16X25::end(crc);
+  if (reverse_byte(compone_byte_en_hexadecimal(ax25inv[2*largo-4],ax25inv[2*largo-3]))==(uint8_t)crc &&
+      reverse_byte(compone_byte_en_hexadecimal(ax25inv[2*largo-2],ax25inv[2*largo-1]))==(uint8_t)(crc>>8)){
     return 0;}else{return 1;}
 }
 
 void BitCode::nrz2ax25(char *entrada, size_t buffSize, char *ax25, uint8_t *ax25bin,size_t *sizeAx25bin){
-         /////////////////
-        char *ax25hdlc;
-        char *ax25inv;
-        uint8_t *ax25hdlcbin;
-        uint8_t *ax25invbin;
-        size_t sizeAx25inv=0;
-        size_t sizeAx25invbin=0;
-        int bitstuff=0;
-       /////////////////
-        ax25hdlcbin = new uint8_t[buffSize];
-        ax25hdlc=new char[buffSize];
-        ax25inv=new char[buffSize];
-        ax25hdlcbin=new uint8_t[buffSize];
-        ax25invbin=new uint8_t[buffSize];
-       /////////////////
-        BitCode::nrz2nrzi(entrada,buffSize,ax25hdlc,ax25hdlcbin);
-        bitstuff=BitCode::remove_bit_stuffing(ax25hdlc,buffSize,ax25inv,&sizeAx25inv,ax25invbin,&sizeAx25invbin);
-        if (bitstuff==0){
-          BitCode::invierte_bytes_de_un_array(ax25inv,sizeAx25inv,ax25,ax25bin,sizeAx25bin);		  
-          if (crc_check(ax25inv)!=0){
-              sprintf(ax25,"CRC error!");
-              *sizeAx25bin=10;
-              for (int i=0;i<*sizeAx25bin;i++){
-                ax25bin[i]=(char)ax25[i];
-              }
-            }
+        //The hex string is turned into bytes and handed over to the binary deframer.
+        //The first byte is the synch word byte skipped by the deframer.
+        PooledBuffer<uint8_t> nrz;
+        AX25Result result=AX25_FRAME_ERROR;
+        size_t nrzLen=stringSize(entrada);
+        if (nrzLen > buffSize){nrzLen=buffSize;}
+        nrzLen/=2;
+        *sizeAx25bin=0;
+        if (nrz.valid() && nrzLen <= PooledBuffer<uint8_t>::capacity()){
+          for (size_t i=0;i<nrzLen;i++){
+            nrz.get()[i]=compone_byte_en_hexadecimal(entrada[2*i],entrada[2*i+1]);
+          }
+          result=deframeAX25(NULL,0,nrz.get(),nrzLen,ax25bin,PooledBuffer<uint8_t>::capacity(),sizeAx25bin);
+        }
+        if (result==AX25_OK){
+          for (size_t i=0;i<*sizeAx25bin;i++){
+            sprintf(ax25+2*i,"%02X",ax25bin[i]);
+          }
+          ax25[2*(*sizeAx25bin)]=0;
         }else{
-            sprintf(ax25,"Frame error!");
-            *sizeAx25bin=12;
-            for (int i=0;i<*sizeAx25bin;i++){
-              ax25bin[i]=(char)ax25[i];
-            }
+          sprintf(ax25,result==AX25_CRC_ERROR ? "CRC error!" : "Frame error!");
+          *sizeAx25bin=strlen(ax25);
+          for (int i=0;i<*sizeAx25bin;i++){
+            ax25bin[i]=(char)ax25[i];
+          }
         }
+}
+
+//////////////////////////////////////////////////////////////////////
+//                     BINARY AX.25 DEFRAMER
+//////////////////////////////////////////////////////////////////////
+// Same process as the hex string functions above but working on bytes:
+//
+//  - NRZ -> NRZI is done eight bits at a time: a bit is ONE when it
+//    equals the previous one, so out = ~(byte ^ (byte >> 1 | prev << 7)).
+//  - Bit unstuffing only goes bit by bit when the byte (plus the ones
+//    carried from the previous byte) contains five ONEs in a row, the
+//    rest of the bytes are appended whole.
+//  - AX.25 sends every byte LSB first, so the bits are accumulated
+//    already reversed and there is no separate inversion pass.
+//  - The FCS is checked with Crc16X25 over the final bytes (sent low
+//    byte first), which is the same check crc_check does.
+//////////////////////////////////////////////////////////////////////
+uint8_t BitCode::reverse_byte(uint8_t b){
+  b=(b&0xF0)>>4 | (b&0x0F)<<4;
+  b=(b&0xCC)>>2 | (b&0x33)<<2;
+  b=(b&0xAA)>>1 | (b&0x55)<<1;
+  return b;
+}
+
+namespace {
+struct Deframer {
+  uint8_t *out;
+  size_t maxLen;
+  size_t len;
+  uint16_t acc;     // output bits, LSB first
+  uint8_t nbits;    // bits in acc
+  uint8_t ones;     // ONEs in a row seen on the line
+  uint8_t prev;     // last NRZ bit, for NRZI
+  bool skipFirst;   // first byte is the flag included in the synch word
+  bool done;
+  BitCode::AX25Result result;
+
+  void push(uint8_t bits, uint8_t n){
+    acc|=(uint16_t)bits<<nbits;
+    nbits+=n;
+    if (nbits>=8){
+      if (len>=maxLen){done=true;result=BitCode::AX25_FRAME_ERROR;return;}
+      out[len++]=(uint8_t)acc;
+      acc>>=8;
+      nbits-=8;
+    }
+  }
+
+  void bit(uint8_t b){
+    if (b){
+      ones++;
+      if (ones<=5){push(1,1);}
+      else if (ones==7){done=true;result=BitCode::AX25_FRAME_ERROR;} //abort sequence
+    }else{
+      if (ones==6){
+        //end flag, it has to start on a byte boundary: the 0 and five 1s already stored
+        done=true;
+        result=(nbits==6) ? BitCode::AX25_OK : BitCode::AX25_FRAME_ERROR;
+      }else if (ones!=5){
+        push(0,1);
+      }//else: stuffed bit, dropped
+      ones=0;
+    }
+  }
+
+  void feed(uint8_t nrz){
+    uint8_t nrzi=~(nrz ^ ((nrz>>1) | (prev<<7)));
+    prev=nrz&1;
+    if (skipFirst){skipFirst=false;return;}
+    if (ones<5){
+      //five ONEs in a row anywhere in the ONEs carried plus this byte?
+      uint16_t w=(uint16_t)(((1u<<ones)-1)<<8) | nrzi;
+      if ((w & (w>>1) & (w>>2) & (w>>3) & (w>>4))==0){
+        push(BitCode::reverse_byte(nrzi),8);
+        ones=__builtin_ctz(~(uint32_t)nrzi);
+        return;
+      }
+    }
+    for (int k=7;k>=0 && !done;k--){
+      bit((nrzi>>k)&1);
+    }
+  }
+};
+}
+
+BitCode::AX25Result BitCode::deframeAX25(const uint8_t *sync, size_t syncLen, const uint8_t *nrz, size_t nrzLen, uint8_t *ax25, size_t maxLen, size_t *ax25Len){
+  Deframer d;
+  d.out=ax25;
+  d.maxLen=maxLen;
+  d.len=0;
+  d.acc=0;
+  d.nbits=0;
+  d.ones=0;
+  d.prev=0;
+  d.skipFirst=true;
+  d.done=false;
+  d.result=AX25_FRAME_ERROR;
+  for (size_t i=0;i<syncLen && !d.done;i++){d.feed(sync[i]);}
+  for (size_t i=0;i<nrzLen && !d.done;i++){d.feed(nrz[i]);}
+  *ax25Len=d.len;
+  if (!d.done || d.result!=AX25_OK){
+    return AX25_FRAME_ERROR;
+  }
+  if (d.len<3){
+    return AX25_CRC_ERROR;
+  }
+  uint16_t crc=Crc16X25::compute(ax25,d.len-2);
+  if (ax25[d.len-2]!=(uint8_t)crc || ax25[d.len-1]!=(uint8_t)(crc>>8)){
+    return AX25_CRC_ERROR;
+  }
+  return AX25_OK;
+}
 
+//////////////////////////////////////////////////////////////////////
+//                     G3RUH
+//////////////////////////////////////////////////////////////////////
+// Every bit is XORed with the bits received 12 and 17 bits before it.
+// Putting the previous bits above the current byte in a word, the taps
+// of the eight bits are just that word shifted by 12 and by 17, so a
+// whole byte takes two shifts and two XORs and needs no table.
+//////////////////////////////////////////////////////////////////////
+void BitCode::g3ruhDescramble(const uint8_t *in, uint8_t *out, size_t len, uint32_t *state){
+  uint32_t x=*state;
+  for (size_t i=0;i<len;i++){
+    x=(x<<8) | in[i];
+    out[i]=(uint8_t)(x ^ (x>>12) ^ (x>>17));
+  }
+  *state=x;
+}
+
+//////////////////////////////////////////////////////////////////////
+//                     MANCHESTER
+//////////////////////////////////////////////////////////////////////
+// Every data bit is the second bit of its pair, so the eight data bits
+// of a 16 bit word are its even bits squeezed together.
+//////////////////////////////////////////////////////////////////////
+size_t BitCode::manchesterDecode(const uint8_t *in, size_t len, uint8_t *out, size_t *errors){
+  size_t n=len/2;
+  *errors=0;
+  for (size_t i=0;i<n;i++){
+    uint16_t w=(uint16_t)in[2*i]<<8 | in[2*i+1];
+    uint16_t bad=~(w ^ (w>>1)) & 0x5555;
+    if (bad){*errors+=__builtin_popcount(bad);}
+    w&=0x5555;
+    w=(w | w>>1) & 0x3333;
+    w=(w | w>>2) & 0x0F0F;
+    w=(w | w>>4) & 0x00FF;
+    out[i]=(uint8_t)w;
+  }
+  return n;
 }
@@ -20,10 +20,36 @@
 #ifndef BITCODE_H
 #define BITCODE_H
 #include <stdint.h> //uint8_t
+#include <stddef.h> //size_t
 
 class BitCode{
     public:
 //////////////////////////////////////////////////////////////////////
+// Result of the binary AX.25 deframer
+//////////////////////////////////////////////////////////////////////
+enum AX25Result { AX25_OK = 0, AX25_FRAME_ERROR = 1, AX25_CRC_ERROR = 2 };
+//////////////////////////////////////////////////////////////////////
+// Extract the AX.25 frame (FCS included) from a packet received in NRZ.
+// The packet is given in two pieces, the synch word and the data read
+// from the FIFO, so the caller does not need to join them. Works on
+// bytes, no hex strings and no intermediate buffers.
+//////////////////////////////////////////////////////////////////////
+static AX25Result deframeAX25(const uint8_t *sync, size_t syncLen, const uint8_t *nrz, size_t nrzLen, uint8_t *ax25, size_t maxLen, size_t *ax25Len);
+//////////////////////////////////////////////////////////////////////
+static uint8_t reverse_byte(uint8_t b);
+//////////////////////////////////////////////////////////////////////
+// G3RUH descrambler (1 + x^12 + x^17), applied to the line bits before
+// NRZI decoding. state keeps the last received bits between calls, start
+// it at 0. in and out may be the same buffer.
+//////////////////////////////////////////////////////////////////////
+static void g3ruhDescramble(const uint8_t *in, uint8_t *out, size_t len, uint32_t *state);
+//////////////////////////////////////////////////////////////////////
+// Manchester (IEEE 802.3: 01 -> 1, 10 -> 0), two bytes in, one byte out.
+// Returns the number of bytes written, invalid pairs (00, 11) are
+// counted in errors and decoded as the second bit.
+//////////////////////////////////////////////////////////////////////
+static size_t manchesterDecode(const uint8_t *in, size_t len, uint8_t *out, size_t *errors);
+//////////////////////////////////////////////////////////////////////
 //         BYTE
 //    8 7 6 5 4 3 2 1   <-- POSICION
 //////////////////////////////////////////////////////////////////////
@@ -33,7 +59,7 @@ static uint8_t char2hexValue(uint8_t caracter);
 //////////////////////////////////////////////////////////////////////
 static uint8_t compone_byte_en_hexadecimal(uint8_t msc, uint8_t lsc);
 //////////////////////////////////////////////////////////////////////
-static size_t stringSize(char *cadena);
+static size_t stringSize(const char *cadena);
 //////////////////////////////////////////////////////////////////////
 static int nrz2nrzi (char *cadena_nrz, size_t size, char *salida, uint8_t *salidabin);
 //////////////////////////////////////////////////////////////////////
@@ -47,6 +73,8 @@ static void invierte_bits_de_un_byte(uint8_t br, uint8_t *bs);
 //////////////////////////////////////////////////////////////////////
 static void invierte_bytes_de_un_array(char *entrada,size_t size,char *salida, uint8_t *salidabin, size_t *bini);
 //////////////////////////////////////////////////////////////////////
+// Hex string version kept for compatibility, wrapper around deframeAX25
+//////////////////////////////////////////////////////////////////////
 static void nrz2ax25(char *entrada, size_t buffSize, char *salida, uint8_t *salidabin,size_t *sizeAx25bin);
 //////////////////////////////////////////////////////////////////////
 static int crc_check(char *ax25inv);
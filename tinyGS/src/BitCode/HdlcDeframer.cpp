@@ -0,0 +1,221 @@
+/*
+  HdlcDeframer.cpp - Streaming HDLC/AX.25 deframer
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "HdlcDeframer.h"
+#include "BitCode.h"
+#include "../Crc/Crc16.h"
+
+#define X25_RESIDUE 0xF0B8  // CRC register after a frame and its FCS
+
+HdlcDeframer::HdlcDeframer()
+{
+}
+
+HdlcDeframer::~HdlcDeframer()
+{
+  FramePool& pool = FramePool::getInstance();
+  pool.release(work);
+  while (pendingCount)
+    pop();
+}
+
+void HdlcDeframer::resync(bool g3ruh)
+{
+  // whatever follows the last flag of a fixed length capture is noise,
+  // so an open frame is dropped without counting it as an error
+  inFrame = false;
+  ones = 0;
+  prev = 0;
+  descramble = g3ruh;
+  scrambler = 0;
+  bitPos = 0;
+}
+
+void HdlcDeframer::feed(const uint8_t* nrz, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+  {
+    uint8_t line = nrz[i];
+    if (descramble)
+      BitCode::g3ruhDescramble(&line, &line, 1, &scrambler);
+
+    // NRZ -> NRZI eight bits at a time, a bit is ONE when it equals the previous one
+    uint8_t nrzi = ~(line ^ ((line >> 1) | (prev << 7)));
+    prev = line & 1;
+
+    if (ones < 5)
+    {
+      // no stuffing, flag or abort unless there are five ONEs in a row
+      // counting the ones carried from the previous byte
+      uint16_t w = (uint16_t)(((1u << ones) - 1) << 8) | nrzi;
+      if ((w & (w >> 1) & (w >> 2) & (w >> 3) & (w >> 4)) == 0)
+      {
+        if (inFrame)
+          push(BitCode::reverse_byte(nrzi), 8);
+        ones = __builtin_ctz(~(uint32_t)nrzi);
+        bitPos += 8;
+        continue;
+      }
+    }
+
+    for (int k = 7; k >= 0; k--)
+    {
+      lineBit = bitPos + 8 - k;
+      bit((nrzi >> k) & 1);
+    }
+    bitPos += 8;
+  }
+}
+
+void HdlcDeframer::bit(uint8_t b)
+{
+  if (b)
+  {
+    ones++;
+    if (ones <= 5)
+    {
+      if (inFrame)
+        push(1, 1);
+    }
+    else if (ones == 7 && inFrame)
+    {
+      st.aborts++;
+      inFrame = false;
+    }
+    return;
+  }
+
+  if (ones == 6)
+    flag();
+  else if (ones < 5 && inFrame)
+    push(0, 1);
+  // ones == 5: stuffed bit, ones > 6: end of an abort or idle line
+  ones = 0;
+}
+
+void HdlcDeframer::push(uint8_t bits, uint8_t n)
+{
+  acc |= (uint16_t)bits << nbits;
+  nbits += n;
+  if (nbits < 8)
+    return;
+
+  if (len >= FRAME_POOL_SLOT_SIZE)
+  {
+    st.frameErrors++;
+    inFrame = false;
+    return;
+  }
+  uint8_t byte = acc;
+  if (out)
+    out[len] = byte;
+  else
+    crc = Crc16X25::update(crc, &byte, 1);
+  len++;
+  acc >>= 8;
+  nbits -= 8;
+}
+
+void HdlcDeframer::flag()
+{
+  // the 0 and five 1s of the flag are already stored, a frame has to end
+  // on a byte boundary
+  if (inFrame && (len > 0 || nbits != 6))
+  {
+    if (nbits != 6 || len < HDLC_MIN_FRAME)
+    {
+      st.frameErrors++;
+    }
+    else if (!out)
+    {
+      // decoded without a slot, only a valid frame counts as dropped
+      if (crc == X25_RESIDUE)
+        st.dropped++;
+      else
+        st.crcErrors++;
+    }
+    else
+    {
+      uint16_t crc = Crc16X25::compute(out, len - 2);
+      if (out[len - 2] != (uint8_t)crc || out[len - 1] != (uint8_t)(crc >> 8))
+      {
+        st.crcErrors++;
+      }
+      else if (pendingCount == HDLC_PENDING_FRAMES)
+      {
+        st.dropped++;
+      }
+      else
+      {
+        st.frames++;
+        Pending& p = pending[(pendingHead + pendingCount) % HDLC_PENDING_FRAMES];
+        p.frame = work;
+        p.len = len;
+        p.offset = start;
+        pendingCount++;
+        work = FrameHandle();
+        out = nullptr;
+      }
+    }
+  }
+
+  // the closing flag of a frame is the opening flag of the next one
+  startFrame();
+}
+
+void HdlcDeframer::startFrame()
+{
+  len = 0;
+  acc = 0;
+  nbits = 0;
+  start = lineBit;
+  inFrame = true;
+  if (!work.valid())
+  {
+    // with the pool exhausted the frame is still followed to tell a valid
+    // one from the flag fill and noise that come between frames
+    work = FramePool::getInstance().borrow();
+    out = FramePool::getInstance().data(work);
+    crc = Crc16X25::begin();
+  }
+}
+
+const uint8_t* HdlcDeframer::frame() const
+{
+  return pendingCount ? FramePool::getInstance().data(pending[pendingHead].frame) : nullptr;
+}
+
+size_t HdlcDeframer::frameLen() const
+{
+  return pendingCount ? pending[pendingHead].len : 0;
+}
+
+uint32_t HdlcDeframer::frameOffset() const
+{
+  return pendingCount ? pending[pendingHead].offset : 0;
+}
+
+void HdlcDeframer::pop()
+{
+  if (!pendingCount)
+    return;
+  FramePool::getInstance().release(pending[pendingHead].frame);
+  pendingHead = (pendingHead + 1) % HDLC_PENDING_FRAMES;
+  pendingCount--;
+}
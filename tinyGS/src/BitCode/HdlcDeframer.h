@@ -0,0 +1,103 @@
+/*
+  HdlcDeframer.h - Streaming HDLC/AX.25 deframer
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef HDLC_DEFRAMER_H
+#define HDLC_DEFRAMER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../FramePool/FramePool.h"
+
+#define HDLC_PENDING_FRAMES 4   // decoded frames waiting to be published
+#define HDLC_MIN_FRAME      3   // at least one byte plus the FCS
+
+struct HdlcStats {
+  uint32_t frames = 0;       // frames with a valid FCS
+  uint32_t crcErrors = 0;    // frames with a wrong FCS
+  uint32_t aborts = 0;       // frames ended by seven or more ONEs
+  uint32_t frameErrors = 0;  // misaligned, too short or too long
+  uint32_t dropped = 0;      // valid frames lost because the pending list or the pool was full
+};
+
+// Pulls every AX.25 frame out of an NRZ bit stream. Unlike
+// BitCode::deframeAX25 it does not expect the capture to start on a flag:
+// it hunts for flags anywhere in the stream, keeps going after the first
+// frame and holds the frames it finds until they are taken with pop().
+// The bit state only goes away with resync(), so a capture can be fed in
+// as many pieces as needed; the statistics are never reset.
+class HdlcDeframer {
+public:
+  HdlcDeframer();
+  ~HdlcDeframer();
+
+  // start of a new capture: the line state is unknown and a frame still
+  // open belongs to the previous one. g3ruh puts the descrambler in front
+  // of the NRZI decoding for the whole capture.
+  void resync(bool g3ruh = false);
+  void feed(const uint8_t* nrz, size_t len);
+
+  // oldest decoded frame (FCS included), valid until pop()
+  bool available() const { return pendingCount > 0; }
+  const uint8_t* frame() const;
+  size_t frameLen() const;
+  // line bits fed since resync() up to the end of the opening flag of frame()
+  uint32_t frameOffset() const;
+  void pop();
+
+  const HdlcStats& stats() const { return st; }
+
+private:
+  HdlcDeframer(const HdlcDeframer&) = delete;
+  HdlcDeframer& operator=(const HdlcDeframer&) = delete;
+
+  void bit(uint8_t b);
+  void push(uint8_t bits, uint8_t n);
+  void flag();
+  void startFrame();
+  void dropFrame();
+
+  struct Pending {
+    FrameHandle frame;
+    size_t len;
+    uint32_t offset;
+  };
+
+  FrameHandle work;
+  uint8_t* out = nullptr;  // null with the pool exhausted: only the FCS is checked
+  size_t len = 0;
+  uint16_t crc = 0;        // running FCS of a frame with no slot to hold it
+  uint32_t bitPos = 0;     // line bits fed since resync()
+  uint32_t lineBit = 0;    // position of the bit being decoded
+  uint32_t start = 0;      // end of the opening flag of the current frame
+  uint16_t acc = 0;     // output bits, LSB first
+  uint8_t nbits = 0;    // bits in acc
+  uint8_t ones = 0;     // ONEs in a row seen on the line
+  uint8_t prev = 0;     // last NRZ bit, for NRZI
+  bool inFrame = false;
+  bool descramble = false;
+  uint32_t scrambler = 0;  // G3RUH descrambler state
+
+  Pending pending[HDLC_PENDING_FRAMES];
+  uint8_t pendingHead = 0;
+  uint8_t pendingCount = 0;
+
+  HdlcStats st;
+};
+
+#endif
@@ -0,0 +1,85 @@
+/*
+  BoardTemplate.cpp - Board pins and the custom board template parser
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "BoardTemplate.h"
+#include "../Logger/Logger.h"
+#include "ArduinoJson.h"
+
+// Radio chip and pins, the same keys for the board and for each extra radio
+static void parseRadioTemplate(JsonVariantConst doc, board_t &board)
+{
+  board.L_radio = doc["radio"];
+  board.L_NSS = doc["lNSS"];
+  board.L_DI00 = doc["lDIO0"];
+  board.L_DI01 = doc["lDIO1"];
+  board.L_BUSSY = doc["lBUSSY"];
+  board.L_RST = doc["lRST"];
+  board.L_MISO = doc["lMISO"];
+  board.L_MOSI = doc["lMOSI"];
+  board.L_SCK = doc["lSCK"];
+  board.L_TCXO_V = doc["lTCXOV"];
+  if (doc.containsKey("RXEN"))
+    board.RX_EN = doc["RXEN"];
+  else
+    board.RX_EN = UNUSED;
+  if (doc.containsKey("TXEN"))
+    board.TX_EN = doc["TXEN"];
+  else
+    board.TX_EN = UNUSED;
+}
+
+bool BoardTemplate::parse(const char *tpl, board_t &board, board_t *extra, uint8_t &count)
+{
+  DynamicJsonDocument doc(BOARD_TEMPLATE_JSON_SIZE);
+  DeserializationError error = deserializeJson(doc, tpl);
+
+  if (error.code() != DeserializationError::Ok || !doc.containsKey("radio"))
+  {
+    Log::console(PSTR("Error: Your Board template is not valid. Unable to finish setup."));
+    return false;
+  }
+
+  board.OLED__address = doc["aADDR"];
+  board.OLED__SDA = doc["oSDA"];
+  board.OLED__SCL = doc["oSCL"];
+  if (doc.containsKey("oRST"))
+    board.OLED__RST = doc["oRST"];
+  else
+    board.OLED__RST = UNUSED;
+  board.PROG__BUTTON = doc["pBut"];
+  board.BOARD_LED = doc["led"];
+  parseRadioTemplate(doc.as<JsonVariantConst>(), board);
+
+  // extra radios: "radios":[{"radio":5,"lNSS":..,"lDIO1":..,...}]
+  JsonArrayConst radios = doc["radios"];
+  count = 1;
+  for (JsonVariantConst radio : radios)
+  {
+    if (count == MAX_RADIOS)
+    {
+      Log::console(PSTR("Board template: only %u radios are supported"), MAX_RADIOS);
+      break;
+    }
+    extra[count - 1] = board;
+    parseRadioTemplate(radio, extra[count - 1]);
+    count++;
+  }
+
+  return true;
+}
@@ -0,0 +1,76 @@
+/*
+  BoardTemplate.h - Board pins and the custom board template parser
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef BOARD_TEMPLATE_H
+#define BOARD_TEMPLATE_H
+
+#include <Arduino.h>
+
+// A board with a second radio in its "radios" array takes about 300 chars
+constexpr auto TEMPLATE_LEN = 512;
+constexpr auto TEMPLATE_LEN_V05 = 256;   // config 0.05, migrated on boot
+#define BOARD_TEMPLATE_JSON_SIZE 1536
+
+typedef struct
+{
+  uint8_t OLED__address;
+  uint8_t OLED__SDA;
+  uint8_t OLED__SCL;
+  uint8_t OLED__RST;
+  uint8_t PROG__BUTTON;
+  uint8_t BOARD_LED;
+  uint8_t L_radio; // 0 SX1262  1 SX1278
+  uint8_t L_NSS;    // CS
+  uint8_t L_DI00;
+  uint8_t L_DI01;
+  uint8_t L_BUSSY;
+  uint8_t L_RST;
+  uint8_t L_MISO;
+  uint8_t L_MOSI;
+  uint8_t L_SCK;
+  float L_TCXO_V;
+  uint8_t RX_EN;
+  uint8_t TX_EN;
+  String BOARD;
+} board_t;
+
+const uint8_t UNUSED = -1;
+
+// Radios a station can run at once, the first one is described by the board
+// and any other by the "radios" array of a custom board template. Each one
+// needs its own SPI bus, the ESP32-C3 only has one for general use.
+#if CONFIG_IDF_TARGET_ESP32C3
+#define MAX_RADIOS 1
+#else
+#define MAX_RADIOS 2
+#endif
+
+// Custom board template, a JSON object with the board pins and the first radio:
+//   {"aADDR":60,"oSDA":4,"oSCL":15,"oRST":16,"pBut":0,"led":25,"radio":1,
+//    "lNSS":18,"lDIO0":26,"lDIO1":12,"lBUSSY":0,"lRST":14,"lMISO":19,
+//    "lMOSI":27,"lSCK":5,"lTCXOV":0.0,"radios":[{"radio":6,"lNSS":...}]}
+// Each extra radio starts as a copy of the board and takes the radio keys.
+class BoardTemplate {
+public:
+  // false if the template is not valid. count is the number of radios, the
+  // ones after the first go to extra (MAX_RADIOS - 1 entries)
+  static bool parse(const char* tpl, board_t& board, board_t* extra, uint8_t& count);
+};
+
+#endif
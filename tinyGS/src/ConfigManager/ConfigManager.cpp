@@ -21,7 +21,11 @@
 #include "../Mqtt/MQTT_Client.h"
 #include "../Logger/Logger.h"
 #include "../Radio/Radio.h"
-#include "../Display/graphics.h"
+#include "../Satellites/Satellites.h"
+#include "worldmap.h"
+#include "dashboard.h"
+#include "HtmlWriter.h"
+#include "EventStream.h"
 #include "ArduinoJson.h"
 #if ARDUINOJSON_USE_LONG_LONG == 0 && !PLATFORMIO
 #error "Using Arduino IDE is not recommended, please follow this guide https://github.com/G4lile0/tinyGS/wiki/Arduino-IDE or edit /ArduinoJson/src/ArduinoJson/Configuration.hpp and amend to #define ARDUINOJSON_USE_LONG_LONG 1 around line 68"
@@ -47,8 +51,20 @@ na   SX1281    2.4–2.5Ghz  130       5.5            2000         0.476-202
 
 */
 
+// every log line is pushed to the web consoles
+// the event id is the log sequence number, the dashboard polls from there if the stream fails
+static void logEvent(uint32_t seq, const char *timeStr, const char *logData)
+{
+  EventStream &events = EventStream::getInstance();
+  if (!events.clients())
+    return;
+  char line[EVENT_MAX_SIZE];
+  size_t len = snprintf(line, sizeof(line), "%s%s", timeStr, logData);
+  events.send("log", line, len < sizeof(line) ? len : sizeof(line) - 1, seq);
+}
+
 ConfigManager::ConfigManager()
-    : IotWebConf2(thingName, &dnsServer, &server, initialApPassword, configVersion), server(80), gsConfigHtmlFormatProvider(*this), boards({
+    : IotWebConf2(thingName, &dnsServer, &server, initialApPassword, configVersionKey), server(80), gsConfigHtmlFormatProvider(*this), boards({
   //OLED_add, OLED_SDA,  OLED_SCL, OLED_RST, PROG_BUTTON, BOARD_LED,      L_SX127X?,   L_NSS, L_DI00, L_DI01, L_BUSSY, L_RST,  L_MISO, L_MOSI, L_SCK, L_TCXO_V, RX_EN, TX_EN,   BOARD
 #if CONFIG_IDF_TARGET_ESP32S3
   {      0x3c,       17,        18,       21,           0,        35,      RADIO_SX1262,    8,   UNUSED,   14,      13,   12,      11,     10,     9,     1.6f,   UNUSED, UNUSED, "150–960Mhz - HELTEC LORA32 V3 SX1262"    },  // SX1262
@@ -83,12 +99,23 @@ ConfigManager::ConfigManager()
  #endif
   })
 {
+  strcpy(configVersionKey, configVersion);
   server.on(ROOT_URL, [this] { handleRoot(); });
   server.on(CONFIG_URL, [this] { handleConfig(); });
   server.on(DASHBOARD_URL, [this] { handleDashboard(); });
   server.on(RESTART_URL, [this] { handleRestart(); });
   server.on(REFRESH_CONSOLE_URL, [this] { handleRefreshConsole(); });
-  server.on(REFRESH_WORLDMAP_URL, [this] { handleRefreshWorldmap(); });
+  server.on(STATUS_API_URL, [this] { handleApiStatus(); });
+  server.on(EVENTS_URL, [this] { handleEvents(); });
+#if LOG_BINARY
+  server.on(LOG_DUMP_URL, [this] { handleLogDump(); });
+#endif
+#if PERF_STATS
+  server.on(PERF_API_URL, [this] { handlePerf(); });
+#endif
+  server.on(WORLDMAP_URL, [this] { handleWorldmap(); });
+  static const char *headerKeys[] = {"If-None-Match"};
+  server.collectHeaders(headerKeys, 1);
   setupUpdateServer(
       [this](const char *updatePath) { httpUpdater.setup(&server, updatePath); },
       [this](const char *userName, char *password) { httpUpdater.updateCredentials(userName, password); });
@@ -96,6 +123,7 @@ ConfigManager::ConfigManager()
   formValidatorStd = std::bind(&ConfigManager::formValidator, this, std::placeholders::_1);
   setFormValidator(formValidatorStd);
   setConfigSavedCallback([this] { configSavedCallback(); });
+  Log::setListener(logEvent);
   skipApStartup();
 
   // Customize own parameters
@@ -127,6 +155,24 @@ ConfigManager::ConfigManager()
   addParameterGroup(&groupAdvanced);
 }
 
+void ConfigManager::doLoop()
+{
+  IotWebConf2::doLoop();
+
+  EventStream &events = EventStream::getInstance();
+  if (events.clients() && millis() - lastStatusEvent > STATUS_EVENT_MS)
+  {
+    lastStatusEvent = millis();
+    events.send("status", statusJson, buildStatusJson());
+  }
+  events.loop();
+}
+
+static void menuButton(HtmlWriter &html, const char *url, const char *label)
+{
+  html.print("<button onclick=\"window.location.href='").print(url).print("';\">").print(label).print("</button><br /><br />");
+}
+
 void ConfigManager::handleRoot()
 {
   // -- Let IotWebConf2 test and handle captive portal requests.
@@ -136,21 +182,19 @@ void ConfigManager::handleRoot()
     return;
   }
 
-  String s = String(FPSTR(IOTWEBCONF_HTML_HEAD));
-  s += "<style>" + String(FPSTR(IOTWEBCONF_HTML_STYLE_INNER)) + "</style>";
-  s += FPSTR(IOTWEBCONF_HTML_HEAD_END);
-  s += FPSTR(IOTWEBCONF_HTML_BODY_INNER);
-  s += String(FPSTR(LOGO)) + "<br />";
-  s += "<button onclick=\"window.location.href='" + String(DASHBOARD_URL) + "';\">Station dashboard</button><br /><br />";
-  s += "<button onclick=\"window.location.href='" + String(CONFIG_URL) + "';\">Configure parameters</button><br /><br />";
-  s += "<button onclick=\"window.location.href='" + String(UPDATE_URL) + "';\">Upload new version</button><br /><br />";
-  s += "<button onclick=\"window.location.href='" + String(RESTART_URL) + "';\">Restart Station</button><br /><br />";
-  s += FPSTR(IOTWEBCONF_HTML_END);
-
-  s.replace("{v}", FPSTR(TITLE_TEXT));
-
-  server.sendHeader("Content-Length", String(s.length()));
-  server.send(200, "text/html; charset=UTF-8", s);
+  HtmlWriter html(server);
+  html.begin();
+  html.printP(IOTWEBCONF_HTML_HEAD, TITLE_TEXT);
+  html.print("<style>").printP(IOTWEBCONF_HTML_STYLE_INNER).print("</style>");
+  html.printP(IOTWEBCONF_HTML_HEAD_END);
+  html.printP(IOTWEBCONF_HTML_BODY_INNER);
+  html.printP(LOGO).print("<br />");
+  menuButton(html, DASHBOARD_URL, "Station dashboard");
+  menuButton(html, CONFIG_URL, "Configure parameters");
+  menuButton(html, UPDATE_URL, "Upload new version");
+  menuButton(html, RESTART_URL, "Restart Station");
+  html.printP(IOTWEBCONF_HTML_END);
+  html.end();
 }
 
 void ConfigManager::handleDashboard()
@@ -166,99 +210,68 @@ void ConfigManager::handleDashboard()
     }
   }
 
-  // uint64_t time = millis(); // TODO: add current time
-  String s = String(FPSTR(IOTWEBCONF_HTML_HEAD));
-  s += "<style>" + String(FPSTR(IOTWEBCONF_HTML_STYLE_INNER)) + "</style>";
-  s += "<style>" + String(FPSTR(IOTWEBCONF_DASHBOARD_STYLE_INNER)) + "</style>";
-  s += "<script>" + String(FPSTR(IOTWEBCONF_CONSOLE_SCRIPT)) + "</script>";
-  s += "<script>" + String(FPSTR(IOTWEBCONF_WORLDMAP_SCRIPT)) + "</script>";
-  s += FPSTR(IOTWEBCONF_HTML_HEAD_END);
-  s += FPSTR(IOTWEBCONF_DASHBOARD_BODY_INNER);
-  s += String(FPSTR(LOGO)) + "<br />";
-
-  // build svg of world map with animated satellite position
-  uint ix = 0;
-  uint sx;
-  String svg = "<div style=""margin-left:35px""><svg width""100%"" height=""auto"" viewBox=""0 0 262 134"" xmlns=""http://www.w3.org/2000/svg"">";
-  svg += "<rect x=""1"" y=""1"" width=""262"" height=""134"" stroke=""gray"" fill=""none"" stroke-width=""2"" />";
-  for (uint y = 0; y < earth_height; y++)
-  {
-    uint n = 0;
-    for (uint x = 0; x < earth_width / 8; x++)
-    {
-      for (uint i = 0; i < 8; i++)
-      {
-        if ((earth_bits[ix] >> i) & 1)
-        {
-          if (n == 0)
-          {
-            sx = (x * 8) + i;
-          }
-          n++;
-        }
-        if (!((earth_bits[ix] >> i) & 1) || ((x == earth_width / 8 - 1) && (i == 7)))
-        {
-          if (n > 0)
-          {
-            // append current land pixel string
-            svg += "<rect x="""+ String(sx * 2 + 3) + """ y=""" + String(y * 2 + 3) + """ width=""" + String(n * 2) + """ height=""2"" />";
-            n = 0;
-          }
-        }
-      }
-      ix++;
-    }
-  }
-  // add animated satellite position
-  svg += "<circle id=""wmsatpos"" cx=""" + String(status.satPos[0] * 2 + 3) + """ cy=""" + String(status.satPos[1] * 2 + 3) + """ stroke=""red"" fill=""none"" stroke-width=""2"">";
-  svg += "  <animate attributeName=""r"" values=""2;4;6"" dur=""0.75s"" repeatCount=""indefinite"" />";
-  svg += "</circle>";
-  svg += "</svg></div>";
-  s += svg;
-
-  s += F("</table></div><div class=\"card\"><h3>Groundstation Status</h3><table id=""gsstatus"">");
-  s += "<tr><td>Name </td><td>" + String(getThingName()) + "</td></tr>";
-  s += "<tr><td>Version </td><td>" + String(status.version) + "</td></tr>";
-  s += "<tr><td>MQTT Server </td><td>" + String(status.mqtt_connected ? "<span class='G'>CONNECTED</span>" : "<span class='R'>NOT CONNECTED</span>") + "</td></tr>";
-  if (WiFi.isConnected() ){
-      s += "<tr><td>WiFi RSSI </td><td>" + String(WiFi.RSSI()) + "</td></tr>";
+  // the page is a static shell (dashboard.h), the values are polled from /api/status
+  server.sendHeader(F("Cache-Control"), F("private, no-cache"));
+  server.sendHeader(F("ETag"), F(DASHBOARD_HTML_ETAG));
+  if (server.header("If-None-Match") == DASHBOARD_HTML_ETAG)
+  {
+    server.send(304);
+    return;
   }
 
-  s += "<tr><td>Radio </td><td>" + String(Radio::getInstance().isReady() ? "<span class='G'>READY</span>" : "<span class='R'>NOT READY</span>") + "</td></tr>";
-   s += "<tr><td>Noise floor </td><td>" + String(status.modeminfo.currentRssi) + "</td></tr>"; 
-  s += F("</table></div>");
-  s += F("<div class=\"card\"><h3>Modem Configuration</h3><table id=""modemconfig"">");
-  s += "<tr><td>Listening to </td><td>" + String(status.modeminfo.satellite) + "</td></tr>";
-  s += "<tr><td>Modulation </td><td>" + String(status.modeminfo.modem_mode) + "</td></tr>";
-  s += "<tr><td>Frequency </td><td>" + String(status.modeminfo.frequency) + "</td></tr>";
-  if (status.modeminfo.modem_mode == "LoRa")
+  const size_t size = sizeof(DASHBOARD_HTML_GZ);
+  server.sendHeader(F("Content-Encoding"), F("gzip"));
+  server.setContentLength(size);
+  server.send(200, F("text/html; charset=UTF-8"), "");
+  HtmlWriter::sendP(server, (PGM_P)DASHBOARD_HTML_GZ, size);
+}
+
+void ConfigManager::handleApiStatus()
+{
+  if (getState() == IOTWEBCONF_STATE_ONLINE)
   {
-    s += "<tr><td>Spreading Factor </td><td>" + String(status.modeminfo.sf) + "</td></tr>";
-    s += "<tr><td>Coding Rate </td><td>" + String(status.modeminfo.cr) + "</td></tr>";
-    s += "<tr><td>Bandwidth </td><td>" + String(status.modeminfo.bw) + "</td></tr>";
+    // -- Authenticate
+    if (!server.authenticate(IOTWEBCONF_ADMIN_USER_NAME, getApPasswordParameter()->valueBuffer))
+    {
+      IOTWEBCONF_DEBUG_LINE(F("Requesting authentication."));
+      server.requestAuthentication();
+      return;
+    }
   }
-  else
+
+  size_t len = buildStatusJson();
+  server.sendHeader(F("Cache-Control"), F("no-cache, no-store, must-revalidate"));
+  server.setContentLength(len);
+  server.send(200, F("application/json"), "");
+  server.sendContent(statusJson, len);
+}
+
+#if PERF_STATS
+// RX latency histograms, ?reset=1 clears them after sending
+void ConfigManager::handlePerf()
+{
+  if (getState() == IOTWEBCONF_STATE_ONLINE)
   {
-    s += "<tr><td>Bitrate </td><td>" + String(status.modeminfo.bitrate) + "</td></tr>";
-    s += "<tr><td>Frequency dev </td><td>" + String(status.modeminfo.freqDev) + "</td></tr>";
-    s += "<tr><td>Bandwidth </td><td>" + String(status.modeminfo.bw) + "</td></tr>";
+    // -- Authenticate
+    if (!server.authenticate(IOTWEBCONF_ADMIN_USER_NAME, getApPasswordParameter()->valueBuffer))
+    {
+      IOTWEBCONF_DEBUG_LINE(F("Requesting authentication."));
+      server.requestAuthentication();
+      return;
+    }
   }
-  s += F("</table></div><div class=\"card\"><h3>Last Packet Received</h3><table id=""lastpacket"">");
-  s += "<tr><td>Received at </td><td>" + String(status.lastPacketInfo.time) + "</td></tr>";
-  s += "<tr><td>Signal RSSI </td><td>" + String(status.lastPacketInfo.rssi) + "</td></tr>";
-  s += "<tr><td>Signal SNR </td><td>" + String(status.lastPacketInfo.snr) + "</td></tr>";
-  s += "<tr><td>Frequency error </td><td>" + String(status.lastPacketInfo.frequencyerror) + "</td></tr>";
-  s += "<tr><td colspan=\"2\" style=\"text-align:center;\">" + String(status.lastPacketInfo.crc_error ? "CRC ERROR!" : "") + "</td></tr>";
-  s += F("</table></div>");
-  s += FPSTR(IOTWEBCONF_CONSOLE_BODY_INNER);
-  s += "<br /><button style='max-width: 1080px;' onclick=\"window.location.href='" + String(ROOT_URL) + "';\">Go Back</button><br /><br />";
-  s += FPSTR(IOTWEBCONF_HTML_END);
-
-  s.replace("{v}", FPSTR(TITLE_TEXT));
-
-  server.sendHeader("Content-Length", String(s.length()));
-  server.send(200, "text/html; charset=UTF-8", s);
+
+  DynamicJsonDocument doc(Perf::jsonCapacity());
+  Perf::getInstance().toJson(doc);
+  String json;
+  serializeJson(doc, json);
+  server.sendHeader(F("Cache-Control"), F("no-cache, no-store, must-revalidate"));
+  server.send(200, F("application/json"), json);
+
+  if (server.arg(F("reset")) == "1")
+    Perf::getInstance().reset();
 }
+#endif
 
 void ConfigManager::handleRefreshConsole()
 {
@@ -273,8 +286,6 @@ void ConfigManager::handleRefreshConsole()
     }
   }
 
-  uint32_t counter = 0;
-
   String svalue = server.arg("c1");
   if (svalue.length())
   {
@@ -308,53 +319,71 @@ void ConfigManager::handleRefreshConsole()
     }
   }
 
-  char stmp[8];
-  String s = server.arg("c2");
-  strlcpy(stmp, s.c_str(), sizeof(stmp));
-  if (strlen(stmp))
-  {
-    counter = atoi(stmp);
-  }
+  // c2 is the sequence number of the first line the client does not have, 0 -> whole log
+  uint32_t seq = strtoul(server.arg("c2").c_str(), NULL, 10);
+  uint32_t next = Log::getNextSeq();
+  if (seq < Log::getFirstSeq() || seq > next)
+    seq = Log::getFirstSeq();
+
   server.client().flush();
   server.sendHeader(F("Cache-Control"), F("no-cache, no-store, must-revalidate"));
   server.sendHeader(F("Pragma"), F("no-cache"));
   server.sendHeader(F("Expires"), F("-1"));
   server.setContentLength(CONTENT_LENGTH_UNKNOWN);
   server.send(200, F("text/plain"), "");
-  server.sendContent(String((uint8_t)Log::getLogIdx()) + "\n");
-  if (counter != Log::getLogIdx())
+  char line[LOG_LINE_SIZE];
+  server.sendContent(line, snprintf(line, sizeof(line), "%u\n", next));
+  for (; seq != next; seq++)
   {
-    if (!counter)
-    {
-      counter = Log::getLogIdx();
-    }
-    do
-    {
-      char *tmp;
-      size_t len;
-      Log::getLog(counter, &tmp, &len);
-      if (len)
-      {
-        char stemp[len + 1];
-        memcpy(stemp, tmp, len);
-        stemp[len - 1] = '\n';
-        stemp[len] = '\0';
-        server.sendContent(stemp);
-      }
-      counter++;
-      counter &= 0xFF;
-      if (!counter)
-      {
-        counter++;
-      } // Skip log index 0 as it is not allowed
-    } while (counter != Log::getLogIdx());
+    size_t len = Log::getLog(seq, line, sizeof(line) - 1);
+    line[len++] = '\n';
+    server.sendContent(line, len);
   }
-
   server.sendContent("");
   server.client().stop();
 }
 
-void ConfigManager::handleRefreshWorldmap()
+size_t ConfigManager::buildStatusJson()
+{
+  Radio &radio = Radio::getInstance();
+  radio.currentRssi();
+
+  // strings are added as const char* so the document only keeps pointers to them
+  StaticJsonDocument<STATUS_JSON_SIZE> doc;
+  doc["name"] = (const char *)getThingName();
+  doc["ver"] = status.version;
+  doc["mqtt"] = status.mqtt_connected;
+  if (WiFi.isConnected())
+    doc["wifi"] = WiFi.RSSI();
+  doc["radio"] = radio.isReady();
+  doc["noise"] = status.modeminfo.currentRssi;
+  doc["sat"] = (const char *)status.modeminfo.satellite;
+  doc["mode"] = status.modeminfo.modem_mode.c_str();
+  doc["freq"] = status.modeminfo.frequency;
+  if (status.modeminfo.modem_mode == "LoRa")
+  {
+    doc["sf"] = status.modeminfo.sf;
+    doc["cr"] = status.modeminfo.cr;
+  }
+  else
+  {
+    doc["br"] = status.modeminfo.bitrate;
+    doc["fd"] = status.modeminfo.freqDev;
+  }
+  doc["bw"] = status.modeminfo.bw;
+  JsonArray pos = doc.createNestedArray("pos");
+  pos.add(status.satPos[0]);
+  pos.add(status.satPos[1]);
+  doc["time"] = status.lastPacketInfo.time.c_str();
+  doc["rssi"] = status.lastPacketInfo.rssi;
+  doc["snr"] = status.lastPacketInfo.snr;
+  doc["ferr"] = status.lastPacketInfo.frequencyerror;
+  doc["crc"] = status.lastPacketInfo.crc_error;
+
+  return serializeJson(doc, statusJson, sizeof(statusJson));
+}
+
+void ConfigManager::handleEvents()
 {
   if (getState() == IOTWEBCONF_STATE_ONLINE)
   {
@@ -367,56 +396,96 @@ void ConfigManager::handleRefreshWorldmap()
     }
   }
 
-  server.client().flush();
-  server.sendHeader(F("Cache-Control"), F("no-cache, no-store, must-revalidate"));
-  server.sendHeader(F("Pragma"), F("no-cache"));
-  server.sendHeader(F("Expires"), F("-1"));
-  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
-  server.send(200, F("text/plain"), "");
-
-  // world map satellite position (for wmsatpos id attributes)
-  String cx= String(status.satPos[0] * 2 + 3);
-  String cy= String(status.satPos[1] * 2 + 3);
-  String data_string = cx + "," + cy + ",";
-
-  // modem configuration (for modemconfig id table data)
-  data_string += String(status.modeminfo.satellite) + "," +
-                 String(status.modeminfo.modem_mode) + "," +
-                 String(status.modeminfo.frequency) + ",";
-  if (status.modeminfo.modem_mode == "LoRa")
+  EventStream &events = EventStream::getInstance();
+  int client = events.add(server.client());
+  if (client < 0)
   {
-    data_string += String(status.modeminfo.sf) + ",";
-    data_string += String(status.modeminfo.cr) + ",";
+    // the dashboard falls back to polling
+    server.send(503, F("text/plain"), F("Too many dashboards open"));
+    return;
   }
-  else
+  // EventStream keeps its own reference to the socket. Without one the web
+  // server sees a closed client and goes back to waiting for the next request,
+  // instead of waiting up to HTTP_MAX_CLOSE_WAIT for this one to close.
+  server.client() = WiFiClient();
+
+  // c2 is the first line the dashboard does not have, as in handleRefreshConsole:
+  // the lines logged since its last poll are sent before the new ones
+  uint32_t seq = strtoul(server.arg("c2").c_str(), NULL, 10);
+  uint32_t next = Log::getNextSeq();
+  if (seq >= Log::getFirstSeq() && seq <= next)
   {
-    data_string += String(status.modeminfo.bitrate) + ",";
-    data_string += String(status.modeminfo.freqDev) + ",";
+    char line[LOG_LINE_SIZE];
+    for (; seq != next; seq++)
+      events.send("log", line, Log::getLog(seq, line, sizeof(line)), seq, client);
   }
-  data_string += String(status.modeminfo.bw) + ",";
-
-  // ground station status (for gsstatus id table data)
-  data_string += String(getThingName()) + ",";
-  data_string += String(status.version) + ",";
-  data_string += String(status.mqtt_connected ? "<span class='G'>CONNECTED</span>" : "<span class='R'>NOT CONNECTED</span>") + ",";
-  if (WiFi.isConnected() ){
-    data_string += String(WiFi.RSSI()) + ",";
+
+  // push the current status right away
+  lastStatusEvent = 0;
+}
+
+#if LOG_BINARY
+// Raw log records for tools/logdump.py: a header, the firmware git version
+// (length + characters) and then every record kept as [uint16_t length][record]
+void ConfigManager::handleLogDump()
+{
+  if (getState() == IOTWEBCONF_STATE_ONLINE)
+  {
+    // -- Authenticate
+    if (!server.authenticate(IOTWEBCONF_ADMIN_USER_NAME, getApPasswordParameter()->valueBuffer))
+    {
+      IOTWEBCONF_DEBUG_LINE(F("Requesting authentication."));
+      server.requestAuthentication();
+      return;
+    }
   }
-  data_string += String(Radio::getInstance().isReady() ? "<span class='G'>READY</span>" : "<span class='R'>NOT READY</span>") + ",";
-  Radio &radio = Radio::getInstance();
-  radio.currentRssi();
-  data_string += String(status.modeminfo.currentRssi) + ",";
-  
-  // last packet received data (for lastpacket id table data)
-  data_string += String(status.lastPacketInfo.time) + ",";
-  data_string += String(status.lastPacketInfo.rssi) + ",";
-  data_string += String(status.lastPacketInfo.snr) + ",";
-  data_string += String(status.lastPacketInfo.frequencyerror) + ",";
-  data_string += String(status.lastPacketInfo.crc_error ? "CRC ERROR!" : "");
-  server.sendContent(data_string + "\n");
 
+  struct __attribute__((packed)) {
+    char magic[4];
+    uint8_t version;
+    uint8_t ptrSize;
+    uint16_t reserved;
+    uint32_t firmware;
+    uint32_t firstSeq;
+  } header = {{'T', 'G', 'L', 'B'}, 1, sizeof(void *), 0, status.version, Log::getFirstSeq()};
+
+  server.sendHeader(F("Content-Disposition"), F("attachment; filename=log.bin"));
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, F("application/octet-stream"), "");
+
+  uint8_t buf[1024];
+  size_t len = sizeof(header);
+  memcpy(buf, &header, len);
+  uint8_t gitLen = strnlen(status.git_version, 255);
+  buf[len++] = gitLen;
+  memcpy(buf + len, status.git_version, gitLen);
+  len += gitLen;
+
+  uint32_t next = Log::getNextSeq();
+  for (uint32_t seq = Log::getFirstSeq(); seq != next; seq++)
+  {
+    if (len + 2 + LOG_RECORD_SIZE > sizeof(buf))
+    {
+      server.sendContent((const char *)buf, len);
+      len = 0;
+    }
+    uint16_t recordLen = Log::getRecord(seq, buf + len + 2, LOG_RECORD_SIZE);
+    memcpy(buf + len, &recordLen, sizeof(recordLen));
+    len += 2 + recordLen;
+  }
+  server.sendContent((const char *)buf, len);
   server.sendContent("");
-  server.client().stop();
+}
+#endif
+
+void ConfigManager::handleWorldmap()
+{
+  // generated at build time (worldmap.h), it never changes while the firmware runs
+  const size_t size = sizeof(WORLDMAP_SVG) - 1;
+  server.sendHeader(F("Cache-Control"), F("public, max-age=31536000, immutable"));
+  server.setContentLength(size);
+  server.send(200, F("image/svg+xml"), "");
+  HtmlWriter::sendP(server, WORLDMAP_SVG, size);
 }
 
 void ConfigManager::handleRestart()
@@ -432,19 +501,17 @@ void ConfigManager::handleRestart()
     }
   }
 
-  String s = String(FPSTR(IOTWEBCONF_HTML_HEAD));
-  s += "<style>" + String(FPSTR(IOTWEBCONF_HTML_STYLE_INNER)) + "</style>";
-  s += "<meta http-equiv=\"refresh\" content=\"8; url=/\">";
-  s += FPSTR(IOTWEBCONF_HTML_HEAD_END);
-  s += FPSTR(IOTWEBCONF_HTML_BODY_INNER);
-  s += String(FPSTR(LOGO)) + "<br />";
-  s += "Ground Station is restarting...<br /><br/>";
-  s += FPSTR(IOTWEBCONF_HTML_END);
-
-  s.replace("{v}", FPSTR(TITLE_TEXT));
-
-  server.sendHeader("Content-Length", String(s.length()));
-  server.send(200, "text/html; charset=UTF-8", s);
+  HtmlWriter html(server);
+  html.begin();
+  html.printP(IOTWEBCONF_HTML_HEAD, TITLE_TEXT);
+  html.print("<style>").printP(IOTWEBCONF_HTML_STYLE_INNER).print("</style>");
+  html.print("<meta http-equiv=\"refresh\" content=\"8; url=/\">");
+  html.printP(IOTWEBCONF_HTML_HEAD_END);
+  html.printP(IOTWEBCONF_HTML_BODY_INNER);
+  html.printP(LOGO).print("<br />");
+  html.print("Ground Station is restarting...<br /><br/>");
+  html.printP(IOTWEBCONF_HTML_END);
+  html.end();
   delay(100);
   ESP.restart();
 }
@@ -516,6 +583,7 @@ void ConfigManager::resetAllConfig()
 
 boolean ConfigManager::init()
 {
+  migrateConfig();
   boolean validConfig = IotWebConf2::init();
 
   // when wifi credentials are set but we are not able to connect (maybe wrong credentials)
@@ -537,6 +605,29 @@ boolean ConfigManager::init()
   return validConfig;
 }
 
+// 0.05 kept TEMPLATE_LEN_V05 chars of board template, too few for a second
+// radio. The parameters before it did not move, so that config loads with the
+// new layout and only the modem startup and advanced parameters, which come
+// TEMPLATE_LEN - TEMPLATE_LEN_V05 bytes early, are moved back before saving.
+static_assert(TEMPLATE_LEN - TEMPLATE_LEN_V05 == MODEM_LEN && ADVANCED_LEN <= MODEM_LEN,
+              "migrateConfig() expects the old modem startup in the template buffer");
+
+void ConfigManager::migrateConfig()
+{
+  strcpy(configVersionKey, configVersionV05);
+  bool old = loadConfig();
+  strcpy(configVersionKey, configVersion);
+  if (!old)
+    return;
+
+  memcpy(advancedConfig, modemStartup, ADVANCED_LEN);
+  memcpy(modemStartup, boardTemplate + TEMPLATE_LEN_V05, MODEM_LEN);
+  memset(boardTemplate + TEMPLATE_LEN_V05, 0, TEMPLATE_LEN - TEMPLATE_LEN_V05);
+  strcpy(savedThingName, getThingName());
+  saveConfig();
+  Log::console(PSTR("Configuration updated from %s to %s"), configVersionV05, configVersion);
+}
+
 void ConfigManager::boardDetection()
 {
   // List all compatible boards configuration
@@ -578,7 +669,7 @@ void ConfigManager::boardDetection()
   if (strcmp(ESP.getChipModel(), "ESP32-PICO-D4") != 0) {
         for (uint8_t ite = 0; ite < ((sizeof(boards) / sizeof(boards[0]))); ite++)
       {
-        Log::error(PSTR("%s \n"), boards[ite].BOARD);
+        Log::error(PSTR("%s \n"), boards[ite].BOARD.c_str());
       if (boards[ite].OLED__RST != UNUSED) {
         pinMode(boards[ite].OLED__RST, OUTPUT);
         digitalWrite(boards[ite].OLED__RST, LOW);
@@ -624,6 +715,7 @@ void ConfigManager::configSavedCallback()
   {
     forceApMode(false);
     parseModemStartup();
+    MQTT_Client::getInstance().buildTopicPrefixes(); // the MQTT user may have changed
     MQTT_Client::getInstance().scheduleRestart();
  
     // Prog button already pressed so something is wrong.. trying to amend it..
@@ -700,7 +792,7 @@ void ConfigManager::parseModemStartup()
   if (modemStartup[0] == '\0')
     return; // no modem configured yet
   
-  size_t size = JSON_ARRAY_SIZE(10) + 10 * JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(16) + JSON_ARRAY_SIZE(8) + JSON_ARRAY_SIZE(8) + 64;
+  size_t size = JSON_ARRAY_SIZE(10) + 10 * JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(20) + JSON_ARRAY_SIZE(8) + JSON_ARRAY_SIZE(8) + 64;
   DynamicJsonDocument doc(size);
   DeserializationError error = deserializeJson(doc, (const char *)modemStartup);
 
@@ -716,6 +808,8 @@ void ConfigManager::parseModemStartup()
   m.modem_mode = doc["mode"].as<String>();
   strcpy(m.satellite, doc["sat"].as<char *>());
   m.NORAD = doc["NORAD"];
+  if (doc.containsKey("dec"))
+    Satellites::setDecoder(m.NORAD, doc["dec"]);
 
   if (m.modem_mode == "LoRa")
   {
@@ -749,6 +843,8 @@ void ConfigManager::parseModemStartup()
         m.fsw[i] = 0;
     }
     m.enc= doc["enc"];
+    m.fec = doc["fec"] | 0;
+    m.rsDepth = doc["rsI"] | 1;
   }
 
   // packets Filter
@@ -765,45 +861,11 @@ void ConfigManager::parseModemStartup()
     Radio::getInstance().begin();
 }
 
-bool ConfigManager::parseBoardTemplate(board_t &board)
+bool ConfigManager::getRadioConfig(uint8_t index, board_t &board)
 {
-  size_t size = 512;
-  DynamicJsonDocument doc(size);
-  DeserializationError error = deserializeJson(doc, ConfigManager::getInstance().getBoardTemplate());
-
-  if (error.code() != DeserializationError::Ok || !doc.containsKey("radio"))
-  {
-    Log::console(PSTR("Error: Your Board template is not valid. Unable to finish setup."));
+  if (!getBoardConfig(board) || index >= radioCount)
     return false;
-  }
-
-  board.OLED__address = doc["aADDR"];
-  board.OLED__SDA = doc["oSDA"];
-  board.OLED__SCL = doc["oSCL"];
-  if (doc.containsKey("oRST"))
-    board.OLED__RST = doc["oRST"];
-  else
-    board.OLED__RST = UNUSED;
-  board.PROG__BUTTON = doc["pBut"];
-  board.BOARD_LED = doc["led"];
-  board.L_radio = doc["radio"];
-  board.L_NSS = doc["lNSS"];
-  board.L_DI00 = doc["lDIO0"];
-  board.L_DI01 = doc["lDIO1"];
-  board.L_BUSSY = doc["lBUSSY"];
-  board.L_RST = doc["lRST"];
-  board.L_MISO = doc["lMISO"];
-  board.L_MOSI = doc["lMOSI"];
-  board.L_SCK = doc["lSCK"];
-  board.L_TCXO_V = doc["lTCXOV"];
-  if (doc.containsKey("RXEN"))
-    board.RX_EN = doc["RXEN"];
-  else
-    board.RX_EN = UNUSED;
-  if (doc.containsKey("TXEN"))
-    board.TX_EN = doc["TXEN"];
-  else
-    board.TX_EN = UNUSED;
-
+  if (index)
+    board = currentRadios[index - 1];
   return true;
 }
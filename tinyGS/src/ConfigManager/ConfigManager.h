@@ -26,6 +26,9 @@
 #include "logos.h"
 #include <Wire.h>
 #include "html.h"
+#include "../Logger/Logger.h"
+#include "BoardTemplate.h"
+#include "../Perf/Perf.h"
 
 #ifdef ESP8266
 #include "ESP8266HTTPUpdateServer.h"
@@ -41,7 +44,6 @@ constexpr auto MQTT_USER_LENGTH = 31;
 constexpr auto MQTT_PASS_LENGTH = 31;
 constexpr auto CHECKBOX_LENGTH = 9;
 constexpr auto NUMBER_LEN = 32;
-constexpr auto TEMPLATE_LEN = 256;
 constexpr auto MODEM_LEN = 256;
 constexpr auto ADVANCED_LEN = 256;
 constexpr auto CB_SELECTED_STR = "selected";
@@ -52,13 +54,20 @@ constexpr auto DASHBOARD_URL = "/dashboard";
 constexpr auto UPDATE_URL = "/firmware";
 constexpr auto RESTART_URL = "/restart";
 constexpr auto REFRESH_CONSOLE_URL = "/cs";
-constexpr auto REFRESH_WORLDMAP_URL = "/wm";
+constexpr auto WORLDMAP_URL = "/worldmap.svg";
+constexpr auto STATUS_API_URL = "/api/status";
+constexpr auto EVENTS_URL = "/events";
+constexpr auto LOG_DUMP_URL = "/log.bin";
+constexpr auto PERF_API_URL = "/api/perf";
+constexpr size_t STATUS_JSON_SIZE = 512;
+constexpr unsigned long STATUS_EVENT_MS = 2000; // status pushed to the open dashboards
 
 const char TITLE_TEXT[] PROGMEM = "TinyGS Configuration";
 
 constexpr auto thingName = "My TinyGS";
 constexpr auto initialApPassword = "";
-constexpr auto configVersion = "0.05"; //max 4 chars
+constexpr auto configVersion = "0.06"; //max 4 chars
+constexpr auto configVersionV05 = "0.05";
 
 #define MQTT_DEFAULT_SERVER "mqtt.tinygs.com"
 #define MQTT_DEFAULT_PORT "8883"
@@ -100,31 +109,6 @@ enum boardNum
   NUM_BOARDS //this line always has to be the last one
 };
 
-typedef struct
-{
-  uint8_t OLED__address;
-  uint8_t OLED__SDA;
-  uint8_t OLED__SCL;
-  uint8_t OLED__RST;
-  uint8_t PROG__BUTTON;
-  uint8_t BOARD_LED;
-  uint8_t L_radio; // 0 SX1262  1 SX1278
-  uint8_t L_NSS;    // CS
-  uint8_t L_DI00;
-  uint8_t L_DI01;
-  uint8_t L_BUSSY;
-  uint8_t L_RST;
-  uint8_t L_MISO;
-  uint8_t L_MOSI;
-  uint8_t L_SCK;
-  float L_TCXO_V;
-  uint8_t RX_EN;
-  uint8_t TX_EN;
-  String BOARD;
-} board_t;
-
-const uint8_t UNUSED = -1;
-
 typedef struct
 {
   bool flipOled = true;
@@ -144,6 +128,7 @@ public:
   void resetAllConfig();
   void resetModemConfig();
   boolean init();
+  void doLoop(); // IotWebConf2::doLoop() plus the dashboard events
   void printConfig();
 
   uint16_t getMqttPort() { return (uint16_t)atoi(mqttPort); }
@@ -195,12 +180,18 @@ public:
     bool ret = true;
     if (!currentBoardDirty) { board = currentBoard; return ret; }
 
-    if (getBoardTemplate()[0] == '\0') { currentBoard = boards[getBoard()]; }
-    else { ret = parseBoardTemplate(currentBoard); }
+    if (getBoardTemplate()[0] == '\0') { currentBoard = boards[getBoard()]; radioCount = 1; }
+    else { ret = BoardTemplate::parse(getBoardTemplate(), currentBoard, currentRadios, radioCount); }
     currentBoardDirty = false;
     board = currentBoard;
     return ret;
   }
+  bool getRadioConfig(uint8_t index, board_t &board);
+  uint8_t getRadioCount()
+  {
+    board_t board;
+    return getBoardConfig(board) ? radioCount : 0;
+  }
   void saveConfig()
   {
     remoteSave = true;
@@ -239,7 +230,16 @@ private:
   void handleRoot();
   void handleDashboard();
   void handleRefreshConsole();
-  void handleRefreshWorldmap();
+  void handleApiStatus();
+  void handleEvents();
+#if LOG_BINARY
+  void handleLogDump();
+#endif
+#if PERF_STATS
+  void handlePerf();
+#endif
+  size_t buildStatusJson();
+  void handleWorldmap();
   void handleBoardTemplateRequest();
   void handleRestart();
   bool formValidator(iotwebconf2::WebRequestWrapper *);
@@ -247,11 +247,13 @@ private:
   void configSavedCallback();
   void parseAdvancedConf();
   void parseModemStartup();
-  bool parseBoardTemplate(board_t &);
+  void migrateConfig();
 
   std::function<boolean(iotwebconf2::WebRequestWrapper *)> formValidatorStd;
   DNSServer dnsServer;
   WebServer server;
+  char statusJson[STATUS_JSON_SIZE]; // reused by every /api/status response and status event
+  unsigned long lastStatusEvent = 0;
 #ifdef ESP8266
   ESP8266HTTPUpdateServer httpUpdater;
 #elif defined(ESP32)
@@ -261,8 +263,11 @@ private:
   board_t boards[NUM_BOARDS];
   board_t currentBoard;
   bool currentBoardDirty = true;
+  board_t currentRadios[MAX_RADIOS - 1];  // currentBoard with the pins of each extra radio
+  uint8_t radioCount = 1;
   AdvancedConfig advancedConf;
   char savedThingName[IOTWEBCONF_WORD_LEN] = "";
+  char configVersionKey[IOTWEBCONF_CONFIG_VERSION_LENGTH + 1];  // the one IotWebConf2 loads, see migrateConfig()
   bool remoteSave = false;
 
   char latitude[COORDINATE_LENGTH] = "";
@@ -303,7 +308,7 @@ private:
   iotwebconf2::CheckboxParameter autoUpdateParam = iotwebconf2::CheckboxParameter("Automatic Firmware Update", "auto_update", autoUpdate, CHECKBOX_LENGTH, true);
 
   iotwebconf2::ParameterGroup groupAdvanced = iotwebconf2::ParameterGroup("Advanced config", "Advanced Config (do not modify unless you know what you are doing)");
-  iotwebconf2::TextParameter boardTemplateParam = iotwebconf2::TextParameter("Board Template (requires manual restart)", "board_template", boardTemplate, TEMPLATE_LEN, NULL, NULL, "type=\"text\" maxlength=255");
+  iotwebconf2::TextParameter boardTemplateParam = iotwebconf2::TextParameter("Board Template (requires manual restart)", "board_template", boardTemplate, TEMPLATE_LEN, NULL, NULL, "type=\"text\" maxlength=511");
   iotwebconf2::TextParameter modemParam = iotwebconf2::TextParameter("Modem startup", "modem_startup", modemStartup, MODEM_LEN, "", "", "type=\"text\" maxlength=255");
   iotwebconf2::TextParameter advancedConfigParam = iotwebconf2::TextParameter("Advanced parameters", "advanced_config", advancedConfig, ADVANCED_LEN, NULL, NULL, "type=\"text\" maxlength=255");
 };
@@ -0,0 +1,154 @@
+/*
+  EventStream.cpp - Server-Sent Events channel of the web dashboard
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "EventStream.h"
+#include <lwip/sockets.h>
+#include <errno.h>
+
+int EventStream::add(WiFiClient &client)
+{
+  for (int i = 0; i < EVENT_STREAM_CLIENTS; i++)
+  {
+    Client &c = slots[i];
+    if (c.active)
+      continue;
+
+    c.client = client;
+    c.client.setNoDelay(true);
+    c.client.print(F("HTTP/1.1 200 OK\r\n"
+                     "Content-Type: text/event-stream\r\n"
+                     "Cache-Control: no-cache\r\n"
+                     "Connection: keep-alive\r\n\r\n"
+                     "retry: 5000\n\n"));
+    c.queueStart = c.queueLen = 0;
+    c.outLen = c.outSent = 0;
+    c.active = true;
+    numClients++;
+    return i;
+  }
+  return -1;
+}
+
+void EventStream::send(const char *event, const char *data, size_t len, uint32_t id, int to)
+{
+  if (!numClients)
+    return;
+
+  char buf[EVENT_MAX_SIZE];
+  size_t n = id ? snprintf(buf, sizeof(buf), "id: %u\nevent: %s\ndata: ", id, event)
+                : snprintf(buf, sizeof(buf), "event: %s\ndata: ", event);
+  if (n + 2 >= sizeof(buf))
+    return;
+  if (len > sizeof(buf) - n - 2)
+    len = sizeof(buf) - n - 2; // too long, truncated
+  for (size_t i = 0; i < len; i++)
+    buf[n++] = data[i] == '\n' || data[i] == '\r' ? ' ' : data[i];
+  buf[n++] = '\n';
+  buf[n++] = '\n';
+
+  for (int i = 0; i < EVENT_STREAM_CLIENTS; i++)
+    if (slots[i].active && (to < 0 || to == i))
+      push(slots[i], buf, n);
+}
+
+void EventStream::push(Client &c, const char *event, size_t len)
+{
+  uint16_t eventLen = len;
+  while (EVENT_QUEUE_SIZE - c.queueLen < sizeof(eventLen) + len)
+  {
+    // drop the oldest queued event
+    uint16_t oldLen;
+    queueRead(c, (uint8_t *)&oldLen, sizeof(oldLen));
+    c.queueStart = (c.queueStart + oldLen) % EVENT_QUEUE_SIZE;
+    c.queueLen -= oldLen;
+    droppedEvents++;
+  }
+  queueWrite(c, (const uint8_t *)&eventLen, sizeof(eventLen));
+  queueWrite(c, (const uint8_t *)event, len);
+}
+
+void EventStream::queueRead(Client &c, uint8_t *dst, size_t len)
+{
+  size_t first = EVENT_QUEUE_SIZE - c.queueStart;
+  if (first > len)
+    first = len;
+  memcpy(dst, c.queue + c.queueStart, first);
+  memcpy(dst + first, c.queue, len - first);
+  c.queueStart = (c.queueStart + len) % EVENT_QUEUE_SIZE;
+  c.queueLen -= len;
+}
+
+void EventStream::queueWrite(Client &c, const uint8_t *src, size_t len)
+{
+  size_t end = (c.queueStart + c.queueLen) % EVENT_QUEUE_SIZE;
+  size_t first = EVENT_QUEUE_SIZE - end;
+  if (first > len)
+    first = len;
+  memcpy(c.queue + end, src, first);
+  memcpy(c.queue, src + first, len - first);
+  c.queueLen += len;
+}
+
+void EventStream::loop()
+{
+  if (!numClients)
+    return;
+
+  if (millis() - lastKeepalive > EVENT_KEEPALIVE_MS)
+  {
+    // comment line, keeps proxies from closing an idle stream and finds dead clients
+    lastKeepalive = millis();
+    for (Client &c : slots)
+      if (c.active)
+        push(c, ":\n\n", 3);
+  }
+
+  for (Client &c : slots)
+  {
+    while (c.active)
+    {
+      if (c.outSent == c.outLen)
+      {
+        if (!c.queueLen)
+          break;
+        uint16_t len;
+        queueRead(c, (uint8_t *)&len, sizeof(len));
+        queueRead(c, (uint8_t *)c.out, len);
+        c.outLen = len;
+        c.outSent = 0;
+      }
+
+      int sent = ::send(c.client.fd(), c.out + c.outSent, c.outLen - c.outSent, MSG_DONTWAIT);
+      if (sent < 0)
+      {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+          remove(c); // closed by the browser
+        break;
+      }
+      c.outSent += sent;
+    }
+  }
+}
+
+void EventStream::remove(Client &c)
+{
+  c.client.stop();
+  c.active = false;
+  numClients--;
+}
@@ -0,0 +1,79 @@
+/*
+  EventStream.h - Server-Sent Events channel of the web dashboard
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef EVENT_STREAM_H
+#define EVENT_STREAM_H
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+
+#define EVENT_STREAM_CLIENTS 2
+#define EVENT_QUEUE_SIZE     2048    // per client, the oldest events are dropped when it is full
+#define EVENT_MAX_SIZE       512     // one formatted event
+#define EVENT_KEEPALIVE_MS   15000
+
+// Keeps the connections of the open dashboards and pushes text/event-stream
+// events to them. Every client has its own queue of formatted events that
+// loop() writes with non-blocking sends, so a slow browser only loses its own
+// oldest events and never stalls the main loop. Must be used from the loop
+// task only.
+class EventStream {
+public:
+  static EventStream& getInstance()
+  {
+    static EventStream instance;
+    return instance;
+  }
+
+  // takes over the connection of the request being served, returns its client
+  // number or -1 if all slots are busy
+  int add(WiFiClient& client);
+  // queues "id: <id>\nevent: <event>\ndata: <data>\n\n" for every client, or only
+  // for client 'to'. Line breaks in data are replaced, no id line when id is 0.
+  void send(const char* event, const char* data, size_t len, uint32_t id = 0, int to = -1);
+  void send(const char* event, const char* data) { send(event, data, strlen(data)); }
+  void loop();
+  uint8_t clients() { return numClients; }
+  uint32_t dropped() { return droppedEvents; }
+
+private:
+  struct Client {
+    WiFiClient client;
+    bool active = false;
+    uint8_t queue[EVENT_QUEUE_SIZE]; // events prefixed by their uint16_t length
+    size_t queueStart = 0;
+    size_t queueLen = 0;
+    char out[EVENT_MAX_SIZE];        // event being written to the socket
+    size_t outLen = 0;
+    size_t outSent = 0;
+  };
+
+  EventStream() {}
+  void push(Client& c, const char* event, size_t len);
+  void queueRead(Client& c, uint8_t* dst, size_t len);
+  void queueWrite(Client& c, const uint8_t* src, size_t len);
+  void remove(Client& c);
+
+  Client slots[EVENT_STREAM_CLIENTS];
+  uint8_t numClients = 0;
+  uint32_t droppedEvents = 0;
+  unsigned long lastKeepalive = 0;
+};
+
+#endif
@@ -0,0 +1,105 @@
+/*
+  HtmlWriter.cpp - Streams web pages to the client through a fixed buffer
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "HtmlWriter.h"
+
+void HtmlWriter::begin(int code, const char *contentType)
+{
+  len = 0;
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(code, contentType, "");
+}
+
+void HtmlWriter::end()
+{
+  flush();
+  server.sendContent(""); // last chunk
+}
+
+void HtmlWriter::sendP(WebServer &server, PGM_P data, size_t size)
+{
+  for (size_t sent = 0; sent < size; sent += HTML_WRITER_BUFFER_SIZE)
+    server.sendContent_P(data + sent, size - sent < HTML_WRITER_BUFFER_SIZE ? size - sent : HTML_WRITER_BUFFER_SIZE);
+}
+
+HtmlWriter &HtmlWriter::printP(PGM_P text, PGM_P v)
+{
+  size_t textLen = strlen_P(text);
+  if (v)
+  {
+    size_t vLen = strlen_P(v);
+    PGM_P tag;
+    while ((tag = strstr_P(text, PSTR("{v}"))) != nullptr)
+    {
+      writeP(text, tag - text);
+      writeP(v, vLen);
+      textLen -= tag + 3 - text;
+      text = tag + 3;
+    }
+  }
+
+  writeP(text, textLen);
+  return *this;
+}
+
+HtmlWriter &HtmlWriter::print(const char *text)
+{
+  write(text, strlen(text));
+  return *this;
+}
+
+void HtmlWriter::write(const char *data, size_t dataLen)
+{
+  while (dataLen)
+  {
+    size_t n = sizeof(buffer) - len;
+    if (n > dataLen)
+      n = dataLen;
+    memcpy(buffer + len, data, n);
+    len += n;
+    data += n;
+    dataLen -= n;
+    if (len == sizeof(buffer))
+      flush();
+  }
+}
+
+void HtmlWriter::writeP(PGM_P data, size_t dataLen)
+{
+  while (dataLen)
+  {
+    size_t n = sizeof(buffer) - len;
+    if (n > dataLen)
+      n = dataLen;
+    memcpy_P(buffer + len, data, n);
+    len += n;
+    data += n;
+    dataLen -= n;
+    if (len == sizeof(buffer))
+      flush();
+  }
+}
+
+void HtmlWriter::flush()
+{
+  if (!len)
+    return;
+  server.sendContent(buffer, len);
+  len = 0;
+}
@@ -0,0 +1,62 @@
+/*
+  HtmlWriter.h - Streams web pages to the client through a fixed buffer
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef HTML_WRITER_H
+#define HTML_WRITER_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+#define HTML_WRITER_BUFFER_SIZE 1024
+
+// Writes a page as a chunked response (CONTENT_LENGTH_UNKNOWN). The fragments
+// are copied into a fixed buffer that is sent every time it fills up,
+// so no String is built and the heap use does not depend on the page size.
+//
+//   HtmlWriter html(server);
+//   html.begin();
+//   html.printP(IOTWEBCONF_HTML_HEAD, TITLE_TEXT).print("<b>").print(label).print("</b>");
+//   html.end();
+class HtmlWriter {
+public:
+  HtmlWriter(WebServer& server) : server(server) {}
+  void begin(int code = 200, const char* contentType = "text/html; charset=UTF-8");
+  void end();
+
+  // body of a response with a known length, a PROGMEM blob sent straight
+  // from flash in HTML_WRITER_BUFFER_SIZE pieces
+  static void sendP(WebServer& server, PGM_P data, size_t size);
+
+  // PROGMEM fragment, every {v} in it is replaced by v (PROGMEM too)
+  HtmlWriter& printP(PGM_P text, PGM_P v = nullptr);
+  HtmlWriter& print(const char* text);
+  HtmlWriter& print(const __FlashStringHelper* text) { return printP((PGM_P)text); }
+  HtmlWriter& print(const String& text) { write(text.c_str(), text.length()); return *this; }
+
+private:
+  void write(const char* data, size_t len);
+  void writeP(PGM_P data, size_t len);
+  void flush();
+
+  WebServer& server;
+  char buffer[HTML_WRITER_BUFFER_SIZE];
+  size_t len = 0;
+};
+
+#endif
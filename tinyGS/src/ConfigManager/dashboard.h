@@ -0,0 +1,766 @@
+/*
+  dashboard.h - Dashboard page, generated by tools/dashboard_html.py
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Do not edit, generated from dashboard.html by tools/dashboard_html.py
+
+#ifndef DASHBOARD_H
+#define DASHBOARD_H
+
+#define DASHBOARD_HTML_ETAG "\"74e35ef3\""
+
+const uint8_t DASHBOARD_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0xbc, 0xd7, 0x92, 0xe3, 0x48,
+  0x92, 0x28, 0xfa, 0x3e, 0x5f, 0x91, 0xd3, 0x6b, 0xbb, 0xd9, 0x75, 0x51, 0x5d, 0xd0, 0x20, 0xd0,
+  0xd5, 0xd9, 0x63, 0x10, 0x04, 0x40, 0x12, 0x8a, 0x10, 0x84, 0xd8, 0xbb, 0x76, 0x0c, 0x5a, 0x10,
+  0x8a, 0xd0, 0x40, 0x5b, 0xff, 0xfb, 0x01, 0xb3, 0xaa, 0xe5, 0xf4, 0xec, 0xdc, 0xcb, 0x07, 0x26,
+  0x22, 0xc2, 0x3d, 0x5c, 0x84, 0x87, 0x0b, 0x4b, 0x38, 0x7f, 0xf8, 0x3b, 0xa7, 0xb2, 0xa6, 0xab,
+  0x1d, 0x5f, 0xb2, 0xa1, 0x2a, 0x7f, 0xfc, 0xe1, 0xf9, 0xfd, 0x52, 0xfa, 0x75, 0xfa, 0xf6, 0x4d,
+  0x5c, 0x7f, 0xb3, 0x8f, 0x63, 0x3f, 0xfa, 0xf1, 0x87, 0x2a, 0x1e, 0xfc, 0x97, 0xda, 0xaf, 0xe2,
+  0xb7, 0x6f, 0xa6, 0x3c, 0x9e, 0xdb, 0xa6, 0x1b, 0xbe, 0x79, 0x09, 0x9b, 0x7a, 0x88, 0xeb, 0xe1,
+  0xed, 0x9b, 0x39, 0x8f, 0x86, 0xec, 0x2d, 0x8a, 0xa7, 0x3c, 0x8c, 0xbf, 0x7b, 0x1f, 0x7c, 0x7c,
+  0xc9, 0xeb, 0x7c, 0xc8, 0xfd, 0xf2, 0xbb, 0x3e, 0xf4, 0xcb, 0xf8, 0x0d, 0xfe, 0xf8, 0x32, 0xf6,
+  0x71, 0xf7, 0x3e, 0xf2, 0x83, 0x7d, 0xa2, 0x6e, 0xbe, 0x01, 0x7f, 0xfc, 0x61, 0xc8, 0x87, 0x32,
+  0xfe, 0xd1, 0xcc, 0xeb, 0x55, 0x30, 0x5e, 0xd8, 0xa6, 0x4e, 0xf2, 0x74, 0xec, 0xfc, 0x21, 0x6f,
+  0xea, 0x1f, 0xc0, 0x2f, 0x6b, 0x7f, 0xfb, 0xdb, 0x0f, 0xfd, 0xb0, 0xee, 0x0f, 0x9f, 0xa2, 0xf8,
+  0xa7, 0xc0, 0x0f, 0xef, 0x69, 0xd7, 0x8c, 0x75, 0xf4, 0x5d, 0xd8, 0x94, 0x4d, 0xf7, 0xfd, 0x7f,
+  0x24, 0x89, 0xbf, 0x7f, 0x3e, 0xff, 0xfc, 0xf2, 0x29, 0xae, 0x7e, 0x4a, 0x76, 0x7e, 0xbe, 0xeb,
+  0xf3, 0x2d, 0xfe, 0x1e, 0xfa, 0x44, 0xc6, 0xd5, 0xe7, 0xaf, 0x30, 0x41, 0x00, 0xed, 0x9f, 0xcf,
+  0xad, 0x1f, 0x45, 0x79, 0x9d, 0x7e, 0x17, 0x34, 0xc3, 0xd0, 0x54, 0xdf, 0x43, 0xed, 0xf2, 0x44,
+  0x0b, 0x7f, 0x1a, 0xe2, 0x65, 0xf8, 0xce, 0x2f, 0xf3, 0xb4, 0xfe, 0xfe, 0x25, 0xdc, 0xc5, 0x89,
+  0xbb, 0x7d, 0x3e, 0xca, 0xa7, 0x8f, 0x79, 0xdd, 0x8e, 0xc3, 0xc7, 0x3e, 0x2e, 0xe3, 0x70, 0xf8,
+  0xe9, 0x2b, 0xf6, 0xf7, 0xf8, 0x8e, 0xf6, 0x1b, 0x1d, 0x78, 0xa7, 0xf2, 0xf3, 0xcb, 0x3b, 0xe0,
+  0x4f, 0xef, 0x72, 0x7f, 0x4f, 0xe1, 0xff, 0xb9, 0xcf, 0x7c, 0x45, 0xfa, 0x32, 0x05, 0x43, 0xd0,
+  0x7f, 0x7e, 0x05, 0xfa, 0xef, 0x61, 0x6d, 0xe3, 0xb7, 0x30, 0x8b, 0xc3, 0x7b, 0xd0, 0x2c, 0xff,
+  0xf3, 0x15, 0xc0, 0x1f, 0x87, 0xe6, 0xf3, 0xbb, 0x9e, 0xbe, 0x87, 0x3f, 0xe1, 0x9f, 0x2b, 0xbf,
+  0x4b, 0xf3, 0x7a, 0x47, 0x7b, 0xe7, 0x30, 0x68, 0xa2, 0xf5, 0xaf, 0x78, 0x7c, 0x67, 0x22, 0xf1,
+  0xab, 0xbc, 0x5c, 0xbf, 0x9f, 0xe2, 0x2e, 0xf2, 0xeb, 0xa7, 0x1a, 0x82, 0x71, 0x17, 0xae, 0xfe,
+  0x29, 0x68, 0xba, 0x28, 0xee, 0xbe, 0x87, 0x3e, 0x7f, 0x79, 0xf8, 0xae, 0xf3, 0xa3, 0x7c, 0xec,
+  0x77, 0xb5, 0xa0, 0xdd, 0xce, 0xf1, 0x3f, 0xab, 0x11, 0x26, 0x68, 0xf8, 0x78, 0xf8, 0xfc, 0xab,
+  0x52, 0x93, 0xcf, 0x65, 0x5e, 0xc7, 0xdf, 0x65, 0x71, 0x9e, 0x66, 0xc3, 0xf7, 0xc8, 0x27, 0xec,
+  0x89, 0xf6, 0x3b, 0xb1, 0x3f, 0x21, 0xcf, 0x89, 0xdf, 0xc4, 0xdb, 0x29, 0x27, 0x79, 0x5c, 0x46,
+  0x7d, 0x3c, 0xfc, 0xf4, 0x97, 0x24, 0xbf, 0xca, 0xf4, 0xf2, 0x2e, 0xd3, 0xdf, 0x7e, 0x00, 0xbf,
+  0x9c, 0xe9, 0x2f, 0x67, 0x3b, 0x3c, 0x4d, 0xe2, 0xa7, 0xaf, 0x30, 0xc8, 0x0e, 0xf3, 0xf2, 0xae,
+  0x92, 0x9f, 0x33, 0xf4, 0xf7, 0x92, 0xff, 0x72, 0x38, 0x9f, 0x42, 0xbf, 0x8b, 0x7e, 0xfa, 0xca,
+  0x1b, 0x8c, 0xfc, 0xb6, 0xfb, 0xbb, 0xc6, 0x7e, 0x87, 0x50, 0xc6, 0xc9, 0xf0, 0x07, 0x3d, 0xd1,
+  0xdd, 0x6e, 0x91, 0x5f, 0x75, 0xf2, 0x3d, 0xba, 0x93, 0xd9, 0xb5, 0xd0, 0x4c, 0xf1, 0x5f, 0x6b,
+  0x29, 0xca, 0xfb, 0xb6, 0xf4, 0xd7, 0xef, 0xf3, 0xfa, 0x5d, 0x17, 0x41, 0xd9, 0x84, 0xf7, 0x5f,
+  0x8c, 0xe8, 0x0b, 0xa9, 0x2a, 0xaf, 0xbf, 0x58, 0xfb, 0xf7, 0x08, 0xf1, 0x2e, 0xd8, 0x10, 0xfd,
+  0x6a, 0x27, 0xd0, 0xcb, 0x97, 0xf3, 0x7b, 0xb2, 0xe3, 0x77, 0xb1, 0xff, 0x53, 0x17, 0xbf, 0xab,
+  0x6e, 0x3f, 0xaa, 0x21, 0xdf, 0x8f, 0xfa, 0xf7, 0xca, 0xfb, 0xca, 0x3e, 0xf4, 0xf9, 0xab, 0x4c,
+  0x28, 0x4c, 0xee, 0xa8, 0xbf, 0xb7, 0xb8, 0x9d, 0xc9, 0x2e, 0x29, 0x9b, 0xf9, 0x8b, 0xa9, 0xfc,
+  0xfc, 0x1f, 0x21, 0xfc, 0x8b, 0xb9, 0x91, 0xff, 0xf9, 0x07, 0xc0, 0x9f, 0xff, 0x63, 0xf8, 0xdd,
+  0xd2, 0xae, 0xaa, 0xa6, 0xee, 0x9b, 0x5d, 0xb7, 0x7f, 0x29, 0xcc, 0x3f, 0xeb, 0xf6, 0x77, 0x8a,
+  0x7c, 0x81, 0x3e, 0xff, 0x46, 0xa2, 0xf2, 0x97, 0xef, 0x7e, 0x61, 0x98, 0x7c, 0x97, 0xeb, 0x93,
+  0xf0, 0xd3, 0x17, 0x6b, 0x49, 0xbb, 0x38, 0xae, 0xf7, 0xb1, 0xfe, 0x75, 0xdc, 0xc5, 0xd1, 0xcf,
+  0xbf, 0x3b, 0xdf, 0xb0, 0xcb, 0xdb, 0xe1, 0xc7, 0xbf, 0x4d, 0x7e, 0xf7, 0xb2, 0xbc, 0xd5, 0x63,
+  0x59, 0x7e, 0x2c, 0x87, 0x8f, 0x43, 0xf3, 0x71, 0x68, 0x3f, 0xb6, 0xe1, 0xdb, 0xeb, 0xeb, 0xe7,
+  0xe7, 0x4a, 0x5f, 0xbf, 0x41, 0x1f, 0xf3, 0x68, 0xff, 0x8a, 0xfb, 0x77, 0xa0, 0xcf, 0x7f, 0x4b,
+  0xc6, 0x3a, 0x7c, 0xfa, 0x81, 0x97, 0xe4, 0xdb, 0xf6, 0xc3, 0x4f, 0x4f, 0xa0, 0xf0, 0x63, 0xb3,
+  0xc3, 0x7f, 0x1c, 0x3e, 0x87, 0x65, 0xec, 0x77, 0x66, 0x5e, 0xc5, 0xcd, 0x38, 0x7c, 0x5b, 0x0e,
+  0x1f, 0x3e, 0x0f, 0x6f, 0x51, 0x13, 0x8e, 0xd5, 0x2e, 0xc2, 0xa7, 0x34, 0x1e, 0x8e, 0x65, 0xfc,
+  0x7c, 0x64, 0xd6, 0x53, 0xf4, 0xed, 0xeb, 0x00, 0xbf, 0x7e, 0xf8, 0x9c, 0xef, 0x7b, 0xbc, 0xbd,
+  0xc1, 0x1f, 0x7e, 0x0a, 0xff, 0x35, 0x60, 0xf8, 0x04, 0xdc, 0x09, 0xfc, 0x57, 0x08, 0xbf, 0xbd,
+  0x02, 0x71, 0x1d, 0x36, 0x51, 0x6c, 0xe9, 0x27, 0xb6, 0xa9, 0xda, 0xa6, 0xde, 0xa1, 0xbe, 0x0d,
+  0x3f, 0x4d, 0x7e, 0x39, 0xc6, 0x1f, 0x3e, 0x7f, 0x7d, 0x78, 0xf2, 0x3e, 0x7c, 0xda, 0xe5, 0x6b,
+  0xca, 0xd2, 0x6c, 0xda, 0x37, 0xea, 0xf9, 0xf9, 0xbc, 0x4b, 0xf2, 0xbb, 0xc9, 0xcf, 0x3f, 0xef,
+  0xa4, 0x7f, 0x37, 0xfe, 0xf1, 0xad, 0xaf, 0x3f, 0xfc, 0xb4, 0xcf, 0x2d, 0x7f, 0x7f, 0x17, 0xf3,
+  0xc3, 0x4f, 0xcb, 0x27, 0x7f, 0x37, 0xbe, 0xe1, 0xdb, 0x0f, 0x9f, 0x7f, 0xde, 0xd5, 0x13, 0xcf,
+  0x2f, 0x8e, 0x2c, 0x89, 0xc3, 0xd0, 0xea, 0xf1, 0x63, 0x8c, 0xfb, 0xe7, 0xfc, 0xf2, 0xa9, 0xa9,
+  0x77, 0xfb, 0x89, 0xd6, 0x7e, 0xf0, 0x87, 0x38, 0xcc, 0x76, 0xcf, 0x1c, 0xbf, 0xfd, 0xa2, 0x9d,
+  0x6f, 0xbf, 0xec, 0xf6, 0xe9, 0x1d, 0xc0, 0x78, 0x02, 0xbc, 0xbd, 0x61, 0xff, 0xf5, 0x5f, 0xcb,
+  0xa7, 0x27, 0xf0, 0xd8, 0xbf, 0xbd, 0x21, 0x10, 0xf4, 0x45, 0x7b, 0xfe, 0xdb, 0x13, 0xaa, 0xdf,
+  0x85, 0xe9, 0x63, 0x73, 0x3f, 0xf7, 0xa7, 0x52, 0xfe, 0x1e, 0xf7, 0x3b, 0x7e, 0xf4, 0xe6, 0x7f,
+  0xea, 0xc7, 0xa0, 0x1f, 0xba, 0x6f, 0xa1, 0x8f, 0xfe, 0xa7, 0xbc, 0x8e, 0xe2, 0x45, 0x4d, 0xbe,
+  0x7d, 0xfd, 0x7f, 0xeb, 0xd7, 0x0f, 0xbb, 0x6e, 0xbf, 0x48, 0x0b, 0xfc, 0x06, 0xf4, 0x27, 0x10,
+  0x00, 0xde, 0x79, 0xff, 0xb7, 0x8a, 0xd8, 0xa9, 0xed, 0x47, 0xfb, 0xf6, 0x45, 0xea, 0x78, 0x7a,
+  0xca, 0xfb, 0xf3, 0x53, 0xb4, 0x36, 0xae, 0xbf, 0x7d, 0x15, 0x8e, 0xe6, 0xeb, 0xc7, 0x57, 0x30,
+  0xec, 0xff, 0x11, 0x22, 0xbb, 0xf2, 0xf3, 0x08, 0xd8, 0xed, 0xa3, 0x7b, 0xea, 0x7a, 0x17, 0x24,
+  0xae, 0xa3, 0x27, 0xf4, 0x57, 0x76, 0xcb, 0xe1, 0x6d, 0xf7, 0x31, 0xbf, 0x1c, 0x7e, 0xf2, 0x11,
+  0x41, 0x31, 0xfc, 0xc3, 0xe7, 0x2e, 0x1e, 0xc6, 0x6e, 0x37, 0x15, 0xbf, 0xec, 0xe3, 0xdd, 0xbd,
+  0xfc, 0x6a, 0x3b, 0x71, 0xf9, 0x6d, 0xfc, 0x45, 0xfc, 0x7f, 0x63, 0x22, 0x1f, 0x83, 0xb7, 0x3f,
+  0x1d, 0xd3, 0x3b, 0xc7, 0x9f, 0x4a, 0xbf, 0x1f, 0x8e, 0xd3, 0x0e, 0x7a, 0x8a, 0x3e, 0xec, 0x8a,
+  0x02, 0xfe, 0x30, 0x03, 0xc0, 0xbf, 0x69, 0x27, 0xfe, 0x14, 0xf9, 0x83, 0x0f, 0x3c, 0x35, 0xf2,
+  0xc4, 0x0c, 0x3e, 0xfc, 0xf4, 0xef, 0x6d, 0xe3, 0xf7, 0x8c, 0x4e, 0x5f, 0x4e, 0xf2, 0xef, 0xf3,
+  0xae, 0xdb, 0x66, 0xfe, 0xf4, 0x4e, 0xc1, 0x68, 0xc6, 0x2e, 0xdc, 0xf9, 0xdf, 0x15, 0xf7, 0x45,
+  0xb2, 0x2f, 0x62, 0x7e, 0xfe, 0xf9, 0x79, 0x49, 0x76, 0x53, 0xf9, 0x1d, 0xd0, 0xb7, 0xaf, 0x60,
+  0xfc, 0x1c, 0xfd, 0xaa, 0xc1, 0x0f, 0x9f, 0xe3, 0xfe, 0xd3, 0xee, 0x17, 0xde, 0x61, 0xa4, 0xbc,
+  0xdf, 0xe3, 0x74, 0xdc, 0x7d, 0xfb, 0x5a, 0x36, 0xe9, 0xeb, 0xc7, 0xb8, 0xfc, 0x17, 0xab, 0x5f,
+  0x8c, 0xe6, 0xf5, 0xe3, 0xaf, 0xd6, 0xb5, 0x13, 0xef, 0xc7, 0x6f, 0xcf, 0x86, 0xaa, 0x7c, 0x6a,
+  0xfd, 0xae, 0x8f, 0xbf, 0xfd, 0x22, 0xe6, 0x6e, 0x16, 0x3f, 0xbf, 0x6f, 0xb1, 0xdf, 0x8c, 0xae,
+  0x6b, 0xba, 0xdf, 0x9b, 0xe3, 0x3e, 0x1b, 0x96, 0xcd, 0x0e, 0xfa, 0x04, 0xf8, 0xca, 0x77, 0xb2,
+  0x0f, 0xfa, 0xf6, 0x79, 0x8a, 0xfb, 0xe1, 0x7c, 0x95, 0xf0, 0xaf, 0x78, 0xf3, 0xa3, 0x9d, 0xf6,
+  0x87, 0xcf, 0xcf, 0xf0, 0xf0, 0xd5, 0x6d, 0xfc, 0xc1, 0x7f, 0xf4, 0x5f, 0x1d, 0x48, 0xbf, 0x07,
+  0xe5, 0xe9, 0xed, 0xa7, 0x9f, 0x3f, 0xf6, 0xd1, 0xdb, 0x7f, 0xbf, 0xd6, 0x4d, 0xde, 0xc7, 0xbb,
+  0xf9, 0x24, 0x5d, 0xfc, 0xd8, 0xff, 0x04, 0xf3, 0xf3, 0xab, 0x7b, 0x4e, 0xec, 0xbb, 0xbd, 0x76,
+  0x7d, 0x9f, 0xef, 0x7f, 0xfa, 0xfa, 0x7d, 0x66, 0xe7, 0xf6, 0xf5, 0x7f, 0x7e, 0xe7, 0x5b, 0x76,
+  0x36, 0xef, 0x1f, 0x7e, 0xfa, 0x6a, 0x3d, 0xff, 0xd2, 0x40, 0xfa, 0xff, 0xf3, 0x0a, 0xdc, 0x3f,
+  0xfc, 0xde, 0xae, 0xfa, 0xfe, 0xdb, 0xfb, 0xc7, 0xe9, 0x8b, 0x65, 0xc5, 0x6f, 0xef, 0xbb, 0xbc,
+  0xdb, 0xcb, 0x87, 0x78, 0xbf, 0x1b, 0xbb, 0x30, 0xa2, 0x29, 0x4b, 0x6f, 0xd3, 0x1f, 0x30, 0xba,
+  0x1d, 0xa3, 0xa9, 0xff, 0x12, 0x65, 0x57, 0xed, 0x4e, 0x4b, 0xd9, 0x1d, 0xce, 0xa7, 0x77, 0xb7,
+  0xf9, 0xe9, 0xab, 0xb3, 0x7e, 0x6b, 0xea, 0x7f, 0xbc, 0xbe, 0x7e, 0xbf, 0x4b, 0x58, 0xc7, 0xaf,
+  0x7f, 0xd8, 0xac, 0xfa, 0x76, 0xfa, 0xd8, 0xdc, 0x3f, 0xde, 0x9b, 0x5f, 0x99, 0x9f, 0xfe, 0xf1,
+  0xcd, 0x0f, 0x7d, 0xeb, 0xd7, 0x2f, 0xe1, 0x6e, 0xa0, 0xfd, 0xdb, 0xab, 0xf0, 0xfa, 0xe3, 0x37,
+  0x40, 0x73, 0x07, 0xbe, 0xd9, 0x75, 0xb9, 0x4f, 0xff, 0xf8, 0xcd, 0xf7, 0x7f, 0x5c, 0xd7, 0x9f,
+  0xeb, 0xf7, 0xe6, 0xb7, 0xf5, 0x3f, 0xec, 0x3f, 0x7e, 0x1b, 0x7d, 0xe1, 0x74, 0x77, 0xe8, 0xfe,
+  0x5b, 0xf4, 0xa9, 0xda, 0x79, 0x7b, 0x7b, 0x7b, 0x95, 0x1a, 0xdd, 0x7f, 0xfd, 0xbc, 0x8b, 0xf2,
+  0x3a, 0xe7, 0xc9, 0x53, 0xad, 0xef, 0x7f, 0xf6, 0xcc, 0xe6, 0x65, 0xb7, 0xb7, 0xe7, 0x74, 0x9f,
+  0xbc, 0x7e, 0x7c, 0xa2, 0x7c, 0x19, 0x85, 0xdd, 0xef, 0x47, 0xcf, 0x33, 0xf9, 0xfb, 0x6f, 0xc3,
+  0xe7, 0xe9, 0x7c, 0x1d, 0xfe, 0x2d, 0x69, 0xba, 0x6f, 0x9f, 0xd4, 0xee, 0x5f, 0xb6, 0x7a, 0xa7,
+  0x3c, 0xbd, 0x45, 0xff, 0x7d, 0xff, 0x9f, 0x8f, 0xc5, 0xdb, 0xbb, 0xf5, 0xed, 0x7e, 0x67, 0x8f,
+  0x70, 0x79, 0xb2, 0x7e, 0x3b, 0xbd, 0xab, 0xad, 0x9f, 0xf6, 0xc5, 0xdd, 0x9d, 0x14, 0x1f, 0x9e,
+  0x39, 0x68, 0x5e, 0x8f, 0xf1, 0xe7, 0x2f, 0x53, 0xc5, 0xe7, 0xbf, 0xed, 0xcb, 0xf7, 0x9d, 0xd9,
+  0xb6, 0xe9, 0x5f, 0xbf, 0x06, 0x8e, 0x7f, 0x7d, 0xf7, 0xe7, 0xaa, 0xf7, 0x87, 0x77, 0xc8, 0xdd,
+  0xad, 0xef, 0x8e, 0x85, 0x1e, 0x76, 0x42, 0x7b, 0x0e, 0xb5, 0x5f, 0xa8, 0x70, 0x79, 0xfd, 0x38,
+  0xfd, 0x37, 0xf4, 0x3f, 0xff, 0x0f, 0x02, 0xa0, 0x7f, 0xb1, 0xba, 0x3e, 0x57, 0xe1, 0xaf, 0xab,
+  0x3f, 0xff, 0x2d, 0xde, 0xed, 0xfc, 0xe5, 0x2b, 0xe5, 0xea, 0x31, 0x0c, 0xaf, 0x1f, 0xde, 0x6d,
+  0xe4, 0xfd, 0xa4, 0x5e, 0x59, 0x55, 0x51, 0x8e, 0xac, 0x79, 0xe4, 0x76, 0x95, 0x29, 0xaa, 0xf9,
+  0xf2, 0xdb, 0x78, 0xbf, 0x49, 0x7f, 0x40, 0x7d, 0x66, 0x20, 0xcd, 0x1f, 0x70, 0xf5, 0x23, 0xcd,
+  0xb9, 0x5f, 0xf1, 0xbe, 0x3c, 0xff, 0x19, 0x27, 0xec, 0xc2, 0xaf, 0x18, 0xd3, 0x3f, 0x5e, 0x59,
+  0x9d, 0x7d, 0x39, 0xea, 0xba, 0xaa, 0xff, 0x7d, 0x37, 0x9c, 0xd7, 0x5f, 0x20, 0xbf, 0xec, 0x17,
+  0xfd, 0xea, 0xb8, 0xef, 0x1f, 0x7e, 0x7c, 0x83, 0xfe, 0xa1, 0x8c, 0x55, 0xb0, 0x5f, 0xbc, 0xe9,
+  0xc3, 0xa7, 0xa1, 0xe1, 0xf3, 0x25, 0x8e, 0xbe, 0x45, 0x3e, 0x7c, 0x3f, 0x7d, 0xf8, 0x83, 0x63,
+  0x7a, 0x5e, 0xdb, 0x9f, 0xfe, 0x10, 0x70, 0xfb, 0xe1, 0xcb, 0x09, 0xfc, 0x1a, 0xc2, 0xfa, 0xdf,
+  0xc5, 0xb0, 0xfe, 0x5f, 0x04, 0xb1, 0xfe, 0xff, 0x43, 0x14, 0xeb, 0xff, 0x14, 0xc6, 0x7e, 0x99,
+  0xfc, 0x43, 0x28, 0xfb, 0xa3, 0x3b, 0xea, 0xff, 0x18, 0xd3, 0x3e, 0xfc, 0x16, 0x27, 0xfa, 0x3f,
+  0xc4, 0x89, 0xbe, 0xfd, 0x88, 0xef, 0x25, 0xc0, 0x7b, 0xd0, 0xe9, 0xff, 0x14, 0x75, 0xfc, 0x36,
+  0x07, 0x7f, 0x71, 0x7c, 0x5f, 0x82, 0x4e, 0xff, 0x5b, 0xd4, 0xf9, 0x77, 0xde, 0xaa, 0x6f, 0xff,
+  0xe8, 0xae, 0xc0, 0x2f, 0xd5, 0xd2, 0x33, 0x67, 0xdf, 0x47, 0x7b, 0x11, 0xf1, 0xf2, 0x7e, 0xa3,
+  0xdf, 0x5e, 0xff, 0x22, 0xd5, 0xfa, 0x53, 0xf2, 0xf8, 0xfa, 0x05, 0xe1, 0xc7, 0x1f, 0xf2, 0x2a,
+  0x7d, 0xf9, 0xc5, 0x03, 0xbc, 0xe6, 0x75, 0x16, 0x77, 0xf9, 0xf0, 0xba, 0x3b, 0x90, 0x3d, 0x5b,
+  0x7a, 0x3a, 0xdf, 0xef, 0xf3, 0xca, 0x4f, 0x63, 0xb0, 0xad, 0xd3, 0x3d, 0x8f, 0xef, 0x63, 0x02,
+  0xfb, 0x98, 0xdf, 0x18, 0x55, 0x9f, 0xa1, 0x8b, 0x90, 0x36, 0xf4, 0xfe, 0x51, 0x0c, 0x2b, 0x3b,
+  0x5a, 0xe9, 0xfe, 0x64, 0xba, 0xfb, 0x17, 0x7b, 0x63, 0xe9, 0xe7, 0x5f, 0xce, 0xb8, 0x52, 0x5e,
+  0xf4, 0x04, 0x60, 0x1d, 0xe6, 0x64, 0x3b, 0x32, 0x4d, 0x33, 0x87, 0x6c, 0x1f, 0xc6, 0xd8, 0x95,
+  0xd7, 0xaf, 0x8e, 0x23, 0x3e, 0xd7, 0x04, 0x47, 0xe7, 0x6d, 0x51, 0x37, 0x03, 0xc4, 0x83, 0x22,
+  0x84, 0x5f, 0xbd, 0x2b, 0x83, 0x46, 0x68, 0x38, 0xfa, 0x36, 0xde, 0x85, 0x88, 0x92, 0x85, 0x82,
+  0x35, 0x06, 0xe8, 0xb9, 0xae, 0x00, 0x8c, 0x14, 0x76, 0x1a, 0x27, 0x9a, 0x39, 0xeb, 0x47, 0xde,
+  0x8a, 0xcf, 0xdb, 0x50, 0x3b, 0x95, 0x2b, 0x5a, 0x36, 0x9e, 0x51, 0x94, 0xd7, 0xa7, 0xd1, 0x89,
+  0x67, 0x8f, 0xc7, 0xfe, 0xc0, 0x9e, 0x52, 0xb9, 0xc9, 0x2f, 0x97, 0xfe, 0x62, 0xdd, 0x8e, 0x0c,
+  0xbc, 0x4e, 0x0e, 0x7d, 0x6a, 0x8a, 0x8a, 0x64, 0x78, 0xc4, 0x72, 0xc2, 0xab, 0xac, 0x47, 0x64,
+  0x7c, 0x01, 0x66, 0xc6, 0xd2, 0x9d, 0x0b, 0x8e, 0x59, 0x06, 0xcd, 0x36, 0xf9, 0xba, 0xe6, 0x06,
+  0xcb, 0xf6, 0x77, 0x85, 0x35, 0xe8, 0x4c, 0x3a, 0xd3, 0xb5, 0x27, 0x43, 0x65, 0x85, 0x4f, 0x87,
+  0x45, 0xc5, 0x92, 0xb6, 0xf2, 0xb6, 0xb1, 0x1b, 0x89, 0x07, 0x31, 0xe2, 0x9b, 0xd9, 0xa1, 0x1a,
+  0xb9, 0xa1, 0xe7, 0xed, 0xbc, 0x3e, 0xc0, 0xee, 0x41, 0x00, 0xdb, 0x74, 0xbb, 0x45, 0x24, 0x9b,
+  0xba, 0x34, 0x0e, 0xce, 0xbd, 0x5c, 0xb2, 0xb9, 0x86, 0x53, 0xe6, 0x21, 0x10, 0x58, 0xcf, 0xa3,
+  0x20, 0x9b, 0x3e, 0x85, 0x2e, 0xd1, 0xc9, 0xa0, 0xcc, 0xc5, 0xe5, 0x84, 0x3a, 0xf4, 0x56, 0xd4,
+  0x1a, 0xb5, 0x42, 0x02, 0x78, 0x05, 0x1c, 0x1e, 0x63, 0xb4, 0xb3, 0x76, 0xc5, 0x8f, 0x68, 0xa1,
+  0x36, 0x67, 0xe0, 0x36, 0xd3, 0x16, 0x1e, 0x69, 0xd8, 0xc3, 0x1b, 0xa2, 0xe6, 0xe4, 0x30, 0xc7,
+  0x62, 0xc2, 0xb8, 0xf4, 0x96, 0xfb, 0x70, 0xc0, 0x29, 0x12, 0x94, 0x83, 0xe8, 0x32, 0x3d, 0xc8,
+  0x05, 0xe5, 0xc0, 0x0a, 0xe3, 0xd4, 0xfa, 0x12, 0x1e, 0x30, 0x6a, 0x23, 0x26, 0xea, 0x74, 0x6d,
+  0x29, 0xc7, 0x8b, 0xb3, 0xda, 0xbc, 0x12, 0x54, 0x89, 0x04, 0x0d, 0x08, 0x3e, 0xa0, 0xad, 0x6b,
+  0x56, 0xb1, 0xd8, 0xae, 0x68, 0x36, 0xb3, 0xd3, 0xa5, 0x43, 0x40, 0xc0, 0xa1, 0x2f, 0xf5, 0xd5,
+  0xac, 0xc8, 0xec, 0xd4, 0x48, 0x9a, 0x1d, 0xe5, 0xd5, 0x8c, 0x74, 0x4c, 0x24, 0x6d, 0x2c, 0x01,
+  0x57, 0xd8, 0x99, 0x54, 0xa1, 0x30, 0x7e, 0x90, 0x4c, 0xd4, 0x14, 0xa4, 0x06, 0xd5, 0xb6, 0xde,
+  0x1c, 0x9c, 0x1b, 0x25, 0xc3, 0x5d, 0x08, 0x3f, 0x30, 0x5e, 0x4c, 0x59, 0x92, 0x36, 0x99, 0xa9,
+  0x21, 0x19, 0x60, 0x16, 0x8a, 0xcb, 0x23, 0x72, 0x08, 0x79, 0xa1, 0xdb, 0x94, 0xdd, 0x68, 0x0d,
+  0xb8, 0xc7, 0x30, 0x14, 0xeb, 0x81, 0x3b, 0x58, 0x22, 0xe8, 0x63, 0x1c, 0x80, 0xd4, 0x42, 0x03,
+  0x06, 0x2b, 0x49, 0x8d, 0x24, 0x8b, 0xc9, 0x13, 0x3d, 0x99, 0x3c, 0x25, 0xa5, 0x1e, 0x42, 0x5b,
+  0xee, 0x4c, 0x9d, 0x1f, 0xf4, 0xa1, 0x91, 0x6f, 0x83, 0x83, 0xd9, 0xf4, 0x40, 0x1e, 0x83, 0xbe,
+  0x6a, 0xc2, 0x15, 0x9c, 0xf3, 0x26, 0x8b, 0x09, 0xa4, 0x23, 0x60, 0xa2, 0x4e, 0x64, 0x54, 0xa5,
+  0x49, 0x8c, 0x13, 0xe5, 0x29, 0x98, 0xb2, 0x5b, 0xc8, 0x1e, 0x66, 0x47, 0x65, 0xd8, 0x5d, 0x4d,
+  0xe0, 0xe6, 0x34, 0x08, 0x70, 0x17, 0x30, 0x7e, 0x57, 0x11, 0x10, 0x71, 0xcb, 0xaa, 0xb5, 0xc3,
+  0x25, 0x28, 0x1f, 0xe7, 0xf6, 0x74, 0xaa, 0x9b, 0x42, 0x80, 0x85, 0xa5, 0x0b, 0xc0, 0xbc, 0x33,
+  0xa3, 0xd3, 0x5d, 0x3d, 0x98, 0x86, 0x34, 0x90, 0xfd, 0xc1, 0xed, 0x0b, 0xba, 0x0d, 0xbb, 0xed,
+  0xc0, 0x6e, 0x59, 0x5c, 0x9e, 0x12, 0x37, 0x14, 0x83, 0x55, 0x13, 0x88, 0x24, 0xf3, 0xf0, 0x13,
+  0x4a, 0x01, 0x33, 0xa1, 0x86, 0xda, 0xdd, 0xc1, 0xc7, 0x05, 0x84, 0xee, 0x84, 0x3b, 0xea, 0x60,
+  0x45, 0xe6, 0x28, 0xb9, 0xdd, 0x54, 0x83, 0xe4, 0xb5, 0xa6, 0x89, 0x33, 0x21, 0x39, 0x2b, 0x2b,
+  0x3a, 0xea, 0x33, 0xc8, 0x45, 0x18, 0x8b, 0xd2, 0x14, 0xc2, 0xd7, 0x77, 0x21, 0x3d, 0x86, 0xc2,
+  0x0c, 0x18, 0xb7, 0x07, 0xa2, 0x12, 0x67, 0x50, 0x03, 0x44, 0xae, 0x01, 0xf5, 0x74, 0x99, 0x38,
+  0x25, 0xb5, 0x87, 0x95, 0x72, 0x0e, 0xea, 0x70, 0xf3, 0x7b, 0x88, 0x8f, 0x73, 0xc4, 0xeb, 0x69,
+  0xa4, 0x50, 0x82, 0x72, 0x14, 0x13, 0x3b, 0xae, 0x8e, 0x68, 0xaa, 0x85, 0xac, 0xed, 0xdf, 0xba,
+  0x36, 0x9e, 0xd0, 0xd4, 0x96, 0xac, 0xce, 0x76, 0xd6, 0x3b, 0xbb, 0xe8, 0xb2, 0x5c, 0xc1, 0x40,
+  0x9e, 0x55, 0xf0, 0x44, 0x1d, 0x1b, 0x24, 0xe5, 0x89, 0x33, 0x85, 0x32, 0x50, 0x71, 0x3e, 0x9c,
+  0x64, 0x7b, 0x96, 0x05, 0x92, 0xd5, 0xef, 0xc1, 0xc1, 0xa6, 0xb9, 0xc1, 0xa7, 0xd2, 0xd8, 0x9f,
+  0xb5, 0x99, 0x82, 0x46, 0xb2, 0xe5, 0xa6, 0x4e, 0x5e, 0xae, 0x45, 0x7a, 0xda, 0x8c, 0x58, 0x9f,
+  0xc6, 0xab, 0x36, 0x72, 0x60, 0xaa, 0x84, 0xb7, 0xd0, 0xb9, 0x30, 0xa7, 0xab, 0xc9, 0xe1, 0x6d,
+  0xd2, 0xc8, 0xe0, 0x75, 0x1d, 0x54, 0xef, 0x06, 0x82, 0xe5, 0x88, 0x4a, 0xdb, 0x48, 0x59, 0x26,
+  0x31, 0x70, 0xb7, 0x5e, 0xd6, 0x8c, 0x1b, 0x45, 0x1f, 0xfa, 0xc8, 0xdc, 0x82, 0xd0, 0x01, 0x70,
+  0x84, 0xa6, 0x22, 0x90, 0xdd, 0xc9, 0xe5, 0x2a, 0xce, 0xb6, 0xc5, 0x03, 0x58, 0xaf, 0x9c, 0xb4,
+  0x9c, 0x9e, 0x7c, 0x09, 0xc2, 0xc1, 0x5f, 0x7c, 0x49, 0x20, 0xc1, 0x6e, 0x2a, 0x44, 0x7d, 0x2d,
+  0xce, 0xd4, 0x25, 0x61, 0x49, 0x19, 0x11, 0x6c, 0xa8, 0x87, 0xb5, 0x9e, 0x9c, 0x89, 0xcb, 0x24,
+  0xea, 0x79, 0xd8, 0xde, 0x3a, 0x85, 0xe6, 0x26, 0x53, 0xa3, 0x2e, 0x57, 0xd3, 0xe5, 0x93, 0x06,
+  0x73, 0xc0, 0x1b, 0x71, 0x23, 0xe1, 0x3c, 0x14, 0x1b, 0x7c, 0x9a, 0x30, 0x58, 0xbf, 0x87, 0x81,
+  0xc8, 0xdb, 0xba, 0x83, 0x83, 0x64, 0xc3, 0x16, 0x87, 0xfd, 0x76, 0x0b, 0x8a, 0x9d, 0xdd, 0x2c,
+  0xd9, 0x09, 0x26, 0xe2, 0xd4, 0x31, 0x9e, 0x11, 0x74, 0x47, 0xd2, 0xd4, 0xb9, 0xc8, 0x5c, 0x9d,
+  0x44, 0x1e, 0x78, 0x34, 0xe4, 0x34, 0x41, 0x99, 0xf7, 0xeb, 0x12, 0x61, 0xd0, 0xf1, 0xb1, 0x15,
+  0xd2, 0xac, 0xc7, 0x07, 0x20, 0xcd, 0x42, 0xa6, 0x1f, 0x4e, 0x30, 0xa5, 0x81, 0xad, 0x6d, 0x57,
+  0xa2, 0x87, 0xe3, 0xb7, 0x06, 0x22, 0x2e, 0x1e, 0x41, 0x07, 0x08, 0x9d, 0x62, 0xc7, 0xb6, 0xdd,
+  0xdd, 0x59, 0x26, 0x4e, 0x57, 0x1a, 0x0c, 0x9c, 0xeb, 0x4a, 0x70, 0xe7, 0xdc, 0x88, 0x48, 0x57,
+  0x20, 0x15, 0xaa, 0x91, 0x93, 0x1a, 0x2a, 0x54, 0x74, 0xb5, 0x2e, 0x96, 0x67, 0xe3, 0x48, 0x77,
+  0x3a, 0xec, 0x37, 0x27, 0xb6, 0x96, 0x38, 0x3f, 0x53, 0xa3, 0x97, 0x2f, 0xb0, 0x5b, 0x3f, 0x00,
+  0x3e, 0x5e, 0x27, 0xe8, 0x12, 0x0b, 0x76, 0x09, 0x2a, 0xf3, 0x6d, 0xe2, 0xdb, 0x83, 0x80, 0x09,
+  0x04, 0xff, 0x30, 0xe7, 0xb3, 0x73, 0x5a, 0xc9, 0xcc, 0x09, 0xf9, 0x25, 0x77, 0xa0, 0x69, 0xab,
+  0xe7, 0x73, 0x61, 0x44, 0xb5, 0x75, 0x43, 0xdc, 0x2d, 0xd4, 0x80, 0xa8, 0x81, 0xe8, 0x39, 0x5e,
+  0x31, 0x3d, 0x39, 0xc2, 0xd7, 0x95, 0x6a, 0xfc, 0xe1, 0x84, 0x96, 0x15, 0x50, 0xd8, 0xc2, 0xa6,
+  0xda, 0xb8, 0xfd, 0xa8, 0x0a, 0x77, 0xb8, 0xbb, 0xfb, 0xad, 0xd4, 0x4e, 0x36, 0xc2, 0x24, 0x39,
+  0xa2, 0x41, 0xfa, 0xe9, 0x90, 0x41, 0x1d, 0x33, 0xac, 0x11, 0xe3, 0x40, 0x77, 0xaa, 0xf2, 0xb5,
+  0xe1, 0xc2, 0xf4, 0xc0, 0xc4, 0xa3, 0xb9, 0x72, 0x3d, 0x40, 0x06, 0x61, 0x31, 0x6a, 0x44, 0xb8,
+  0x82, 0x97, 0xd5, 0x7e, 0x33, 0x1c, 0x02, 0xb2, 0x2b, 0x8a, 0x54, 0x56, 0x69, 0x82, 0xa2, 0x79,
+  0xc5, 0xac, 0x11, 0x2b, 0x33, 0x56, 0xab, 0xba, 0x55, 0xcd, 0xee, 0xee, 0xf5, 0xa9, 0x03, 0x8f,
+  0x4b, 0x96, 0xd4, 0xd5, 0x1e, 0xb0, 0xf6, 0x73, 0xd6, 0x6f, 0x3c, 0x3f, 0xcf, 0x1e, 0xc7, 0x53,
+  0x0e, 0x98, 0x99, 0xc1, 0x40, 0x0e, 0xb4, 0x49, 0x84, 0x71, 0xe9, 0x5e, 0x15, 0xc5, 0x19, 0x5b,
+  0xaa, 0x23, 0x45, 0xf9, 0x2a, 0x5a, 0xb9, 0x47, 0xe1, 0xc4, 0x48, 0x92, 0x38, 0x9c, 0xd7, 0xcb,
+  0xcc, 0x44, 0x85, 0x57, 0x1a, 0x76, 0x23, 0x26, 0x45, 0x89, 0x16, 0x57, 0x77, 0x89, 0xa1, 0xae,
+  0x8a, 0x72, 0x4c, 0x71, 0x53, 0xf4, 0x10, 0x3e, 0xc8, 0x16, 0xb8, 0x6f, 0xe8, 0x63, 0x6a, 0x34,
+  0xc7, 0xe6, 0x4e, 0xca, 0x4e, 0x3d, 0x39, 0xf7, 0x27, 0x98, 0x3d, 0x59, 0x20, 0x3c, 0x01, 0x11,
+  0x9c, 0x02, 0xbb, 0x22, 0x55, 0xd1, 0xef, 0x4f, 0x47, 0x92, 0x1f, 0x3b, 0x0a, 0x85, 0x54, 0x82,
+  0x36, 0xb1, 0x92, 0x9c, 0xea, 0xc3, 0x2a, 0x1d, 0x8e, 0x77, 0x7d, 0x34, 0x47, 0xc9, 0x03, 0x3c,
+  0x6d, 0xbd, 0xd8, 0x4a, 0x11, 0xf2, 0xd8, 0x8d, 0x6a, 0xd5, 0x1a, 0xe2, 0x38, 0xb6, 0xa2, 0x45,
+  0x64, 0x75, 0x05, 0xc9, 0x22, 0xea, 0xb3, 0x6d, 0x98, 0x1d, 0x71, 0xca, 0x72, 0x24, 0x3a, 0x9f,
+  0xf6, 0x3b, 0x40, 0x33, 0xf7, 0x80, 0x9c, 0x76, 0x57, 0x07, 0xee, 0x57, 0xe9, 0xb9, 0x3f, 0xd7,
+  0x0b, 0x10, 0x23, 0x9d, 0x9a, 0x10, 0xa3, 0xe4, 0x73, 0x4d, 0x41, 0x97, 0xcc, 0xb9, 0x2a, 0x8d,
+  0x1a, 0xe5, 0xd1, 0x0c, 0x12, 0x8a, 0x7a, 0xdd, 0x5a, 0x0e, 0xa0, 0x37, 0xe2, 0xc8, 0x48, 0xf8,
+  0x79, 0xc4, 0x8e, 0xd3, 0xa9, 0x5d, 0xe1, 0xf3, 0xb0, 0x41, 0x12, 0x9c, 0x8f, 0x67, 0xe9, 0xe8,
+  0x0d, 0xf4, 0x19, 0x0d, 0x52, 0xff, 0xd6, 0x10, 0x4d, 0x94, 0x22, 0xca, 0xf9, 0x2c, 0x23, 0x33,
+  0xbd, 0x1b, 0x29, 0x89, 0xb7, 0x21, 0x5e, 0x0c, 0x47, 0xd3, 0x8f, 0x41, 0xae, 0xa7, 0x79, 0xf2,
+  0x22, 0x5e, 0x64, 0xa7, 0x62, 0x6b, 0xa6, 0x05, 0xdb, 0xab, 0x20, 0xdc, 0xa8, 0x10, 0x88, 0x70,
+  0xa8, 0x72, 0x38, 0x33, 0x3f, 0x51, 0x4a, 0x0c, 0x20, 0x38, 0x9d, 0x18, 0xf0, 0x3d, 0x9c, 0x15,
+  0x76, 0x2e, 0x46, 0x31, 0x9f, 0x33, 0xcd, 0x67, 0xdc, 0x50, 0x9f, 0x08, 0xdf, 0x3e, 0x9f, 0x46,
+  0x26, 0xb0, 0xba, 0x2b, 0x3c, 0x27, 0x4c, 0x7f, 0xb9, 0xed, 0x87, 0x9f, 0x57, 0x32, 0x57, 0x48,
+  0xc2, 0x95, 0x8b, 0x6b, 0xed, 0xe8, 0x6a, 0x9e, 0x80, 0x4c, 0xe9, 0x1c, 0x70, 0x9c, 0x43, 0x83,
+  0x08, 0xc7, 0xdd, 0xa8, 0x93, 0x79, 0xaa, 0x29, 0x30, 0xbf, 0xf0, 0x0c, 0x15, 0xe1, 0x98, 0x9a,
+  0x30, 0xd3, 0x3d, 0x03, 0x88, 0x07, 0xbe, 0xa7, 0x64, 0x51, 0xdd, 0x67, 0xe2, 0xd2, 0x66, 0xe3,
+  0x80, 0xb2, 0xa4, 0x33, 0xb4, 0xac, 0xad, 0x47, 0xbe, 0x8b, 0x38, 0xc7, 0x6e, 0x9b, 0xf6, 0xd0,
+  0x25, 0x0b, 0x5b, 0x5b, 0x31, 0x29, 0x22, 0xa8, 0x8d, 0x4f, 0x1a, 0x19, 0xd7, 0x23, 0xec, 0x1d,
+  0xd2, 0x95, 0x96, 0xa0, 0xd4, 0xd9, 0xb4, 0xa5, 0xe6, 0x82, 0x94, 0x90, 0x85, 0xd0, 0x8f, 0xf4,
+  0x50, 0x3b, 0x40, 0xc3, 0x50, 0x9a, 0xda, 0x2d, 0xa7, 0x0c, 0x7d, 0x46, 0x6c, 0x30, 0xe0, 0xe3,
+  0xeb, 0x46, 0x52, 0xf7, 0x13, 0xa0, 0x5b, 0xf1, 0xe2, 0xf9, 0xf7, 0x43, 0xcf, 0x9a, 0x56, 0x3c,
+  0x5d, 0x35, 0x0c, 0xaf, 0xa1, 0xd3, 0xb6, 0xb8, 0xd0, 0x46, 0x15, 0x3d, 0x9f, 0x39, 0x01, 0x04,
+  0xc7, 0xfa, 0x63, 0x6d, 0xe1, 0x33, 0xdc, 0x1d, 0x61, 0xbf, 0xb6, 0xf0, 0xce, 0x2e, 0x78, 0x4d,
+  0xa7, 0x65, 0x7b, 0x7b, 0x54, 0x59, 0x05, 0xdd, 0xc3, 0x92, 0x18, 0x92, 0xcd, 0x97, 0x7c, 0xe8,
+  0xa6, 0xb5, 0x67, 0x58, 0xdb, 0xed, 0x6f, 0x8e, 0x55, 0xdd, 0x25, 0x60, 0xf6, 0x71, 0x6e, 0x98,
+  0xee, 0xd4, 0x81, 0xe0, 0x58, 0x85, 0x91, 0x33, 0x1a, 0xdc, 0x99, 0xa3, 0xee, 0x0a, 0xce, 0x0f,
+  0x48, 0x91, 0xb3, 0x57, 0x2f, 0x54, 0x20, 0x2c, 0x22, 0x35, 0x87, 0x19, 0xba, 0x1b, 0x62, 0x07,
+  0x31, 0xba, 0xdc, 0xe4, 0xe8, 0x36, 0xb7, 0x37, 0x5d, 0xd8, 0x43, 0x54, 0x2a, 0x0a, 0x1e, 0x23,
+  0xab, 0x76, 0xf1, 0x28, 0x33, 0x7a, 0xab, 0x2f, 0x30, 0x1e, 0x5f, 0x6e, 0x8f, 0x0b, 0x1f, 0x33,
+  0x0a, 0x71, 0xea, 0x93, 0x39, 0x88, 0x52, 0x5a, 0x6a, 0xc8, 0xf0, 0x00, 0x1f, 0xd2, 0x51, 0x2e,
+  0xb4, 0x10, 0x2a, 0x10, 0x1f, 0x75, 0x84, 0x25, 0x2f, 0x32, 0x47, 0x99, 0x39, 0x25, 0x03, 0x37,
+  0x94, 0x67, 0xa3, 0x99, 0xe7, 0xef, 0x26, 0x7c, 0x24, 0x1d, 0xd5, 0xcf, 0x4f, 0xda, 0x50, 0x85,
+  0x35, 0x88, 0xd1, 0x2a, 0x21, 0xdb, 0xe5, 0x7e, 0xf6, 0xd2, 0xfc, 0xb8, 0x57, 0x9c, 0x0b, 0xf5,
+  0x65, 0x8e, 0xd0, 0xf4, 0x98, 0xa3, 0x1b, 0xc0, 0xf6, 0x4a, 0x41, 0xed, 0xe6, 0xc0, 0x0b, 0xa2,
+  0x7b, 0x7e, 0x08, 0x61, 0x38, 0xdd, 0x0a, 0xb8, 0x81, 0x17, 0x71, 0x93, 0xd4, 0xcc, 0xa1, 0x55,
+  0xf2, 0x0a, 0xda, 0x6a, 0xbf, 0x25, 0x59, 0x10, 0x31, 0x1c, 0x21, 0x49, 0x0c, 0x38, 0xd8, 0x9b,
+  0x04, 0xdc, 0xd6, 0x5d, 0x3e, 0x5c, 0xe9, 0x1b, 0xf9, 0x2c, 0x98, 0xec, 0x36, 0x6b, 0xf0, 0x6c,
+  0x72, 0xe5, 0x1d, 0xb7, 0xe7, 0x83, 0x8b, 0x93, 0x19, 0x32, 0x0c, 0x5b, 0xed, 0x36, 0x47, 0x58,
+  0xc3, 0x35, 0x85, 0x17, 0x38, 0x9f, 0xbe, 0x52, 0xf5, 0xec, 0xf4, 0x84, 0xc9, 0x9a, 0x77, 0x07,
+  0x83, 0x8a, 0x58, 0xd6, 0x72, 0xdf, 0x35, 0xc1, 0xe9, 0xcc, 0x4f, 0x00, 0xb9, 0xe7, 0x2a, 0x99,
+  0xda, 0x10, 0x68, 0x73, 0x49, 0xaa, 0x5b, 0x6b, 0x95, 0x0f, 0x21, 0x18, 0xf5, 0xfb, 0xf9, 0x79,
+  0x3d, 0xba, 0x93, 0xab, 0x60, 0x17, 0xfd, 0x54, 0x91, 0xd1, 0xd9, 0x59, 0x83, 0x47, 0xee, 0xac,
+  0xc0, 0x65, 0xb7, 0x06, 0xf2, 0x3c, 0x9d, 0x42, 0x8f, 0xa2, 0x09, 0x00, 0xe1, 0x43, 0xb6, 0x5b,
+  0x38, 0x4a, 0x27, 0x37, 0xc5, 0x1f, 0x8b, 0x9e, 0x9b, 0xd2, 0x0d, 0xa1, 0xc3, 0xe1, 0x0c, 0xce,
+  0xda, 0x39, 0x4c, 0x62, 0x2e, 0x78, 0x30, 0x0e, 0x60, 0xc6, 0xb1, 0xeb, 0x2a, 0x85, 0xb1, 0xda,
+  0x9a, 0x3b, 0xb6, 0xf4, 0x41, 0x0f, 0xd0, 0x48, 0x35, 0xaa, 0xe4, 0xb0, 0x5f, 0xdd, 0xe1, 0x5e,
+  0x70, 0x54, 0x23, 0x9e, 0xc2, 0x00, 0xac, 0x01, 0x84, 0xd1, 0x23, 0x2c, 0x2d, 0x8e, 0xdb, 0x01,
+  0x8d, 0x75, 0xe3, 0x5a, 0xf7, 0xe6, 0x21, 0xd5, 0x76, 0x89, 0x90, 0xc3, 0x1e, 0x6f, 0x0d, 0x7a,
+  0xe4, 0x16, 0xae, 0x5a, 0x84, 0x26, 0xe8, 0x25, 0x49, 0x3e, 0x98, 0xcb, 0x66, 0x6d, 0xa9, 0xd5,
+  0x74, 0x67, 0x43, 0xa4, 0xc3, 0x14, 0xb2, 0x26, 0xba, 0x39, 0x02, 0x98, 0x04, 0x5c, 0xe7, 0x2b,
+  0x37, 0xdc, 0x05, 0xdc, 0xa9, 0x8b, 0xee, 0xd6, 0x08, 0x07, 0x37, 0xca, 0x43, 0xa0, 0xa3, 0x5a,
+  0x73, 0x66, 0xad, 0x16, 0x0c, 0x66, 0x1f, 0xe0, 0xea, 0x36, 0xa7, 0x46, 0x29, 0x55, 0xc9, 0x62,
+  0xa1, 0x1e, 0x0a, 0x24, 0x04, 0xbc, 0xd2, 0xdd, 0xc0, 0x85, 0xd0, 0x9c, 0x4d, 0x05, 0x8a, 0x1b,
+  0x89, 0xdd, 0x97, 0x54, 0x99, 0xcc, 0xa4, 0x94, 0xad, 0x70, 0x39, 0xe2, 0x30, 0x6e, 0x55, 0xad,
+  0xa5, 0xf3, 0x6a, 0x5e, 0x8a, 0x76, 0x7a, 0x09, 0xee, 0xc9, 0x68, 0xad, 0x6c, 0x32, 0x8c, 0x80,
+  0xd5, 0x42, 0x0f, 0x58, 0x3d, 0x83, 0xd8, 0x0d, 0x27, 0x21, 0x11, 0xaf, 0xf4, 0x56, 0x48, 0x74,
+  0xc7, 0x85, 0xd9, 0x86, 0x73, 0x17, 0x58, 0x08, 0x73, 0x92, 0xb1, 0x84, 0x1e, 0xb9, 0x23, 0xf7,
+  0xbc, 0xb1, 0x4c, 0x0f, 0x3e, 0xcb, 0x3e, 0x90, 0xcc, 0x84, 0x95, 0x00, 0xe4, 0xdc, 0xea, 0xba,
+  0x12, 0xeb, 0x91, 0x76, 0x26, 0xd7, 0xd6, 0xc7, 0x89, 0x3d, 0x56, 0x19, 0x0a, 0xe8, 0x90, 0x5b,
+  0x1d, 0xe7, 0x97, 0xc4, 0x8f, 0x4a, 0x07, 0x32, 0x1b, 0x0d, 0xd2, 0x52, 0x86, 0xb8, 0xef, 0x37,
+  0x0a, 0xaa, 0x42, 0x3e, 0x52, 0x11, 0xe9, 0x0e, 0xe8, 0xd3, 0x76, 0x60, 0xd0, 0xc2, 0x18, 0xc3,
+  0xce, 0x3a, 0xa2, 0x2e, 0x53, 0x86, 0xa9, 0x09, 0x44, 0x05, 0xa5, 0xe0, 0x34, 0x08, 0x98, 0xd4,
+  0xb1, 0x9d, 0x03, 0xb6, 0x74, 0x11, 0xcd, 0xbd, 0x9e, 0x9d, 0x8c, 0x18, 0xd1, 0x1a, 0x72, 0xb2,
+  0x68, 0x62, 0x93, 0xb5, 0xf2, 0x5c, 0x24, 0x38, 0xf7, 0xa6, 0xb8, 0x28, 0xc4, 0x15, 0xea, 0x02,
+  0xd6, 0x30, 0xa7, 0x54, 0xc6, 0x4a, 0x67, 0xf6, 0xd9, 0x0b, 0x2f, 0xbb, 0x42, 0xbe, 0x1d, 0x14,
+  0xd5, 0x06, 0xb3, 0x3c, 0x28, 0xad, 0x75, 0x58, 0xe1, 0xc1, 0x93, 0xf9, 0x60, 0x64, 0x5d, 0x6b,
+  0x12, 0xe1, 0x8e, 0x81, 0x9b, 0x8c, 0x25, 0xe3, 0x8c, 0x4a, 0xfc, 0x84, 0xf5, 0xea, 0xbe, 0x48,
+  0x6c, 0xca, 0x9f, 0x23, 0xe3, 0x54, 0x8f, 0x66, 0x51, 0xc3, 0x07, 0xdd, 0x20, 0xfb, 0x50, 0x17,
+  0x41, 0x02, 0xa2, 0xeb, 0x14, 0x0d, 0xa7, 0x1c, 0x76, 0x4d, 0x6c, 0xf5, 0x94, 0x31, 0x1d, 0x42,
+  0x76, 0xe0, 0x34, 0x73, 0x35, 0x1c, 0xa4, 0x68, 0x84, 0xa5, 0x46, 0xae, 0x87, 0x74, 0x39, 0x9f,
+  0x61, 0x96, 0x37, 0xa4, 0xa4, 0xd6, 0x35, 0x4a, 0xb9, 0x01, 0x5a, 0xe3, 0x54, 0xc0, 0x74, 0xde,
+  0xf4, 0x3c, 0xf2, 0x81, 0x13, 0x59, 0xf8, 0x61, 0x60, 0xa7, 0xc6, 0x89, 0xc5, 0xa6, 0xb4, 0x37,
+  0xb2, 0xad, 0xce, 0x8b, 0xaa, 0x41, 0x2b, 0x76, 0x9a, 0x37, 0x62, 0xb3, 0x32, 0xbb, 0xb8, 0x3d,
+  0x42, 0x51, 0xdb, 0x83, 0x1a, 0x4d, 0xa2, 0x12, 0x8a, 0x1d, 0x13, 0x18, 0xc4, 0xc0, 0x63, 0x65,
+  0xef, 0x56, 0xea, 0x37, 0xa2, 0x11, 0x41, 0xc7, 0x8e, 0x84, 0xd1, 0x23, 0xb0, 0xba, 0x51, 0xd3,
+  0x36, 0x31, 0x64, 0xfa, 0x62, 0xbc, 0x95, 0x66, 0x6e, 0xf9, 0xd9, 0x1d, 0xb6, 0x44, 0xff, 0xd6,
+  0xb2, 0x80, 0x73, 0x15, 0x87, 0x95, 0xbf, 0x3f, 0x20, 0x76, 0x4f, 0xf5, 0x2a, 0xb8, 0xca, 0xa5,
+  0x87, 0x7d, 0xf5, 0x94, 0x9d, 0x50, 0x89, 0x9e, 0xd5, 0xb3, 0xf4, 0x30, 0x6a, 0x2c, 0x51, 0xa3,
+  0x53, 0x05, 0xb9, 0xf6, 0x43, 0x6c, 0x11, 0x06, 0x14, 0xb9, 0x98, 0xbd, 0xaf, 0x45, 0x35, 0x90,
+  0xa3, 0x76, 0x33, 0xb5, 0x87, 0x62, 0xe1, 0x77, 0xfb, 0x71, 0xf7, 0xe6, 0xd6, 0xca, 0x08, 0xab,
+  0xb1, 0x20, 0x22, 0x22, 0x29, 0x9e, 0x88, 0x95, 0xe9, 0x6a, 0x3a, 0xcb, 0x15, 0x00, 0x56, 0x6b,
+  0xb8, 0x97, 0x6d, 0x72, 0xa1, 0x64, 0x3f, 0x19, 0x2e, 0x25, 0xb3, 0xa7, 0x49, 0xa1, 0x7f, 0x81,
+  0x8d, 0x42, 0x84, 0x59, 0x55, 0x4f, 0x80, 0x09, 0x74, 0xf0, 0xce, 0xe8, 0x66, 0x8a, 0x48, 0x4f,
+  0x63, 0xd3, 0x4d, 0x82, 0x5b, 0xd4, 0xbe, 0x16, 0xac, 0xb0, 0x57, 0x40, 0x2c, 0x0c, 0x30, 0xf5,
+  0xec, 0xde, 0x4c, 0x2b, 0x61, 0x2e, 0x17, 0x43, 0x28, 0x2a, 0x5b, 0x55, 0xe4, 0x88, 0x91, 0x93,
+  0x1e, 0xbf, 0x55, 0xba, 0x7a, 0x21, 0x51, 0x9c, 0x62, 0xf5, 0x3c, 0x57, 0x49, 0x23, 0x4d, 0x2c,
+  0x78, 0xa1, 0x81, 0x25, 0x4b, 0x71, 0xbc, 0x91, 0xf1, 0xad, 0x4e, 0xb1, 0x5b, 0x07, 0x46, 0xbe,
+  0x86, 0xca, 0x62, 0x07, 0x3b, 0x11, 0x98, 0x92, 0x07, 0x8f, 0x64, 0x8e, 0x16, 0x7e, 0x53, 0xec,
+  0x06, 0x36, 0xab, 0xa3, 0xab, 0xa4, 0xec, 0x75, 0x29, 0xe9, 0x1e, 0x2c, 0x09, 0x6a, 0x68, 0x4c,
+  0xc1, 0x31, 0xf3, 0xc0, 0xa9, 0x88, 0xdc, 0x25, 0x19, 0xf3, 0x3a, 0x6c, 0xf9, 0x30, 0xaa, 0x49,
+  0xfe, 0x28, 0x51, 0x37, 0x39, 0xd5, 0xc4, 0xad, 0x08, 0x67, 0xaf, 0x2b, 0x20, 0xcf, 0xcb, 0x36,
+  0xd7, 0xc9, 0xb2, 0x91, 0xd2, 0x61, 0x66, 0xc1, 0x8b, 0x19, 0xca, 0xe1, 0xe3, 0x1e, 0x0d, 0x01,
+  0x88, 0xa6, 0xbc, 0x64, 0xc8, 0x2f, 0x8c, 0x31, 0x1d, 0x69, 0x92, 0x87, 0xa1, 0x00, 0xbd, 0x66,
+  0x0a, 0xd6, 0x4b, 0x06, 0x65, 0x37, 0x27, 0xe9, 0xa1, 0x7b, 0x21, 0xc5, 0x39, 0xa7, 0x0b, 0xa6,
+  0x1c, 0xb5, 0x15, 0x68, 0x37, 0xd1, 0x40, 0x4e, 0xc7, 0xb8, 0x83, 0x29, 0xcf, 0x55, 0xc1, 0x29,
+  0x64, 0xd3, 0x7b, 0x30, 0x26, 0xb3, 0xdf, 0xe5, 0x86, 0x69, 0x98, 0xd6, 0x55, 0xc3, 0xd9, 0x91,
+  0x38, 0x5f, 0xab, 0x9e, 0x4d, 0x8d, 0xac, 0x3e, 0x2d, 0xc0, 0xba, 0xda, 0xc5, 0x79, 0xee, 0xe3,
+  0xc0, 0x8c, 0x9d, 0xe6, 0xcc, 0x11, 0x98, 0x66, 0x20, 0x81, 0x8e, 0x6f, 0x81, 0x7e, 0x6b, 0xfd,
+  0xc3, 0x66, 0x14, 0x58, 0xdb, 0x9c, 0x67, 0x06, 0x6f, 0x6e, 0xa0, 0xb2, 0xa4, 0x80, 0x8c, 0x56,
+  0xb0, 0xd0, 0xed, 0x7e, 0xda, 0x63, 0xd3, 0xeb, 0x63, 0x75, 0x2e, 0x42, 0xdb, 0xba, 0x93, 0x24,
+  0x95, 0x45, 0xe5, 0x5c, 0x8b, 0x99, 0x0a, 0x4e, 0x3c, 0xd2, 0xe6, 0xc6, 0xd0, 0x3b, 0xfe, 0x79,
+  0xc9, 0x4e, 0x24, 0xd2, 0x81, 0xf4, 0x9d, 0x9b, 0x6e, 0xeb, 0xc6, 0x3d, 0x9c, 0x07, 0x58, 0xa2,
+  0x7b, 0x25, 0xb7, 0x1b, 0xd5, 0x5d, 0xda, 0x04, 0xd3, 0xa6, 0x29, 0xfc, 0xb2, 0xc7, 0x4d, 0x4c,
+  0x71, 0x8c, 0x6c, 0x02, 0x4d, 0xec, 0x7e, 0x58, 0x5a, 0xf1, 0x81, 0xc0, 0x91, 0x01, 0x9e, 0x9c,
+  0x8d, 0x59, 0x21, 0x48, 0x43, 0xa0, 0xc1, 0x09, 0x72, 0x8b, 0xbf, 0xde, 0x56, 0xdf, 0x54, 0x03,
+  0xee, 0x7a, 0x03, 0xa3, 0x80, 0x46, 0xdd, 0x40, 0x8c, 0x99, 0x83, 0x52, 0x8c, 0x18, 0x04, 0x8a,
+  0xb3, 0x98, 0xb7, 0x40, 0x3c, 0xc7, 0x2c, 0x66, 0xba, 0x20, 0x09, 0xee, 0x95, 0x47, 0xcd, 0x43,
+  0x4a, 0xa3, 0x99, 0xfe, 0x79, 0x16, 0x3a, 0xee, 0x44, 0x72, 0x24, 0x3b, 0xa5, 0xbe, 0x74, 0x76,
+  0x06, 0xee, 0x5c, 0x3a, 0xa8, 0x39, 0x1a, 0xa6, 0x5b, 0x00, 0x5d, 0xc4, 0x41, 0xc2, 0xb5, 0x28,
+  0x4a, 0xc2, 0xba, 0xc4, 0x69, 0x2e, 0x10, 0xce, 0xd8, 0xd4, 0xe2, 0x69, 0x6b, 0x57, 0x2b, 0xea,
+  0x00, 0xc9, 0x0f, 0xc2, 0x98, 0x89, 0x4d, 0x81, 0x0c, 0x08, 0x37, 0xea, 0xf0, 0xbb, 0x94, 0xb0,
+  0x31, 0x25, 0x88, 0xa9, 0xa1, 0x48, 0x5d, 0xc9, 0x7b, 0x51, 0x9b, 0x55, 0x61, 0x8b, 0x0c, 0x48,
+  0x4f, 0xd1, 0xa8, 0x61, 0x1e, 0x32, 0x4b, 0x4e, 0xf0, 0xba, 0xbe, 0x86, 0x52, 0x55, 0xc7, 0x34,
+  0x2f, 0x20, 0xfd, 0x96, 0xab, 0x6b, 0x02, 0x91, 0xb5, 0x8a, 0xe8, 0xb3, 0x5b, 0x20, 0xd8, 0xfa,
+  0xb8, 0xfb, 0xa5, 0xcb, 0x89, 0x36, 0x54, 0x1a, 0xeb, 0x63, 0xe3, 0xe2, 0xf4, 0x28, 0x36, 0x13,
+  0x8e, 0xc0, 0x86, 0xb1, 0xa2, 0x1d, 0x75, 0x01, 0x02, 0xd4, 0x31, 0xf4, 0x7a, 0x74, 0xd0, 0xe3,
+  0x95, 0xa5, 0x9c, 0x41, 0x56, 0x64, 0x29, 0x7c, 0x00, 0x67, 0x7d, 0xdb, 0xac, 0x98, 0x4d, 0x8a,
+  0x69, 0x08, 0x39, 0x65, 0x6b, 0x7a, 0x89, 0x22, 0x0a, 0x6b, 0x4c, 0xba, 0xa3, 0x78, 0x83, 0xac,
+  0xd5, 0x63, 0xc0, 0x79, 0x58, 0x50, 0xb1, 0x6a, 0x80, 0x9c, 0xed, 0xb8, 0x59, 0x4e, 0x38, 0x45,
+  0x54, 0x17, 0x75, 0x3c, 0x2b, 0xf0, 0xa4, 0x18, 0xa3, 0x83, 0x6c, 0xe6, 0x5e, 0x68, 0x60, 0x83,
+  0x47, 0x26, 0x64, 0x62, 0x80, 0x69, 0xb7, 0xf1, 0x60, 0x3c, 0x4f, 0x8b, 0xec, 0xf5, 0xe8, 0x91,
+  0x03, 0x07, 0xd1, 0xad, 0x2a, 0x28, 0x20, 0x22, 0x27, 0x9a, 0x94, 0x07, 0x2d, 0x92, 0xb4, 0x04,
+  0xaf, 0x65, 0xc8, 0x57, 0xe3, 0xe5, 0x7e, 0x85, 0x9b, 0x7e, 0x1d, 0x27, 0xa3, 0x4c, 0x4c, 0xba,
+  0xc0, 0x40, 0xd6, 0xb9, 0xd5, 0x10, 0x05, 0xed, 0x75, 0xf1, 0x7c, 0x80, 0x5a, 0x7c, 0xdc, 0x33,
+  0xd8, 0x4d, 0x75, 0x0f, 0x86, 0xab, 0x9d, 0x96, 0x8a, 0x48, 0xa4, 0xab, 0x85, 0x5b, 0x19, 0x34,
+  0xdb, 0x29, 0x34, 0xe5, 0x44, 0x4c, 0xa0, 0x54, 0xa1, 0xda, 0x32, 0x37, 0x5e, 0xbb, 0xa3, 0x79,
+  0x8d, 0xcd, 0xb0, 0x13, 0x14, 0x4f, 0xc8, 0x18, 0x58, 0xe5, 0xd7, 0xeb, 0x51, 0x0a, 0x90, 0x6b,
+  0x3d, 0x38, 0xc7, 0x74, 0x3a, 0x24, 0x1a, 0x21, 0x78, 0x36, 0x66, 0x3b, 0xd7, 0x14, 0x12, 0x7d,
+  0xb2, 0xd0, 0x96, 0x36, 0x47, 0x31, 0x0b, 0x42, 0x30, 0xda, 0x74, 0xd0, 0xe2, 0x78, 0x9f, 0x80,
+  0x93, 0xcf, 0x47, 0xb2, 0xd0, 0xe1, 0xad, 0x47, 0x5e, 0x79, 0x86, 0x3c, 0x4d, 0xc7, 0x14, 0xba,
+  0xc1, 0x9e, 0x05, 0xdc, 0xf3, 0x51, 0x0a, 0x68, 0x6a, 0x0d, 0x83, 0x4c, 0xcd, 0x5a, 0xcd, 0x0c,
+  0x80, 0x1b, 0x74, 0x71, 0x4f, 0x0d, 0xea, 0x41, 0xf9, 0x70, 0x50, 0x24, 0x95, 0x9c, 0x55, 0x8d,
+  0xa2, 0x9b, 0x8b, 0xdd, 0x76, 0xeb, 0x10, 0xdd, 0x41, 0x0e, 0x9d, 0x17, 0xcd, 0xd7, 0xe6, 0x8d,
+  0x54, 0x47, 0x71, 0x62, 0x66, 0xb6, 0x56, 0xc0, 0x9c, 0x2a, 0x66, 0xe4, 0x38, 0x78, 0xf9, 0xf4,
+  0x48, 0x90, 0x13, 0x5c, 0x66, 0xa6, 0x0f, 0x99, 0x01, 0x0f, 0x9e, 0x4e, 0x8c, 0xda, 0xf5, 0xd7,
+  0x69, 0x96, 0x5d, 0x0e, 0xf7, 0x4d, 0x6c, 0x28, 0xe4, 0xbe, 0xf4, 0x22, 0x26, 0x5e, 0xdc, 0xd0,
+  0x57, 0x41, 0x5d, 0x06, 0x6a, 0x34, 0xae, 0xa8, 0x8a, 0xe0, 0xc8, 0x6d, 0xbd, 0xc0, 0x2d, 0xd2,
+  0xc2, 0xfe, 0xcd, 0x5b, 0x41, 0x99, 0xa7, 0x4b, 0xfc, 0x74, 0xe9, 0xb3, 0x35, 0x3a, 0x76, 0xc1,
+  0x93, 0x1e, 0xd5, 0x29, 0x19, 0xa0, 0x38, 0xf7, 0x4c, 0x26, 0xc5, 0x06, 0x71, 0xeb, 0x7e, 0xde,
+  0x84, 0x53, 0xc6, 0x34, 0xc2, 0x86, 0xab, 0xa0, 0xac, 0xae, 0xa9, 0x66, 0x5e, 0xb6, 0xbd, 0xfe,
+  0x18, 0x24, 0x08, 0xc5, 0x27, 0x79, 0x7c, 0xf4, 0x96, 0xd8, 0x1c, 0xfc, 0x8c, 0x57, 0xef, 0xb5,
+  0x40, 0x67, 0xd6, 0x7d, 0x4c, 0x3b, 0xac, 0xcc, 0x2d, 0x87, 0x3b, 0x8d, 0x3e, 0x19, 0xa2, 0x7e,
+  0xb0, 0xc4, 0xbb, 0x9f, 0x36, 0x33, 0x8b, 0x83, 0x74, 0x91, 0x40, 0x39, 0x16, 0xae, 0x94, 0xb9,
+  0x53, 0xa7, 0x6c, 0xc0, 0xbb, 0x38, 0x2e, 0xa7, 0x47, 0x80, 0x00, 0xb8, 0xa9, 0x89, 0xee, 0xcd,
+  0x38, 0x07, 0xc9, 0xa3, 0x1a, 0xda, 0x19, 0x7e, 0x88, 0xd7, 0x53, 0x14, 0x01, 0xae, 0x74, 0x68,
+  0xf5, 0xa9, 0xc6, 0x07, 0xe2, 0x70, 0xbe, 0x15, 0x8e, 0x47, 0xf7, 0x28, 0xa6, 0x13, 0x02, 0x86,
+  0x52, 0x62, 0x03, 0x9e, 0xfd, 0x2c, 0x04, 0x16, 0x7e, 0x5d, 0xf6, 0x70, 0xa8, 0x81, 0xa6, 0xc6,
+  0x18, 0x88, 0xb2, 0x0c, 0xe5, 0xb0, 0x07, 0x45, 0xeb, 0x01, 0x2c, 0x17, 0x46, 0x7c, 0x98, 0x67,
+  0xfd, 0xde, 0xe8, 0x20, 0x7e, 0x1f, 0x10, 0x2e, 0x4c, 0xdb, 0xd8, 0xac, 0x86, 0xf2, 0x16, 0x97,
+  0x42, 0x85, 0x5d, 0x0e, 0xcd, 0xe4, 0xf8, 0x0f, 0x63, 0xf7, 0x27, 0x95, 0x79, 0x6f, 0xb7, 0x34,
+  0xce, 0x3c, 0x44, 0xd1, 0x41, 0xa2, 0x99, 0xf6, 0xa7, 0x84, 0x21, 0x14, 0x90, 0x92, 0x1b, 0x7f,
+  0x2c, 0xf5, 0x81, 0xf6, 0x40, 0x11, 0xac, 0x49, 0x60, 0xeb, 0xf4, 0x1e, 0xed, 0x8f, 0x63, 0x4e,
+  0x22, 0x0f, 0x1d, 0x2e, 0x4e, 0x0e, 0x2d, 0x91, 0xcc, 0x94, 0x7a, 0x83, 0xa6, 0x6a, 0x77, 0x8d,
+  0x34, 0x85, 0xdd, 0xfb, 0xa5, 0x7b, 0xd1, 0xb0, 0xbb, 0xac, 0x22, 0xd0, 0xae, 0x8d, 0xac, 0x2f,
+  0x76, 0x78, 0x59, 0x4c, 0xc1, 0x7b, 0x1c, 0x36, 0xe9, 0x8a, 0xdf, 0x8a, 0xdc, 0xb9, 0x95, 0xbe,
+  0x9d, 0x5c, 0xaa, 0xcc, 0xd8, 0x29, 0x47, 0x82, 0x83, 0x66, 0xf1, 0xd5, 0xa6, 0x8e, 0x17, 0xf0,
+  0xb4, 0xf1, 0x7b, 0x2a, 0xaf, 0xcd, 0xd2, 0xbd, 0x91, 0x06, 0xf9, 0xee, 0x74, 0xa6, 0x7a, 0xd3,
+  0xf4, 0xf9, 0x3c, 0xdd, 0x40, 0x16, 0xb0, 0x9d, 0xb4, 0x33, 0x32, 0x16, 0xb1, 0x05, 0xf5, 0x1a,
+  0x29, 0x57, 0x3e, 0x28, 0xa2, 0x69, 0x73, 0x60, 0x6d, 0xbf, 0x87, 0xf7, 0xdd, 0x7a, 0xca, 0xb3,
+  0x3b, 0x31, 0x23, 0x36, 0x3f, 0xb8, 0xc9, 0x21, 0x8e, 0xd3, 0x58, 0x9a, 0xc2, 0x7d, 0x59, 0x1c,
+  0x6a, 0x31, 0x17, 0xc1, 0x89, 0x37, 0xb2, 0xb8, 0x73, 0x8b, 0x3e, 0x9e, 0x1f, 0x37, 0xbe, 0xf3,
+  0xbc, 0x58, 0x55, 0x34, 0x41, 0x17, 0xfa, 0x86, 0xc7, 0x30, 0x91, 0x83, 0xd8, 0xf9, 0xf0, 0xd0,
+  0x73, 0xc4, 0x84, 0x2b, 0x0e, 0x64, 0xf3, 0xbd, 0x0c, 0x3e, 0x1a, 0xa1, 0xbd, 0x9e, 0xfb, 0x5e,
+  0x70, 0x29, 0xf1, 0x7e, 0x58, 0xf5, 0xa1, 0xbf, 0xd9, 0x57, 0xf4, 0xc6, 0x89, 0x40, 0xec, 0x36,
+  0x11, 0xb8, 0x5a, 0x0d, 0x54, 0xc5, 0x09, 0xa3, 0xa0, 0xea, 0x1a, 0xb1, 0x49, 0xe8, 0x10, 0xb8,
+  0xaf, 0x21, 0xa0, 0x3e, 0x9d, 0x1d, 0xac, 0x56, 0x17, 0xcf, 0x10, 0x07, 0xf5, 0x04, 0xdd, 0x05,
+  0xce, 0xda, 0x0c, 0xb7, 0xbb, 0x49, 0xae, 0x42, 0xdd, 0xf9, 0xe9, 0x7a, 0xe9, 0x9b, 0x64, 0x8f,
+  0x2a, 0x3d, 0x43, 0xe0, 0xec, 0xd4, 0x80, 0x7a, 0xc7, 0x60, 0xd1, 0x85, 0x77, 0x61, 0x03, 0x06,
+  0x45, 0x95, 0x49, 0x6b, 0x14, 0x35, 0x8a, 0xdb, 0x61, 0x3a, 0x5c, 0x44, 0xb0, 0x67, 0x28, 0x56,
+  0xc0, 0xdd, 0xd0, 0x53, 0x27, 0x2f, 0xb8, 0xab, 0x10, 0x40, 0xf8, 0xd1, 0x32, 0x8c, 0x88, 0xe0,
+  0x9c, 0x13, 0x03, 0xb9, 0x39, 0xee, 0x82, 0x5d, 0xcb, 0xd1, 0x4b, 0xa1, 0x63, 0xa9, 0x16, 0x54,
+  0xb9, 0x5f, 0x42, 0xd0, 0xda, 0x2e, 0x4d, 0xe8, 0x17, 0x67, 0x65, 0x52, 0x07, 0x51, 0xd8, 0x1e,
+  0x88, 0xa5, 0x2d, 0x58, 0xd5, 0xa7, 0x34, 0x76, 0x24, 0xd0, 0xf2, 0xbc, 0xd7, 0xe2, 0x0b, 0x54,
+  0xeb, 0x8b, 0x67, 0x6f, 0xd0, 0xc9, 0xb1, 0x1f, 0xe8, 0x2a, 0xca, 0xa3, 0x7f, 0x3b, 0x53, 0x82,
+  0x1b, 0x11, 0xcc, 0xb1, 0xe7, 0xeb, 0x40, 0x20, 0x41, 0x7f, 0xa8, 0xe8, 0x19, 0xe1, 0x3c, 0xd5,
+  0x6c, 0x86, 0x21, 0x08, 0x5d, 0x6c, 0xa3, 0xe1, 0x6b, 0x75, 0x29, 0xcb, 0x3b, 0x21, 0xcb, 0x4b,
+  0xdf, 0xd4, 0xcc, 0x7c, 0xd4, 0xac, 0x09, 0xc3, 0xf0, 0xb3, 0x50, 0x5e, 0xa4, 0xe1, 0x54, 0x77,
+  0x81, 0xe9, 0xd0, 0x6b, 0xec, 0x82, 0x1e, 0x8d, 0x58, 0xdc, 0x45, 0x2c, 0x43, 0x73, 0xf4, 0x14,
+  0xb2, 0x07, 0x1b, 0xde, 0xbb, 0xec, 0x55, 0xd4, 0x06, 0xf8, 0x8f, 0x3e, 0x82, 0xf1, 0x5c, 0x4a,
+  0x91, 0x5c, 0xd7, 0x6e, 0x05, 0xf3, 0x40, 0x7c, 0xbb, 0xe7, 0x18, 0x2a, 0x68, 0x12, 0x7b, 0xeb,
+  0x7b, 0x00, 0x94, 0xb8, 0x5a, 0x4e, 0xd2, 0x3c, 0x92, 0xaf, 0xc1, 0x4d, 0x15, 0x72, 0xc7, 0x5b,
+  0x2f, 0xfe, 0xca, 0x99, 0x3a, 0x13, 0x9f, 0x85, 0x7b, 0xa7, 0x1c, 0x46, 0x3e, 0xab, 0x0d, 0x50,
+  0xc5, 0xed, 0x66, 0x5c, 0x03, 0xdf, 0x2d, 0x49, 0x6e, 0x14, 0xe0, 0x94, 0x30, 0xd7, 0x7b, 0xa7,
+  0xb3, 0x54, 0x1d, 0xcd, 0x42, 0xac, 0xc7, 0x98, 0x73, 0x2e, 0x61, 0xb6, 0xeb, 0x2b, 0xd4, 0x63,
+  0x07, 0xd3, 0x15, 0x7b, 0x18, 0x30, 0x1f, 0x0c, 0x55, 0x37, 0xf7, 0xac, 0x71, 0xf5, 0xf6, 0x0c,
+  0x42, 0x0a, 0xb6, 0xbb, 0x9b, 0x25, 0xb4, 0x1d, 0x2f, 0x17, 0xcf, 0xfd, 0x05, 0xe2, 0xd1, 0x3b,
+  0x40, 0x58, 0xe6, 0x18, 0xbb, 0x8a, 0x79, 0xf1, 0x8e, 0xd3, 0xbd, 0xab, 0x8f, 0x23, 0xb2, 0x57,
+  0x42, 0x76, 0xcb, 0xb7, 0x9e, 0x31, 0xd2, 0x50, 0xcb, 0x45, 0x4c, 0xb0, 0x56, 0xc1, 0xd1, 0xba,
+  0x78, 0x75, 0x67, 0x33, 0x19, 0x7a, 0x9a, 0x8f, 0x76, 0x3d, 0x48, 0x49, 0xde, 0x76, 0x67, 0xc8,
+  0x91, 0x74, 0x4e, 0x02, 0x19, 0x35, 0x05, 0x03, 0x11, 0xe2, 0x70, 0xf3, 0x60, 0x6c, 0xab, 0xe5,
+  0xaa, 0x4b, 0x48, 0x1e, 0x65, 0xec, 0x5c, 0xb1, 0xdb, 0x9e, 0x0e, 0x9d, 0xd9, 0x7b, 0xa6, 0x33,
+  0x42, 0xa8, 0x6b, 0x3d, 0xc0, 0x1d, 0x4a, 0x73, 0x8d, 0x01, 0xda, 0x6f, 0xa4, 0x31, 0x3b, 0x4c,
+  0x1e, 0x14, 0x4d, 0xae, 0x25, 0x1f, 0x7b, 0xfd, 0x81, 0x46, 0xd1, 0x06, 0x16, 0x38, 0x9d, 0x73,
+  0x64, 0xa0, 0x95, 0xd0, 0xc1, 0x9c, 0xae, 0xcb, 0xb5, 0xb6, 0x6f, 0x17, 0x6e, 0x04, 0x82, 0x8e,
+  0x75, 0x1e, 0x70, 0x8a, 0x6e, 0x71, 0x92, 0x16, 0x91, 0xec, 0x21, 0xd9, 0x9a, 0xda, 0x05, 0x7e,
+  0xf7, 0xc8, 0x72, 0xbc, 0x74, 0x1b, 0xc0, 0x49, 0x5a, 0x1f, 0x3e, 0xd6, 0xce, 0xb2, 0x31, 0xa4,
+  0xe3, 0x54, 0x37, 0x20, 0x86, 0xe0, 0x4c, 0xca, 0x66, 0x93, 0x9e, 0xc7, 0xa3, 0xa2, 0xb5, 0x95,
+  0xb8, 0x47, 0x4c, 0x41, 0x96, 0xf2, 0x2a, 0x2a, 0x6f, 0x97, 0x6a, 0x51, 0xae, 0x91, 0x3d, 0x15,
+  0x87, 0x08, 0x42, 0x3c, 0xc9, 0xae, 0x93, 0x6e, 0xd0, 0x35, 0x91, 0xd6, 0x65, 0xf2, 0x42, 0x0b,
+  0x46, 0x78, 0x75, 0x0e, 0xea, 0x3d, 0x30, 0xca, 0xc3, 0x1c, 0x40, 0x49, 0xe6, 0x23, 0xae, 0xd0,
+  0xdd, 0x0a, 0xf6, 0x18, 0x28, 0x99, 0x10, 0x52, 0x14, 0x77, 0x67, 0x19, 0x1d, 0x13, 0x1b, 0xd8,
+  0x8d, 0x76, 0x83, 0xf6, 0xa2, 0xab, 0xc4, 0x5d, 0x94, 0x71, 0x4e, 0xad, 0x07, 0x5a, 0xe9, 0x7b,
+  0x8e, 0x4b, 0x89, 0xa3, 0xb7, 0x31, 0x0f, 0xc2, 0xdc, 0x8a, 0x51, 0x22, 0xf7, 0x3b, 0xe6, 0xe1,
+  0x44, 0x79, 0x17, 0x40, 0x8e, 0x66, 0xc6, 0xb3, 0xb9, 0xa2, 0x87, 0xe6, 0x61, 0xe8, 0xd6, 0x5e,
+  0x8d, 0x14, 0x86, 0x81, 0x40, 0x11, 0x0b, 0xae, 0x57, 0x57, 0xd1, 0x65, 0xe2, 0x18, 0xb7, 0xce,
+  0x6d, 0x59, 0xc5, 0x89, 0xd6, 0x17, 0x14, 0x12, 0x0e, 0x5a, 0x8a, 0xa8, 0xb7, 0x39, 0x44, 0x1a,
+  0xeb, 0x21, 0x48, 0x5e, 0x0a, 0x2b, 0xdb, 0xaa, 0xc9, 0xdd, 0x19, 0x6f, 0x1a, 0x33, 0x3d, 0x92,
+  0xf8, 0x81, 0x25, 0xa5, 0xc7, 0x9e, 0x34, 0xce, 0x62, 0x4d, 0xb3, 0x6b, 0x2a, 0xda, 0x08, 0x38,
+  0x50, 0x8b, 0xb6, 0x17, 0xd8, 0xfd, 0xb2, 0x0e, 0x16, 0xc2, 0x98, 0x68, 0x73, 0x84, 0xa6, 0x6b,
+  0x8f, 0x64, 0x31, 0x87, 0xae, 0xf3, 0xac, 0xaa, 0x83, 0xee, 0xf1, 0x02, 0x0b, 0x8b, 0x27, 0xe4,
+  0x76, 0x86, 0x34, 0xc3, 0x5d, 0xab, 0x8b, 0x32, 0xb0, 0x08, 0x23, 0xa2, 0x5c, 0x31, 0xda, 0xb0,
+  0xcc, 0xcf, 0xb8, 0x77, 0xdc, 0xe3, 0x95, 0x57, 0xc5, 0xea, 0xdc, 0x6d, 0x91, 0xe1, 0xd0, 0x08,
+  0xaf, 0x8d, 0xd7, 0x24, 0x36, 0xc6, 0xc7, 0x5d, 0xc4, 0x50, 0xa3, 0x7c, 0xb8, 0xa5, 0x05, 0x5f,
+  0x9b, 0xbe, 0xa1, 0x20, 0xbd, 0xb3, 0x04, 0xa8, 0x50, 0x59, 0x2a, 0x97, 0xeb, 0x13, 0x98, 0x78,
+  0xc8, 0x29, 0x22, 0x8f, 0xa1, 0x25, 0x4e, 0x11, 0xea, 0xed, 0xf2, 0x4c, 0xf9, 0x7c, 0xb0, 0xf8,
+  0x22, 0x92, 0xf2, 0xc2, 0x41, 0xbb, 0xe1, 0x64, 0xa6, 0xe8, 0xad, 0xec, 0xf4, 0xee, 0x7e, 0xcf,
+  0x82, 0xd1, 0x28, 0x34, 0x97, 0x4b, 0xd2, 0xd6, 0x2b, 0x78, 0x72, 0x68, 0x4f, 0x1a, 0x7a, 0xd1,
+  0x01, 0x91, 0x1b, 0x62, 0x09, 0xc7, 0xf8, 0x44, 0xda, 0xe2, 0x61, 0x3f, 0x52, 0xdd, 0xcc, 0x0e,
+  0x9d, 0x30, 0xe9, 0x20, 0x5c, 0xd3, 0x6b, 0x68, 0xd4, 0x90, 0x75, 0xb8, 0xc0, 0x68, 0xb3, 0x82,
+  0x22, 0x0a, 0x88, 0x80, 0x9d, 0x1d, 0xb2, 0xc3, 0xed, 0x6c, 0x5f, 0xe3, 0x3c, 0x07, 0x11, 0xc1,
+  0x8b, 0x68, 0x07, 0xdd, 0xc0, 0x9e, 0x28, 0x8a, 0x7c, 0xd2, 0x4d, 0x89, 0x6b, 0xac, 0x86, 0x8f,
+  0x56, 0x39, 0x99, 0xe8, 0xeb, 0x14, 0xdd, 0x89, 0xeb, 0x69, 0x06, 0xdd, 0x8e, 0x43, 0x9b, 0x89,
+  0xb9, 0x1f, 0xf8, 0x00, 0xdb, 0x96, 0x6d, 0xca, 0x94, 0x3b, 0xcf, 0xe0, 0xf3, 0xe2, 0xcb, 0x55,
+  0x8b, 0x60, 0x97, 0x73, 0x46, 0xa6, 0x79, 0x12, 0x01, 0x0d, 0x23, 0x19, 0xec, 0x81, 0x75, 0xae,
+  0x46, 0xb4, 0x0a, 0x28, 0x1f, 0x25, 0x9e, 0x8b, 0x62, 0xde, 0x60, 0x1d, 0xcc, 0x18, 0xbf, 0x49,
+  0xb5, 0x0f, 0xd2, 0x07, 0x7b, 0x39, 0xa8, 0x09, 0x40, 0xd7, 0xdc, 0x05, 0x34, 0xb2, 0x11, 0x2d,
+  0x98, 0x8b, 0x52, 0x5d, 0xe0, 0xa1, 0x12, 0x27, 0x3b, 0x0b, 0x4e, 0x98, 0x9d, 0x95, 0x7b, 0x62,
+  0xa4, 0x67, 0x3e, 0x45, 0x34, 0x06, 0x44, 0x31, 0x44, 0xfd, 0x18, 0x36, 0x4a, 0x40, 0x5d, 0x32,
+  0xdf, 0x13, 0x92, 0xb3, 0x02, 0x60, 0xc7, 0xc9, 0x3d, 0x63, 0x9b, 0x32, 0x43, 0xc3, 0xf5, 0xa4,
+  0xfb, 0x0e, 0x05, 0x47, 0x25, 0x77, 0x1b, 0xdd, 0x47, 0x54, 0x4b, 0xe8, 0x65, 0xdd, 0xd9, 0x64,
+  0x93, 0x78, 0xe0, 0xba, 0x53, 0xa7, 0x6f, 0xb7, 0xfb, 0x4d, 0xc0, 0x8c, 0x83, 0xd4, 0x21, 0x20,
+  0x17, 0x3d, 0xee, 0x85, 0x76, 0x8d, 0xe9, 0x02, 0xad, 0x6d, 0xc5, 0x45, 0x96, 0x59, 0xb3, 0x31,
+  0x15, 0xa7, 0x2e, 0x42, 0xe7, 0xce, 0x16, 0x2a, 0x17, 0x25, 0x62, 0x45, 0x80, 0x20, 0xf6, 0x79,
+  0x34, 0x75, 0x10, 0x1d, 0x87, 0xc1, 0xa5, 0x34, 0x8f, 0xf6, 0x2a, 0x4c, 0x99, 0xde, 0x6f, 0x54,
+  0x8c, 0xba, 0xce, 0x74, 0x49, 0x5d, 0x8c, 0x5b, 0x15, 0x35, 0x65, 0x9b, 0x99, 0x11, 0x7b, 0x49,
+  0x51, 0x6f, 0x8e, 0xda, 0x33, 0xb0, 0x28, 0x0b, 0x8f, 0x71, 0xe1, 0xbc, 0xed, 0x90, 0x41, 0x6a,
+  0x14, 0xd7, 0x7c, 0xb0, 0xb1, 0x80, 0x3f, 0x1f, 0x04, 0xb0, 0x5d, 0x40, 0x1c, 0x16, 0x40, 0xf6,
+  0x7a, 0x80, 0x04, 0x88, 0x3e, 0xcc, 0xb8, 0x33, 0xef, 0xa5, 0xfd, 0xc2, 0x23, 0xc4, 0xba, 0xf0,
+  0xe6, 0xa5, 0x3f, 0xc3, 0xbb, 0xcd, 0x34, 0xa3, 0xe7, 0x47, 0x7b, 0x7a, 0x00, 0x1c, 0x41, 0x7d,
+  0x7b, 0xf4, 0x3a, 0xc1, 0xaf, 0xa6, 0x15, 0x0c, 0x9d, 0x2a, 0x1a, 0x1b, 0xfa, 0x18, 0xda, 0xb8,
+  0x0c, 0xea, 0xdb, 0xd2, 0xdb, 0xd3, 0x58, 0xb5, 0x54, 0x91, 0xc0, 0x87, 0x5a, 0x37, 0xfb, 0x5e,
+  0x86, 0x03, 0xc8, 0x53, 0x99, 0x80, 0x51, 0xa3, 0x60, 0x4f, 0xb5, 0xe9, 0x2e, 0x3d, 0xf0, 0x82,
+  0x8f, 0x59, 0x57, 0x9b, 0x5f, 0xcb, 0x6d, 0xea, 0xbb, 0xb5, 0x00, 0xdc, 0xa1, 0x04, 0xee, 0xba,
+  0x3c, 0x08, 0x85, 0x16, 0x59, 0x26, 0x00, 0x46, 0x8a, 0xa1, 0x19, 0x2b, 0xbe, 0x40, 0x72, 0x7c,
+  0x21, 0x68, 0xaa, 0x14, 0x82, 0xe7, 0xdd, 0x58, 0x4c, 0x6a, 0x11, 0x2f, 0x33, 0x31, 0x2c, 0xd8,
+  0xea, 0xb2, 0x97, 0x9c, 0x5b, 0x8f, 0x50, 0x44, 0xf1, 0x21, 0x04, 0x4a, 0x4a, 0x0f, 0x12, 0x77,
+  0x43, 0x5a, 0xaa, 0xad, 0x6f, 0x4e, 0x00, 0x8e, 0x9f, 0xa6, 0x8a, 0x94, 0x21, 0x05, 0x91, 0x43,
+  0xb4, 0x44, 0x0e, 0x2e, 0x71, 0x77, 0x07, 0xec, 0xec, 0x43, 0x07, 0x36, 0x3b, 0xd7, 0x27, 0x23,
+  0x90, 0xf0, 0xf2, 0x90, 0x46, 0xf2, 0x8e, 0x2c, 0xdb, 0x20, 0x36, 0x91, 0x8b, 0x26, 0xe5, 0x4d,
+  0x7d, 0x0e, 0x44, 0xa6, 0xc7, 0x09, 0x55, 0x6e, 0x19, 0x14, 0xc5, 0x1a, 0x9a, 0x1c, 0x68, 0x2a,
+  0x9f, 0x4f, 0x5a, 0xcb, 0x41, 0x6e, 0x30, 0xf0, 0xa7, 0xb3, 0x4e, 0x92, 0xc7, 0x0b, 0x76, 0xd9,
+  0xab, 0x54, 0x2b, 0xc9, 0xbc, 0x02, 0xee, 0x35, 0xab, 0x89, 0x26, 0xd2, 0x63, 0x1c, 0xc4, 0x5e,
+  0x04, 0xe9, 0x9e, 0xe2, 0xc2, 0xf1, 0x8c, 0xd4, 0xdb, 0xb2, 0xb8, 0x05, 0x54, 0x10, 0x7b, 0xea,
+  0x7c, 0x3f, 0x26, 0xd3, 0x94, 0xd7, 0x5e, 0xd2, 0x8b, 0x4d, 0x41, 0x5a, 0x7e, 0x94, 0xa9, 0x7a,
+  0x2f, 0x1c, 0xe8, 0x24, 0x21, 0xcb, 0x69, 0x16, 0x70, 0x7b, 0xb7, 0xc9, 0x70, 0xdb, 0x34, 0xbf,
+  0x8d, 0xb8, 0x08, 0xb1, 0x6a, 0xc0, 0xeb, 0xa3, 0xad, 0x1c, 0x7b, 0x62, 0xaf, 0xe7, 0x66, 0x4b,
+  0x4c, 0x82, 0xfc, 0x42, 0x27, 0x36, 0xb3, 0x25, 0x5d, 0xe5, 0x66, 0x66, 0x6d, 0x17, 0x79, 0x6d,
+  0x69, 0x84, 0xea, 0x1a, 0x93, 0x04, 0x8e, 0xbe, 0xe3, 0xa6, 0xf2, 0x18, 0xa2, 0x1c, 0xa9, 0x07,
+  0xe9, 0x52, 0x94, 0x76, 0xca, 0x2e, 0x75, 0x23, 0xa9, 0x31, 0xc8, 0x57, 0x36, 0x4c, 0xca, 0x55,
+  0x26, 0x38, 0xb7, 0xc7, 0x59, 0x1d, 0xaf, 0x2e, 0x32, 0xdf, 0x04, 0x17, 0x92, 0x6f, 0xe7, 0xc3,
+  0x16, 0xb6, 0x0e, 0x76, 0xd2, 0x35, 0xe6, 0xa1, 0x55, 0xb7, 0x31, 0x36, 0x92, 0xd8, 0xa5, 0x04,
+  0x20, 0x61, 0xfa, 0xc8, 0xcf, 0x2d, 0x0e, 0x3f, 0x72, 0xc3, 0x3d, 0x68, 0x61, 0x0b, 0xd5, 0xc0,
+  0x43, 0xca, 0x46, 0x62, 0x7b, 0x60, 0x6a, 0xc4, 0x68, 0xe5, 0x76, 0x54, 0x79, 0xb2, 0x04, 0xc0,
+  0x1a, 0x6a, 0xc0, 0x05, 0xca, 0x9c, 0xf3, 0x83, 0xbb, 0xdb, 0x9c, 0x77, 0x96, 0x27, 0x81, 0x07,
+  0x14, 0xce, 0xa9, 0xb8, 0x14, 0xd0, 0xd0, 0x26, 0x37, 0xb8, 0x6e, 0xaf, 0xe1, 0xe7, 0x93, 0x7c,
+  0xaf, 0xc1, 0x81, 0x1d, 0x2e, 0xb8, 0xcb, 0xf0, 0x8a, 0x19, 0x71, 0xc2, 0x0d, 0x99, 0x3b, 0x43,
+  0x99, 0x81, 0xe0, 0x0e, 0x40, 0x92, 0x77, 0xa5, 0xd1, 0x2e, 0xbf, 0x78, 0x2c, 0x27, 0xc3, 0xe0,
+  0xe1, 0x64, 0x7b, 0xee, 0x41, 0x59, 0xe1, 0xbb, 0x1a, 0xb1, 0xf9, 0xc1, 0x90, 0x18, 0x6d, 0x2c,
+  0x69, 0x7c, 0x55, 0xf7, 0xca, 0x68, 0xb7, 0xc5, 0x0d, 0x8f, 0x53, 0x54, 0xc0, 0x44, 0x2b, 0x59,
+  0x3a, 0xd4, 0x51, 0xb1, 0xd1, 0x06, 0x54, 0x89, 0x2f, 0x26, 0x49, 0x5e, 0x68, 0xc1, 0x3b, 0x2b,
+  0xdb, 0xa8, 0x54, 0x6c, 0x87, 0x09, 0xae, 0xef, 0xd9, 0x85, 0xb6, 0x85, 0xd4, 0x49, 0x3a, 0x86,
+  0x92, 0xc5, 0x89, 0x5e, 0xd3, 0x06, 0x97, 0xdd, 0xcf, 0xb9, 0x76, 0x00, 0x20, 0x6e, 0x69, 0x94,
+  0x99, 0x77, 0x4b, 0xdc, 0xa3, 0x98, 0xf3, 0x31, 0x08, 0xd8, 0x0d, 0xae, 0xb2, 0xcd, 0x48, 0xe3,
+  0xa4, 0x2a, 0xe7, 0x31, 0x5b, 0x6f, 0xe6, 0xf5, 0x00, 0x30, 0x9c, 0x73, 0xa7, 0x42, 0x3e, 0x51,
+  0x87, 0x16, 0x6a, 0x44, 0xbc, 0x54, 0x0a, 0x97, 0xb9, 0x5d, 0x4e, 0x0c, 0xd9, 0x5a, 0x56, 0x42,
+  0x3b, 0x8a, 0x7a, 0x25, 0xed, 0x87, 0x13, 0xd0, 0x21, 0x6c, 0x21, 0x18, 0x54, 0xf2, 0xa0, 0x36,
+  0xa4, 0x5c, 0xcc, 0x22, 0x84, 0x4e, 0xc6, 0xd9, 0x0d, 0x04, 0xc5, 0xd4, 0xa4, 0xcc, 0x9e, 0x9f,
+  0x74, 0xc2, 0xbb, 0x82, 0x39, 0x72, 0x77, 0xc6, 0x48, 0x9c, 0xab, 0xfe, 0xba, 0xa0, 0xee, 0x51,
+  0x8d, 0x1d, 0x04, 0xa0, 0xa7, 0x12, 0x53, 0x6d, 0x8c, 0x5d, 0xf6, 0xc2, 0x25, 0xa3, 0x16, 0x48,
+  0xc9, 0xeb, 0xf5, 0x7c, 0x7e, 0x28, 0xa4, 0xd6, 0x7a, 0x9d, 0xba, 0xd4, 0x11, 0xef, 0xe4, 0x55,
+  0xcc, 0xd3, 0x19, 0x2a, 0x0f, 0xd1, 0x35, 0xbb, 0xe3, 0x6b, 0x10, 0xa2, 0xd0, 0x24, 0x59, 0xaa,
+  0x58, 0xee, 0x89, 0x5a, 0xa4, 0xd7, 0xf2, 0xb5, 0xe0, 0x1f, 0x4b, 0xd8, 0xa2, 0x9e, 0x67, 0xd5,
+  0x77, 0x9f, 0x8e, 0x08, 0x51, 0xd5, 0xe9, 0x02, 0xa2, 0x91, 0xa2, 0xe7, 0x92, 0x24, 0xb0, 0xd8,
+  0x91, 0x61, 0xb0, 0x23, 0x65, 0x35, 0x6d, 0x89, 0x3d, 0x5a, 0x58, 0x04, 0x52, 0x0a, 0x1f, 0xf7,
+  0x74, 0x4c, 0x2f, 0xad, 0xba, 0x5a, 0xf7, 0xe2, 0x88, 0x54, 0x11, 0x4b, 0x18, 0xf2, 0x6b, 0xb0,
+  0xfb, 0x8b, 0x03, 0xd8, 0xc7, 0x15, 0x36, 0xb1, 0xe2, 0x0c, 0x0a, 0xa6, 0xb7, 0x3c, 0x2c, 0xf0,
+  0x78, 0x5e, 0x6b, 0xf0, 0x84, 0x40, 0x30, 0xe0, 0xa2, 0x7a, 0x09, 0x4d, 0x15, 0xdf, 0xea, 0x87,
+  0x2e, 0xd4, 0x55, 0x50, 0x90, 0xf7, 0x9a, 0x91, 0x6a, 0xc4, 0x73, 0x77, 0x52, 0xf7, 0xd4, 0x15,
+  0x93, 0x8d, 0x4e, 0x1b, 0x16, 0x72, 0x00, 0x95, 0xc6, 0xf7, 0xaa, 0x8e, 0x5f, 0x37, 0x29, 0xbc,
+  0x39, 0xf9, 0x1a, 0xe9, 0x30, 0x06, 0xb5, 0xc7, 0x38, 0x8d, 0x17, 0xa8, 0xd1, 0x75, 0xc9, 0x8b,
+  0x00, 0xed, 0x82, 0x71, 0x07, 0xeb, 0xb2, 0xad, 0xa3, 0x9f, 0xb2, 0x70, 0xe0, 0x42, 0xa4, 0x3d,
+  0xf4, 0x7b, 0x0c, 0x2a, 0xd7, 0xe3, 0xbd, 0xe2, 0xc9, 0xf8, 0x2a, 0xac, 0x30, 0xbc, 0xc6, 0x43,
+  0x75, 0xac, 0x39, 0x6e, 0xcb, 0x8b, 0x47, 0x03, 0x2c, 0x87, 0xbe, 0x3d, 0xf6, 0xd7, 0x15, 0xdb,
+  0x03, 0x2b, 0x0f, 0x23, 0xac, 0x24, 0x01, 0x80, 0x55, 0x09, 0xd2, 0x6d, 0xc5, 0x39, 0x02, 0x9a,
+  0xc6, 0xcb, 0x65, 0x5c, 0x37, 0x78, 0x8c, 0xaa, 0x4c, 0x6a, 0x78, 0x72, 0x3c, 0xa5, 0xe1, 0xc5,
+  0x6a, 0x2b, 0x7a, 0xa3, 0x58, 0x6e, 0x80, 0x90, 0xa9, 0x55, 0x62, 0x56, 0xc4, 0x1f, 0xb8, 0x95,
+  0x26, 0x87, 0x6a, 0x58, 0x91, 0xd2, 0xe3, 0x26, 0xd2, 0x5f, 0xb4, 0x46, 0xec, 0x23, 0x9a, 0x07,
+  0x9b, 0x69, 0x3b, 0xc8, 0xc4, 0xd8, 0xd3, 0x08, 0xc6, 0x6c, 0xa9, 0x1e, 0xe3, 0xce, 0x62, 0xc9,
+  0xd3, 0xf9, 0xbc, 0x66, 0xc0, 0x35, 0x6a, 0xed, 0x49, 0xb8, 0xad, 0x49, 0x27, 0xaf, 0x08, 0x2c,
+  0x97, 0xb5, 0xee, 0xfb, 0xb4, 0xaa, 0x8f, 0xc5, 0x26, 0xdf, 0x4a, 0x94, 0x90, 0x11, 0x39, 0x1b,
+  0xf8, 0x9b, 0xb0, 0x4d, 0xb1, 0xb0, 0x18, 0xac, 0xa9, 0xc2, 0xe4, 0xa8, 0xef, 0x55, 0x58, 0x01,
+  0x19, 0xf8, 0xd5, 0xb3, 0x49, 0x05, 0xc9, 0xae, 0x71, 0x44, 0x4f, 0x95, 0x5b, 0x9c, 0x47, 0xe2,
+  0xc1, 0xdb, 0xd7, 0x8a, 0x12, 0xc6, 0x00, 0x99, 0xc3, 0x07, 0x3b, 0xb2, 0x96, 0x31, 0x68, 0xe5,
+  0xc8, 0x69, 0xb7, 0x75, 0x76, 0x87, 0xbd, 0xa8, 0x33, 0x88, 0xc7, 0x62, 0x01, 0xed, 0x05, 0x4f,
+  0x35, 0x11, 0xab, 0x77, 0x4d, 0x59, 0x8e, 0xfa, 0x90, 0xe9, 0xf3, 0xd0, 0x69, 0xb2, 0x29, 0xdd,
+  0x01, 0x65, 0x98, 0x1e, 0x73, 0xb0, 0x47, 0xf3, 0x76, 0x4c, 0x1f, 0x67, 0x63, 0x3d, 0xc0, 0xa3,
+  0x43, 0x16, 0xdc, 0x1c, 0xb4, 0x31, 0x07, 0x1f, 0xe7, 0x83, 0xf4, 0x80, 0x1a, 0x14, 0x42, 0x70,
+  0xad, 0x1b, 0x8a, 0x12, 0x6d, 0x76, 0xfd, 0x04, 0x76, 0xcb, 0x4c, 0xd8, 0xb1, 0x7c, 0xa4, 0xd2,
+  0x7e, 0xb6, 0x51, 0x7e, 0x77, 0x30, 0x82, 0x3e, 0xba, 0x5e, 0xde, 0x96, 0x46, 0x8f, 0xde, 0xa5,
+  0x75, 0x54, 0xd2, 0x43, 0xf9, 0xc0, 0x1f, 0x3a, 0x79, 0xbe, 0x43, 0x69, 0xc5, 0x77, 0x81, 0xe3,
+  0x89, 0xf8, 0x95, 0x93, 0xa6, 0x36, 0x8a, 0xd6, 0x4c, 0x76, 0xb3, 0x4c, 0x46, 0xe2, 0x9a, 0xa4,
+  0xe8, 0x0d, 0x38, 0x84, 0xf4, 0x71, 0x3b, 0xa4, 0x49, 0xac, 0xa3, 0x67, 0x6a, 0x05, 0x48, 0x06,
+  0x59, 0xec, 0xc2, 0xcc, 0x2d, 0x8f, 0x01, 0x56, 0x36, 0x1a, 0x84, 0xaa, 0x51, 0x1a, 0xc5, 0x4b,
+  0x4a, 0x41, 0xb2, 0x1c, 0x9c, 0x38, 0xe3, 0x9c, 0x54, 0x98, 0x60, 0xa7, 0x21, 0x63, 0xa0, 0x62,
+  0x42, 0x94, 0x6a, 0x00, 0x4b, 0x20, 0xa6, 0xb9, 0xe2, 0x8e, 0x68, 0x44, 0xb2, 0x0e, 0x83, 0x44,
+  0x86, 0x2b, 0xcb, 0x0d, 0xc4, 0xb1, 0xb5, 0x4b, 0x2e, 0x7b, 0x0e, 0xb9, 0x41, 0xec, 0x79, 0x3e,
+  0x0e, 0x62, 0xcf, 0x8d, 0x10, 0xe2, 0x6e, 0xfd, 0x35, 0x73, 0x2f, 0xc3, 0xf6, 0xe0, 0x27, 0x2b,
+  0x38, 0xd9, 0x40, 0x92, 0x53, 0xe2, 0x06, 0x9c, 0x1d, 0x4d, 0x9e, 0x85, 0x22, 0x65, 0x78, 0xc3,
+  0x1a, 0x63, 0x74, 0x09, 0x57, 0xf1, 0x01, 0xf5, 0x36, 0x77, 0xd4, 0x95, 0xc5, 0x92, 0xe8, 0x87,
+  0x61, 0xc2, 0x18, 0xed, 0xb4, 0xf0, 0xba, 0x97, 0x8b, 0xa5, 0xcf, 0x1d, 0xb0, 0xa8, 0xe0, 0xfb,
+  0x8a, 0xba, 0x84, 0xc5, 0x23, 0x03, 0x1b, 0xe7, 0xc1, 0x07, 0x93, 0xc7, 0x13, 0xb0, 0xa3, 0x80,
+  0x8f, 0x0d, 0xbd, 0x07, 0x04, 0xce, 0xf4, 0xcc, 0xe1, 0x42, 0x30, 0xfd, 0x48, 0x36, 0xd2, 0xbc,
+  0x67, 0xca, 0x30, 0x12, 0x6e, 0xbc, 0x98, 0xc6, 0x41, 0x14, 0xaa, 0x59, 0x05, 0x41, 0x44, 0x64,
+  0xe7, 0x8f, 0x7c, 0xd5, 0x9a, 0xb8, 0x95, 0x6e, 0xb6, 0x0c, 0x91, 0xec, 0xae, 0x01, 0x98, 0xbd,
+  0x00, 0x92, 0x24, 0x5e, 0x5c, 0x10, 0xa2, 0x2b, 0x4a, 0x55, 0x61, 0x21, 0x61, 0xe3, 0x95, 0x5d,
+  0xe4, 0x21, 0xdf, 0x3d, 0xd3, 0xbe, 0x87, 0x2b, 0x87, 0xe2, 0xc8, 0x0d, 0x23, 0x9c, 0x22, 0x1c,
+  0xde, 0x3d, 0xec, 0xf0, 0x86, 0xf3, 0x52, 0xdd, 0x00, 0x17, 0x5b, 0xaa, 0xaf, 0x5a, 0x92, 0x5d,
+  0xca, 0x78, 0x7b, 0xbe, 0xc5, 0x63, 0xf1, 0xb6, 0x95, 0x5d, 0xd8, 0xc7, 0x2d, 0xda, 0x79, 0xb8,
+  0x8f, 0x64, 0x05, 0x42, 0xc6, 0x19, 0x3b, 0xee, 0xfe, 0x46, 0xb2, 0xd6, 0x82, 0xaa, 0x2c, 0x7f,
+  0x28, 0xef, 0xf6, 0x42, 0xe2, 0xec, 0xd1, 0xba, 0xdf, 0x12, 0xab, 0x07, 0x65, 0x19, 0x85, 0x67,
+  0x31, 0xbb, 0xf3, 0xa7, 0x56, 0x01, 0x8b, 0x6c, 0x16, 0x8c, 0x47, 0x6a, 0x4d, 0xae, 0x7b, 0xee,
+  0x4b, 0xb8, 0xbd, 0x2c, 0xb5, 0x32, 0xca, 0x84, 0xde, 0x69, 0x17, 0x19, 0x4f, 0x79, 0x5a, 0x24,
+  0x0f, 0xcd, 0x95, 0x0c, 0x66, 0xc4, 0xeb, 0x64, 0x81, 0x98, 0x55, 0xc9, 0x6d, 0xbb, 0xa6, 0x39,
+  0xde, 0x20, 0x5e, 0x8d, 0xb8, 0x19, 0xd1, 0x13, 0x79, 0x2d, 0x4f, 0x52, 0xe3, 0x08, 0xfa, 0xc9,
+  0x51, 0x2c, 0x2c, 0x32, 0xac, 0xc4, 0xb8, 0x9d, 0x01, 0x19, 0x6f, 0xc0, 0x46, 0x72, 0x3d, 0x9c,
+  0x3b, 0xc8, 0xd7, 0x87, 0x0d, 0x54, 0xca, 0x45, 0x7b, 0xfe, 0x8f, 0x91, 0x72, 0x04, 0x02, 0x8d,
+  0xf7, 0x4d, 0xc6, 0xa5, 0x7d, 0xd8, 0xea, 0x0d, 0xa7, 0x25, 0xd1, 0xdd, 0x73, 0xc8, 0x73, 0xba,
+  0x3b, 0x39, 0x03, 0xcf, 0xcb, 0x95, 0x0b, 0xac, 0x9b, 0xaf, 0x8e, 0x97, 0xe8, 0x74, 0xf1, 0x30,
+  0x52, 0x18, 0x11, 0xbf, 0x14, 0xa1, 0x62, 0xb8, 0xb4, 0x61, 0xe1, 0xdd, 0x45, 0xca, 0xb8, 0x0b,
+  0x49, 0xb4, 0x07, 0xdf, 0xae, 0xdf, 0xcb, 0x23, 0x79, 0xc9, 0x11, 0x35, 0xd8, 0x2f, 0x42, 0xb9,
+  0xc7, 0x2a, 0xc3, 0xd9, 0x6b, 0xf0, 0x8a, 0x68, 0x56, 0x3a, 0x87, 0x3b, 0xf1, 0xea, 0x90, 0xb4,
+  0xd6, 0x97, 0xc5, 0xba, 0xac, 0x65, 0x53, 0xb1, 0xcb, 0x7a, 0x49, 0x6a, 0xe9, 0x3c, 0xe5, 0xbc,
+  0xaf, 0x27, 0x23, 0xdd, 0x55, 0xf2, 0x0d, 0xad, 0xab, 0xda, 0x6d, 0x31, 0x38, 0x03, 0x0e, 0x5a,
+  0x09, 0xf8, 0x9b, 0x30, 0xe1, 0xa0, 0x2d, 0xac, 0x0b, 0xdc, 0x9d, 0xcf, 0x21, 0x21, 0x66, 0x7d,
+  0xd5, 0xdc, 0x23, 0x28, 0x0c, 0x8e, 0x2e, 0x98, 0x46, 0x18, 0x78, 0x77, 0x99, 0x1e, 0xd5, 0xae,
+  0xf4, 0x14, 0x7a, 0x11, 0xb9, 0x17, 0xa7, 0xf8, 0x1e, 0x11, 0x70, 0xec, 0x48, 0x1e, 0xce, 0xd0,
+  0x05, 0x50, 0xdc, 0x64, 0x2c, 0x53, 0x50, 0xf3, 0x37, 0x55, 0xda, 0xcb, 0x97, 0xad, 0xb8, 0xca,
+  0xf1, 0x63, 0xbd, 0x84, 0x51, 0x01, 0x41, 0x1b, 0x94, 0xde, 0x43, 0x9a, 0x5f, 0xa5, 0x09, 0xe5,
+  0x81, 0x92, 0xb8, 0xaf, 0xd6, 0x41, 0x04, 0xa3, 0x8a, 0xaa, 0x01, 0x53, 0xbe, 0x00, 0x50, 0x55,
+  0xb0, 0xd8, 0xed, 0xe2, 0xc5, 0x75, 0xb0, 0x74, 0x74, 0x19, 0x58, 0x0f, 0x77, 0xad, 0x31, 0x7b,
+  0xd9, 0xa2, 0xb2, 0x48, 0x65, 0xea, 0xb1, 0x32, 0x87, 0x51, 0x27, 0xdc, 0x73, 0x15, 0x0a, 0x54,
+  0xdf, 0x67, 0x45, 0x6c, 0xae, 0xd2, 0xf3, 0x70, 0xf9, 0xc4, 0xf4, 0x74, 0xcc, 0xf2, 0x6f, 0x37,
+  0xaf, 0xb8, 0x61, 0xad, 0x79, 0xc3, 0xa8, 0x65, 0x16, 0xc0, 0x0d, 0xdd, 0xd3, 0x2a, 0x52, 0xab,
+  0x9a, 0x3a, 0xe0, 0x1f, 0x7a, 0x20, 0x2a, 0x80, 0xb5, 0x71, 0x7b, 0x3a, 0x6f, 0x03, 0x38, 0xa2,
+  0xe5, 0x8f, 0xe1, 0x6a, 0xc4, 0xfe, 0x1a, 0x74, 0xb2, 0x2e, 0x9d, 0x8e, 0xa6, 0x7e, 0x5a, 0xe5,
+  0x2b, 0x84, 0x93, 0xe7, 0x1b, 0xd5, 0xc0, 0x7a, 0x74, 0xb8, 0x4b, 0x1d, 0x9b, 0x7b, 0xf2, 0x79,
+  0x22, 0xd1, 0x72, 0xd7, 0x4b, 0x7c, 0x88, 0x39, 0x72, 0x5d, 0xf2, 0xab, 0x33, 0x43, 0x6b, 0x5f,
+  0xde, 0xa8, 0xc2, 0x51, 0x2e, 0xc8, 0x70, 0x8e, 0x48, 0x4e, 0x5d, 0x8b, 0x02, 0x92, 0xf6, 0x3b,
+  0x39, 0xd1, 0x27, 0x50, 0xf0, 0x7c, 0x09, 0x3f, 0x21, 0x58, 0xe1, 0x1c, 0x4e, 0x37, 0x1d, 0xb8,
+  0xd3, 0x5b, 0x2e, 0xf4, 0x5a, 0x60, 0xef, 0x66, 0xc8, 0x17, 0xbd, 0x4b, 0xd2, 0xf1, 0x15, 0x98,
+  0x15, 0x79, 0x4f, 0x7f, 0xe5, 0x25, 0xe0, 0x06, 0xbf, 0xde, 0xdd, 0xe4, 0x98, 0xc6, 0x97, 0xc7,
+  0x5e, 0xa6, 0x9f, 0x43, 0xc8, 0x9b, 0x25, 0x48, 0xc8, 0x8c, 0x07, 0xe1, 0xb2, 0x86, 0x7f, 0x8a,
+  0x80, 0x33, 0x96, 0x1b, 0xc5, 0x02, 0x94, 0x7c, 0xd2, 0x58, 0x49, 0x28, 0x1a, 0xbd, 0x5c, 0xa7,
+  0xd1, 0xa1, 0x3d, 0x05, 0xb5, 0x70, 0x29, 0x56, 0xb1, 0x80, 0x1e, 0xd9, 0x2d, 0x36, 0x41, 0x7b,
+  0x48, 0xe8, 0xfd, 0xfa, 0x08, 0xdd, 0xa5, 0x8f, 0x8a, 0x03, 0xa8, 0xa4, 0xee, 0x50, 0x11, 0x56,
+  0xd0, 0x27, 0x08, 0xca, 0xc3, 0xce, 0x86, 0xb5, 0x05, 0xa7, 0xb4, 0xae, 0x1d, 0x2f, 0x7b, 0xe0,
+  0x97, 0xee, 0xe6, 0x48, 0xc3, 0x45, 0x8f, 0x53, 0xec, 0xe8, 0x0b, 0xe0, 0xed, 0xbc, 0x4e, 0xa7,
+  0xf6, 0xc6, 0xf0, 0x71, 0xa9, 0x39, 0x60, 0x73, 0x6d, 0xeb, 0xdd, 0x69, 0x50, 0xd7, 0x4b, 0x2b,
+  0xac, 0x01, 0xe1, 0xe7, 0xed, 0x95, 0x1c, 0x6e, 0x15, 0x11, 0xb8, 0xc1, 0x12, 0xd3, 0xd3, 0x26,
+  0x40, 0x09, 0x3f, 0x70, 0xcc, 0x44, 0x77, 0x57, 0x1c, 0x02, 0x4e, 0x7e, 0xc9, 0x95, 0x77, 0x2f,
+  0x37, 0xb7, 0x74, 0x9a, 0x97, 0x30, 0xf3, 0xd6, 0xc8, 0x5b, 0x55, 0xce, 0x5b, 0x47, 0x84, 0x02,
+  0x99, 0x07, 0xa6, 0x24, 0x34, 0xb2, 0x20, 0xf1, 0x61, 0xc9, 0x57, 0x15, 0x56, 0x12, 0xa3, 0x56,
+  0x6c, 0x77, 0x01, 0x78, 0x54, 0x1f, 0x64, 0xc7, 0xc6, 0xa1, 0x47, 0x64, 0xa8, 0x97, 0x0b, 0xd1,
+  0x8b, 0xce, 0x96, 0xc4, 0x8d, 0x90, 0xd0, 0xc5, 0x70, 0x17, 0x2f, 0x1a, 0x75, 0xf7, 0x01, 0xe5,
+  0xb2, 0xc1, 0x3d, 0x17, 0x4d, 0x38, 0x57, 0xeb, 0xae, 0x41, 0x1f, 0x6f, 0xd9, 0xb5, 0xcb, 0x93,
+  0x71, 0x13, 0xb0, 0xb2, 0xd1, 0xd4, 0x1a, 0xca, 0xdb, 0x15, 0x17, 0xe3, 0x88, 0x2d, 0x59, 0x0d,
+  0x0b, 0x00, 0x74, 0x32, 0x72, 0x50, 0xc3, 0xf0, 0x31, 0xbd, 0x45, 0xee, 0x91, 0x63, 0xfc, 0xbe,
+  0xba, 0x50, 0x74, 0x87, 0x53, 0x86, 0xec, 0x1e, 0xce, 0x7a, 0x17, 0xa1, 0xf3, 0xa0, 0xf3, 0x41,
+  0x6f, 0xde, 0xfa, 0xae, 0xd8, 0x0e, 0xdc, 0x61, 0xcf, 0x2c, 0xd7, 0xd6, 0xda, 0x02, 0x06, 0xbe,
+  0xd7, 0xa4, 0x40, 0x2e, 0xdc, 0xcd, 0x70, 0x0c, 0x2f, 0xf3, 0xea, 0xbd, 0x4e, 0x01, 0x35, 0xa0,
+  0xd4, 0x67, 0x85, 0x6e, 0xe5, 0x29, 0x8c, 0x99, 0xa6, 0x72, 0xa4, 0x29, 0xe4, 0xc4, 0xf5, 0x1c,
+  0x01, 0xc0, 0x9d, 0x23, 0x61, 0x67, 0x85, 0x14, 0x7b, 0x29, 0xc2, 0x40, 0x49, 0x81, 0x95, 0x53,
+  0x46, 0x02, 0x33, 0x5b, 0xfb, 0x21, 0x04, 0x57, 0x4a, 0x4a, 0xec, 0x6d, 0x2a, 0xb6, 0xdd, 0xdf,
+  0x80, 0x01, 0x8a, 0x41, 0x8f, 0xe4, 0x00, 0xf0, 0x1d, 0xa4, 0x4e, 0xbe, 0x4f, 0x1d, 0x3b, 0x04,
+  0x88, 0xae, 0xda, 0x94, 0x55, 0x98, 0x55, 0x41, 0x49, 0x77, 0x3d, 0x18, 0x39, 0x0a, 0x89, 0xf1,
+  0xb5, 0x70, 0xc9, 0xce, 0x9e, 0x35, 0x20, 0xa3, 0xb8, 0x83, 0x59, 0x0b, 0x53, 0x9d, 0x95, 0x36,
+  0x66, 0xbb, 0xa0, 0x4b, 0x27, 0xf9, 0x35, 0x45, 0xb1, 0xbd, 0x64, 0xe0, 0x61, 0xa2, 0x46, 0xba,
+  0xe3, 0x8a, 0x5c, 0x3c, 0x4b, 0xe7, 0x81, 0xbe, 0x90, 0xa3, 0x9e, 0xad, 0xef, 0x17, 0xca, 0x29,
+  0x4d, 0x37, 0x04, 0xaa, 0x86, 0xa8, 0xdd, 0x18, 0xb8, 0x24, 0x8a, 0x8a, 0x6d, 0x11, 0x2b, 0xfb,
+  0x7c, 0xc7, 0x0e, 0x9c, 0xb7, 0x98, 0xc9, 0xda, 0xb8, 0x38, 0x14, 0x5f, 0x3d, 0xec, 0x71, 0x55,
+  0xa8, 0xf5, 0xa1, 0x3f, 0xe4, 0x83, 0x9b, 0xd8, 0x6a, 0xb7, 0xdd, 0x05, 0x85, 0xca, 0x47, 0xda,
+  0x3d, 0xa8, 0x20, 0xaf, 0xbb, 0xb7, 0x4e, 0x73, 0x57, 0x05, 0x92, 0x92, 0x8b, 0x6a, 0xa4, 0x8e,
+  0x73, 0xe6, 0x71, 0x44, 0x09, 0x99, 0x04, 0x52, 0xa5, 0xd2, 0x8d, 0xd3, 0x84, 0x97, 0x91, 0x82,
+  0xbe, 0xa9, 0xd7, 0x11, 0x44, 0x75, 0x0f, 0xe1, 0x9e, 0xef, 0x92, 0x30, 0x0f, 0xab, 0x8a, 0x08,
+  0x5e, 0x83, 0x4d, 0x8d, 0x6f, 0xcb, 0x23, 0x3c, 0x6f, 0x81, 0x64, 0xb5, 0x24, 0xe3, 0x0a, 0x89,
+  0xa8, 0x4e, 0xb5, 0xa0, 0x5f, 0xb7, 0xed, 0x08, 0x1f, 0x2e, 0x0b, 0x12, 0xa5, 0xaa, 0xdb, 0xde,
+  0x47, 0xe9, 0xb0, 0x47, 0x81, 0xf0, 0xe1, 0x4b, 0xa7, 0x88, 0x6d, 0xd8, 0x71, 0x3d, 0x04, 0x27,
+  0xc3, 0xd4, 0x34, 0x49, 0x68, 0x96, 0xc7, 0x3d, 0xc4, 0xf8, 0xc3, 0x9d, 0xdf, 0xdd, 0x81, 0xc9,
+  0xec, 0x75, 0x7f, 0x9b, 0x43, 0xc1, 0xc9, 0x03, 0x20, 0x99, 0xc8, 0xaa, 0x60, 0xea, 0xa1, 0xdb,
+  0x43, 0x8b, 0x0e, 0x8c, 0x1c, 0x52, 0xa2, 0x85, 0x01, 0xcd, 0x85, 0x40, 0x8e, 0x7c, 0x42, 0x5b,
+  0x96, 0x8b, 0x88, 0xa7, 0x6a, 0x0b, 0x54, 0x5c, 0x9e, 0xef, 0x28, 0xb7, 0xfb, 0xa2, 0x12, 0x41,
+  0xdd, 0xac, 0x93, 0x63, 0x29, 0x32, 0x13, 0x04, 0x60, 0xa6, 0x06, 0x16, 0xe0, 0xa6, 0xa9, 0x4f,
+  0x3c, 0x32, 0x1f, 0xe5, 0x13, 0xcf, 0xb8, 0x54, 0x2c, 0xd6, 0x27, 0xe7, 0x00, 0xf1, 0x06, 0x24,
+  0x55, 0x3d, 0x49, 0x98, 0xcd, 0x59, 0xa5, 0xf1, 0xe1, 0xd2, 0x6d, 0x47, 0x68, 0x13, 0x2e, 0x58,
+  0x39, 0xd1, 0x3a, 0x2a, 0x6c, 0x74, 0xc2, 0x70, 0xe5, 0x19, 0x41, 0xf3, 0xa3, 0x61, 0x75, 0x2e,
+  0x26, 0xcd, 0x9b, 0x6b, 0x6e, 0xee, 0x65, 0x0c, 0x07, 0xd6, 0x09, 0x0e, 0x84, 0x20, 0x50, 0x71,
+  0xc6, 0x2c, 0x1b, 0x04, 0xdd, 0x3c, 0x88, 0x1e, 0x29, 0x5a, 0xb9, 0xe6, 0x0f, 0xec, 0x02, 0xd6,
+  0xe1, 0x90, 0x74, 0x61, 0x13, 0x11, 0x92, 0x25, 0x65, 0x6e, 0xbf, 0x13, 0xdf, 0x23, 0x14, 0x88,
+  0x10, 0xad, 0x09, 0x23, 0x36, 0x56, 0xe0, 0x31, 0x6c, 0xde, 0x44, 0x6c, 0x3c, 0x00, 0xea, 0x01,
+  0x4e, 0x51, 0x6f, 0xb4, 0xe1, 0x99, 0x49, 0xae, 0xb4, 0xad, 0xac, 0x9b, 0x57, 0x4d, 0xe9, 0x16,
+  0xf8, 0xa8, 0xd8, 0x79, 0x87, 0xf0, 0x72, 0x0b, 0xf4, 0xe9, 0x5c, 0x76, 0xb7, 0x9e, 0x86, 0x52,
+  0x91, 0x5c, 0x1f, 0x53, 0x7b, 0x8a, 0xb3, 0x3d, 0x9d, 0x13, 0xc1, 0xde, 0x79, 0xa0, 0x87, 0x0d,
+  0x3a, 0xdd, 0xd7, 0x33, 0xba, 0xc6, 0xfe, 0x10, 0x43, 0x91, 0x8a, 0xd4, 0xd1, 0xf9, 0x2e, 0x8a,
+  0x06, 0x99, 0xdb, 0xf3, 0x32, 0x54, 0x81, 0xb1, 0xba, 0xfe, 0x24, 0x45, 0xb0, 0x10, 0x46, 0x8b,
+  0xd3, 0x5c, 0x6b, 0x8b, 0x02, 0x6a, 0x1e, 0x4d, 0xee, 0x7d, 0xb3, 0x46, 0x48, 0xf1, 0xa8, 0x56,
+  0xc5, 0x7f, 0x0c, 0xb1, 0x31, 0x59, 0x0f, 0x92, 0xd1, 0x4b, 0x44, 0x0a, 0xd8, 0x02, 0x9f, 0x2e,
+  0x16, 0x92, 0x73, 0xad, 0xdf, 0xb5, 0x91, 0xe1, 0xa7, 0x54, 0x74, 0x2a, 0x07, 0x09, 0xcf, 0x9e,
+  0x75, 0x2a, 0x45, 0x46, 0x45, 0x75, 0x0c, 0x82, 0xe3, 0xa1, 0xcf, 0xa9, 0xb5, 0x73, 0x70, 0xca,
+  0x1d, 0x07, 0xc3, 0x32, 0x54, 0x3d, 0xc5, 0x21, 0x13, 0xe7, 0x00, 0xcb, 0x7f, 0xb0, 0x8d, 0xab,
+  0xe0, 0x72, 0x52, 0x1b, 0x14, 0x85, 0xcf, 0x72, 0x8d, 0x99, 0x6b, 0x39, 0x5e, 0x0b, 0x58, 0xa1,
+  0x0c, 0x6a, 0x2e, 0x57, 0xa2, 0xb6, 0xaf, 0x4b, 0xe0, 0xe8, 0x38, 0x33, 0x02, 0x47, 0x53, 0x54,
+  0xc7, 0x68, 0x61, 0xb0, 0xe6, 0xe1, 0x77, 0x92, 0x7d, 0x6b, 0x2d, 0xb4, 0xac, 0xc3, 0xc7, 0xcd,
+  0x30, 0x0b, 0xe0, 0x08, 0x44, 0x9d, 0xd2, 0x90, 0xb6, 0xe8, 0xea, 0x0f, 0x3e, 0x3a, 0x7b, 0x14,
+  0xd1, 0x41, 0x32, 0x60, 0x17, 0xf0, 0xbd, 0x38, 0x8c, 0xb0, 0x7b, 0x7d, 0xf8, 0xe5, 0x0d, 0x90,
+  0x6b, 0xb8, 0xa8, 0xbc, 0x42, 0xe9, 0xa3, 0xdb, 0xfd, 0x0c, 0xd2, 0x0b, 0x26, 0xa3, 0x98, 0x21,
+  0x54, 0xeb, 0xa5, 0xeb, 0x9c, 0xe9, 0x98, 0xca, 0x9a, 0x45, 0x0e, 0x0f, 0xab, 0xb8, 0xa1, 0xc5,
+  0x2a, 0x35, 0xf4, 0x9e, 0x80, 0x1a, 0x36, 0xc3, 0xed, 0x59, 0x81, 0x0a, 0xdb, 0x28, 0x96, 0x83,
+  0x60, 0xaf, 0x17, 0x02, 0xc4, 0x50, 0x1e, 0x90, 0xa4, 0x12, 0xc6, 0x42, 0x9d, 0x46, 0xce, 0x2c,
+  0x71, 0xf5, 0xa8, 0xa3, 0x82, 0xf4, 0xb1, 0xfe, 0xe0, 0x1c, 0xa2, 0x0c, 0xd3, 0x9a, 0x4c, 0x23,
+  0xcb, 0x41, 0x04, 0x49, 0xad, 0x4a, 0xa4, 0xa9, 0x96, 0x55, 0xa5, 0x93, 0xd4, 0xf4, 0xa8, 0x3d,
+  0x80, 0x93, 0xc7, 0x98, 0x62, 0x61, 0xe4, 0x9c, 0x2d, 0x13, 0x51, 0x35, 0x05, 0x7b, 0x70, 0xa2,
+  0x23, 0x8c, 0xb6, 0x43, 0xee, 0x36, 0x15, 0x98, 0xd9, 0x3e, 0x1b, 0xd8, 0xc9, 0xce, 0xbf, 0x84,
+  0xc1, 0x7e, 0x37, 0x72, 0xa5, 0xcd, 0xef, 0x79, 0xcc, 0x90, 0x1a, 0xa4, 0x13, 0x49, 0xeb, 0x80,
+  0x48, 0x2c, 0x1d, 0xb1, 0xe0, 0x05, 0xd2, 0xfa, 0xbd, 0x84, 0x57, 0xc2, 0x34, 0xc3, 0x08, 0xe1,
+  0xb4, 0x5a, 0xc2, 0x89, 0x8c, 0xd7, 0x89, 0x6f, 0x52, 0xe4, 0x14, 0x86, 0xed, 0x25, 0x36, 0xa7,
+  0x29, 0x42, 0x08, 0xcc, 0xcd, 0x41, 0xe9, 0xac, 0x3b, 0xda, 0x65, 0x72, 0x99, 0xd8, 0xc6, 0x29,
+  0xae, 0x3f, 0x4c, 0xe5, 0x7a, 0xb2, 0xef, 0x2c, 0x86, 0x52, 0xba, 0x6a, 0x34, 0x5a, 0x76, 0xf4,
+  0x94, 0xb3, 0x4a, 0x8c, 0x3e, 0x8e, 0xd7, 0x9c, 0x07, 0x73, 0x0c, 0xa9, 0x39, 0x47, 0x0d, 0xef,
+  0x30, 0x72, 0x5c, 0xec, 0x04, 0xc9, 0x52, 0xc2, 0x52, 0x24, 0xb1, 0x0f, 0x91, 0xb9, 0xf2, 0x23,
+  0xcf, 0x81, 0x6e, 0xfe, 0xf5, 0x64, 0x0f, 0xdd, 0xe6, 0x65, 0xa5, 0x3c, 0x53, 0x41, 0xa3, 0x56,
+  0xf0, 0x4a, 0xae, 0x55, 0x17, 0x62, 0xb4, 0x51, 0x7a, 0x98, 0x43, 0x55, 0x17, 0x86, 0x3e, 0xb5,
+  0x9b, 0x70, 0x76, 0xbd, 0xa3, 0x75, 0x10, 0x24, 0x37, 0x4a, 0xf7, 0x60, 0x09, 0xa0, 0x58, 0x2a,
+  0xac, 0x23, 0x3d, 0x10, 0xa2, 0x73, 0x3f, 0x72, 0x0b, 0x77, 0x36, 0x86, 0x2b, 0xa3, 0xcd, 0x1c,
+  0xdf, 0x98, 0xe2, 0xfd, 0xd2, 0x09, 0x07, 0x97, 0x82, 0xac, 0x65, 0xb0, 0x87, 0xea, 0xa2, 0x70,
+  0xa2, 0xd6, 0x5c, 0xe7, 0x3e, 0x84, 0x26, 0xbb, 0x59, 0x60, 0xaf, 0x4c, 0x08, 0x7d, 0x78, 0xb8,
+  0xda, 0xf9, 0x76, 0x70, 0x5d, 0x51, 0x2d, 0xca, 0x2b, 0x1a, 0xc4, 0x30, 0x73, 0xee, 0xef, 0xa8,
+  0x74, 0x7b, 0x5c, 0xf9, 0xea, 0x44, 0xe5, 0xda, 0xd2, 0x97, 0xe7, 0xb9, 0xc0, 0x5c, 0xc8, 0xf1,
+  0xd8, 0xd2, 0x70, 0xe9, 0x58, 0xbf, 0x27, 0x82, 0x5a, 0x68, 0x07, 0xff, 0xe1, 0x9a, 0xfd, 0xe5,
+  0xe6, 0x9e, 0x7c, 0xeb, 0xe0, 0xe6, 0x52, 0x68, 0x9a, 0x17, 0x3a, 0x98, 0xda, 0x56, 0x82, 0x1f,
+  0xdc, 0x59, 0x12, 0x93, 0x04, 0x2d, 0x54, 0x6d, 0xaf, 0x34, 0x6b, 0xd3, 0x12, 0xed, 0xfd, 0xe4,
+  0x69, 0xee, 0xec, 0x43, 0x7d, 0x8c, 0xc5, 0xd5, 0x85, 0xbd, 0x17, 0x2d, 0xb8, 0xa7, 0x05, 0x02,
+  0xd8, 0xac, 0xa8, 0x4a, 0x0a, 0xf1, 0x2d, 0x2b, 0x99, 0x2e, 0x1a, 0x7c, 0xd0, 0x36, 0x74, 0x0b,
+  0x1b, 0x88, 0xee, 0xac, 0x0e, 0xdb, 0x9d, 0xab, 0x66, 0x7f, 0x6c, 0x8f, 0xbc, 0x84, 0x4e, 0x7e,
+  0x12, 0x4e, 0xcf, 0xb7, 0x63, 0x59, 0xfe, 0x58, 0x1e, 0xaf, 0x37, 0x33, 0xcd, 0xf1, 0xeb, 0x9a,
+  0xa3, 0x56, 0xb8, 0xbb, 0xa9, 0x23, 0xac, 0x3d, 0xf6, 0x7a, 0x92, 0xf6, 0x8b, 0x75, 0x2f, 0xd0,
+  0x0f, 0xd0, 0x23, 0x3c, 0xe1, 0xb7, 0x7b, 0x65, 0x35, 0xc1, 0xad, 0x08, 0x64, 0xe6, 0x80, 0xd1,
+  0x80, 0xa5, 0x25, 0x0a, 0x6f, 0x44, 0x99, 0x9d, 0x1b, 0x21, 0x5d, 0x2a, 0x22, 0xd5, 0xd8, 0xa5,
+  0x8f, 0x33, 0x94, 0x7d, 0x21, 0xf7, 0xc0, 0x87, 0x62, 0x02, 0xc8, 0x56, 0x89, 0x72, 0xae, 0xe3,
+  0xf4, 0x72, 0xbe, 0x20, 0xee, 0x55, 0x1a, 0x08, 0x32, 0xdb, 0x63, 0xb4, 0xd0, 0xf5, 0xdb, 0x30,
+  0xef, 0x96, 0xae, 0x65, 0x10, 0xd8, 0x32, 0x04, 0x51, 0x01, 0xbb, 0x0e, 0xad, 0x8d, 0xc1, 0x45,
+  0x87, 0x8e, 0xba, 0x44, 0xe0, 0xfb, 0xa5, 0xc1, 0x72, 0xca, 0x6d, 0x0e, 0x78, 0x7e, 0x66, 0xd7,
+  0x12, 0x24, 0xe5, 0xd1, 0x98, 0x74, 0x44, 0xae, 0xa1, 0x69, 0xaf, 0x01, 0x5b, 0xa7, 0xe4, 0xa0,
+  0x51, 0xaa, 0x2c, 0x8f, 0x64, 0xb5, 0x3b, 0x07, 0xdf, 0x77, 0x73, 0xaa, 0xec, 0x52, 0xa0, 0x23,
+  0x52, 0xc3, 0x7d, 0x04, 0x8e, 0x0b, 0xe2, 0xcc, 0x57, 0x8a, 0xc8, 0x50, 0x17, 0x8e, 0x01, 0xab,
+  0xd1, 0xc1, 0x14, 0x03, 0xde, 0x2e, 0x1a, 0x99, 0x97, 0x2c, 0xdf, 0x5d, 0xcc, 0x20, 0x32, 0x19,
+  0x0f, 0xb9, 0x16, 0x02, 0xde, 0x0d, 0x27, 0xa6, 0x34, 0x04, 0xf4, 0x14, 0x26, 0xda, 0x25, 0xd7,
+  0xcb, 0xfa, 0xd4, 0x79, 0x49, 0x40, 0xd8, 0x57, 0x5f, 0xb6, 0x3d, 0x73, 0xd7, 0xcd, 0xb0, 0xdc,
+  0x4e, 0xa0, 0xdc, 0x4e, 0x46, 0x91, 0x11, 0x16, 0x81, 0xeb, 0xc4, 0xc0, 0x8f, 0xa7, 0x7a, 0x95,
+  0x20, 0xd7, 0x23, 0x6b, 0x48, 0x74, 0x81, 0x38, 0x28, 0x6e, 0x02, 0x51, 0x15, 0x94, 0xd1, 0xe9,
+  0x8f, 0x35, 0x4c, 0x4e, 0xe9, 0x3a, 0xe6, 0x44, 0x83, 0xc5, 0x4b, 0x2f, 0x58, 0x39, 0x29, 0x40,
+  0x56, 0xa6, 0xe0, 0x27, 0x6a, 0x76, 0x68, 0x1b, 0x96, 0x76, 0xdb, 0x27, 0x8d, 0x64, 0xc0, 0x65,
+  0xca, 0xf6, 0x96, 0x10, 0xe3, 0xb4, 0xa6, 0xbe, 0x05, 0x3e, 0x78, 0xb2, 0x19, 0x1f, 0x33, 0x00,
+  0x42, 0x4c, 0xdd, 0x85, 0xc2, 0xdb, 0x4b, 0x77, 0x81, 0x43, 0x06, 0x6c, 0xb2, 0x52, 0xef, 0x37,
+  0xfa, 0xac, 0x5a, 0xe8, 0xc4, 0x1d, 0xd6, 0xb3, 0xdf, 0x5e, 0x1f, 0xce, 0x69, 0x4f, 0x07, 0x49,
+  0x8c, 0xed, 0x1e, 0x34, 0xce, 0xa6, 0xab, 0x76, 0x8d, 0x55, 0x54, 0x72, 0x4e, 0x80, 0x83, 0xd5,
+  0x10, 0x98, 0x69, 0xde, 0xa5, 0x3b, 0x2b, 0xd7, 0x24, 0xb9, 0x5e, 0xc3, 0x02, 0x1f, 0x9b, 0xad,
+  0x5f, 0x52, 0x20, 0x0b, 0x13, 0x72, 0x40, 0x5a, 0x66, 0xd1, 0xf3, 0xde, 0x55, 0x4a, 0x76, 0x29,
+  0xaf, 0x94, 0x81, 0xde, 0xc2, 0xed, 0xb6, 0x2e, 0x62, 0x8f, 0x93, 0x60, 0xf9, 0x40, 0x4e, 0x34,
+  0xea, 0xd1, 0x1c, 0x90, 0x8d, 0x3e, 0x0b, 0x37, 0x3a, 0xb8, 0xd6, 0x23, 0x5c, 0x1d, 0x89, 0xac,
+  0x0b, 0x53, 0x3b, 0x20, 0x86, 0x45, 0x20, 0x01, 0xe8, 0xd8, 0x66, 0x88, 0x4b, 0x07, 0x33, 0xb3,
+  0x2b, 0xf7, 0x70, 0xb6, 0xe5, 0x44, 0x24, 0x8e, 0xf1, 0xd6, 0x0f, 0x83, 0x3e, 0xf7, 0xf7, 0xc0,
+  0x92, 0x5b, 0x4c, 0x3a, 0x18, 0x17, 0xf7, 0x3a, 0x42, 0xcc, 0xa0, 0x5e, 0x67, 0x6f, 0x14, 0xbc,
+  0x3a, 0x37, 0x2d, 0xc1, 0xb7, 0xb7, 0x88, 0xeb, 0xdb, 0xf3, 0x01, 0xf4, 0x67, 0x9d, 0x20, 0x8f,
+  0x7e, 0x66, 0x87, 0xed, 0x63, 0x90, 0x08, 0xa8, 0xcf, 0x5d, 0xe9, 0x7e, 0x02, 0x23, 0x7a, 0x34,
+  0x28, 0x70, 0xa3, 0x57, 0x5f, 0x26, 0xed, 0x68, 0x6d, 0x15, 0xd3, 0x8c, 0x2e, 0x50, 0x77, 0xa7,
+  0xec, 0x16, 0x0c, 0xf8, 0x1e, 0x99, 0x15, 0x48, 0x73, 0x5a, 0x0d, 0xe3, 0xf7, 0x7b, 0x8d, 0x1c,
+  0xe0, 0xf3, 0x7d, 0x3c, 0xfb, 0x39, 0xa0, 0xf8, 0xb5, 0x7f, 0x38, 0xd1, 0xa3, 0x3f, 0x85, 0xd9,
+  0xe6, 0xd1, 0xec, 0xd4, 0x1b, 0x80, 0x03, 0x66, 0x08, 0xc3, 0x91, 0x8f, 0x20, 0x20, 0xca, 0xa7,
+  0x55, 0x3f, 0xdf, 0xc7, 0xb6, 0xf0, 0x63, 0x77, 0x3f, 0xa7, 0x69, 0xfa, 0xf6, 0xf6, 0x0a, 0xfe,
+  0xf8, 0x03, 0xf8, 0x7c, 0xad, 0xfc, 0x6f, 0x3f, 0x04, 0xdd, 0x0b, 0xf8, 0xc7, 0x97, 0xd2, 0xbf,
+  0x74, 0xfb, 0x7d, 0xf7, 0x6c, 0x93, 0xfc, 0x1e, 0xc5, 0xdb, 0xe5, 0xf5, 0xc7, 0x1f, 0xfa, 0x29,
+  0x7d, 0xf9, 0xd2, 0xcd, 0xfb, 0xfa, 0x6c, 0x4d, 0x7c, 0x7d, 0xf9, 0xd2, 0x92, 0xf8, 0xf6, 0xfa,
+  0x6c, 0x3c, 0x7c, 0x7d, 0x79, 0xf6, 0xfe, 0x32, 0xcd, 0xf2, 0xf6, 0x0a, 0xbd, 0x40, 0x2f, 0x08,
+  0x81, 0xbc, 0xc0, 0x28, 0xf6, 0xfa, 0xb2, 0x54, 0x65, 0xdd, 0xbf, 0xbd, 0x66, 0xc3, 0xd0, 0x7e,
+  0x0f, 0x82, 0xf3, 0x3c, 0x7f, 0x9a, 0xd1, 0x4f, 0x4d, 0x97, 0x82, 0x08, 0x04, 0x41, 0xe0, 0xbe,
+  0xe5, 0xeb, 0xf3, 0xad, 0x76, 0x3f, 0x8d, 0x5f, 0xb2, 0x2e, 0x4e, 0x76, 0x9e, 0xe6, 0xa6, 0x2b,
+  0xa3, 0xca, 0x6f, 0x3f, 0x3d, 0xd7, 0x7e, 0xa1, 0xb7, 0x6f, 0xf7, 0x1b, 0xb9, 0xf7, 0x7d, 0x77,
+  0xde, 0xc3, 0xbc, 0x0b, 0xcb, 0xf8, 0x25, 0x8f, 0xde, 0x7e, 0xeb, 0xd5, 0x78, 0x09, 0x77, 0x06,
+  0xbe, 0x83, 0xa1, 0xfd, 0x61, 0xfd, 0xfa, 0xd0, 0x0f, 0x5d, 0x73, 0xdf, 0x25, 0xea, 0xe2, 0xe8,
+  0xf5, 0x25, 0xc9, 0xcb, 0xf2, 0xed, 0x4b, 0xd7, 0xcc, 0xd7, 0x85, 0xef, 0x7e, 0x21, 0xb1, 0x33,
+  0xe2, 0xd7, 0x3b, 0x2b, 0x43, 0xfc, 0xe2, 0xff, 0xd2, 0xcc, 0xa1, 0x3c, 0xbb, 0x9a, 0x5f, 0xbb,
+  0x5d, 0xb8, 0x67, 0x2b, 0xd7, 0x2e, 0x07, 0xf2, 0x19, 0xfb, 0x4c, 0xbc, 0xbe, 0x44, 0x63, 0xb7,
+  0xcb, 0xf9, 0xe9, 0x80, 0xef, 0x14, 0xbb, 0xb8, 0xdd, 0xc3, 0x30, 0xdb, 0x8c, 0xf5, 0xf0, 0x7c,
+  0x27, 0x3f, 0x8a, 0x93, 0x67, 0x7b, 0x73, 0xfc, 0xce, 0x22, 0xf8, 0x85, 0xc7, 0xfd, 0x61, 0x97,
+  0xe6, 0x57, 0x6d, 0x3f, 0xd5, 0xfc, 0xa5, 0xd7, 0xe6, 0x9b, 0x67, 0xbb, 0xea, 0xb3, 0x91, 0x1a,
+  0xfd, 0x51, 0x78, 0x6f, 0xba, 0x7d, 0x76, 0x1b, 0x3c, 0x7b, 0x2b, 0x8c, 0xf7, 0xae, 0x83, 0x1f,
+  0xc0, 0x7d, 0xe1, 0x87, 0xf7, 0x0e, 0xd8, 0xa7, 0x98, 0xdf, 0xa4, 0xfd, 0x97, 0x6e, 0x84, 0x6f,
+  0xf6, 0x4d, 0x86, 0x6e, 0x5f, 0x89, 0x7e, 0x7c, 0x72, 0xf8, 0xf2, 0x03, 0xb8, 0x3f, 0xed, 0xa3,
+  0x77, 0xa0, 0xfe, 0xff, 0x3c, 0x7b, 0xb1, 0xf7, 0x4d, 0xdf, 0x27, 0xc1, 0x1d, 0xee, 0x57, 0xe0,
+  0x5b, 0xdc, 0xf5, 0xcf, 0xdd, 0xff, 0x04, 0x3f, 0xc5, 0xdd, 0x5f, 0x82, 0xcb, 0x57, 0xd3, 0x7c,
+  0x31, 0xe2, 0x6e, 0x5f, 0xff, 0x33, 0xca, 0xb3, 0x8f, 0xe5, 0x2f, 0x71, 0xec, 0x9c, 0xcf, 0x5f,
+  0x74, 0xc3, 0x38, 0xfd, 0x19, 0xe3, 0xd9, 0x0f, 0xf4, 0x97, 0x18, 0xfa, 0xb3, 0xaf, 0xe5, 0xcf,
+  0xd0, 0xef, 0xcd, 0x2e, 0x7f, 0x09, 0xae, 0x3c, 0x7b, 0xba, 0x5e, 0x92, 0xb2, 0x69, 0xfe, 0x89,
+  0xa9, 0xf7, 0x76, 0xaf, 0x3f, 0x22, 0x81, 0xef, 0xca, 0xfb, 0xdf, 0x35, 0x2f, 0x37, 0x51, 0x5c,
+  0xfd, 0xb9, 0xc3, 0xfc, 0x8f, 0x8a, 0x7f, 0x36, 0x39, 0x55, 0xe1, 0x3b, 0xc4, 0xef, 0x74, 0xff,
+  0xa5, 0xe3, 0x23, 0xaf, 0xd3, 0x97, 0xe1, 0x9f, 0x04, 0xd8, 0xed, 0xf1, 0xaf, 0x75, 0xda, 0x44,
+  0x63, 0xf9, 0xe5, 0x8c, 0xff, 0xac, 0xd2, 0x9d, 0xc6, 0x5f, 0xa2, 0xf0, 0xdd, 0xb3, 0x57, 0xa6,
+  0x0e, 0xd7, 0x3f, 0x63, 0x3c, 0xdb, 0xda, 0xfe, 0x12, 0xc3, 0x68, 0x9f, 0xdd, 0x32, 0x4f, 0xc6,
+  0x78, 0x3f, 0x1c, 0xfe, 0x59, 0x51, 0x7d, 0xf2, 0x97, 0x68, 0x6c, 0xf3, 0x8e, 0xa3, 0x3f, 0xaf,
+  0xc0, 0x9f, 0x30, 0xc2, 0xbf, 0xb6, 0x10, 0x26, 0x1f, 0xba, 0xbf, 0x80, 0x0e, 0xba, 0x7f, 0x23,
+  0x48, 0x14, 0x4f, 0xff, 0x24, 0x4c, 0xf4, 0xd7, 0x14, 0xfc, 0x3a, 0x7a, 0xbf, 0xa1, 0xff, 0x44,
+  0x63, 0xfe, 0xff, 0x7f, 0xd2, 0x92, 0xdf, 0x0f, 0x2f, 0x9a, 0x1f, 0xde, 0xe3, 0xe1, 0x45, 0x8f,
+  0xc3, 0x38, 0x9f, 0xe2, 0xe8, 0xcf, 0x47, 0xfd, 0x6c, 0xe2, 0x6c, 0xdf, 0x41, 0x7e, 0x77, 0xd2,
+  0xbf, 0x00, 0xef, 0x9e, 0xe1, 0xcf, 0x7c, 0x0c, 0xf9, 0xbf, 0xb8, 0x6c, 0x46, 0x9e, 0xd6, 0x7e,
+  0xf9, 0x97, 0x77, 0xe1, 0xd9, 0x79, 0xf8, 0xbf, 0xe1, 0x18, 0x8a, 0xfe, 0x4f, 0x47, 0x56, 0xff,
+  0x3b, 0x9d, 0xbe, 0xb7, 0x5b, 0xfe, 0x93, 0x56, 0xf7, 0xd9, 0xbf, 0xc2, 0x7b, 0x09, 0x9b, 0xf2,
+  0xd9, 0xdc, 0xf7, 0xf6, 0x0d, 0xf2, 0xcd, 0x57, 0x97, 0xff, 0xcd, 0x3f, 0xf7, 0x21, 0x7d, 0xf3,
+  0xeb, 0xe9, 0x87, 0xff, 0xab, 0xb2, 0xdf, 0xc3, 0xc7, 0xef, 0x54, 0xfe, 0xfa, 0xb5, 0xb5, 0x7c,
+  0x77, 0xa9, 0xbf, 0xf4, 0xb8, 0xbf, 0x3c, 0x2d, 0xb2, 0xa9, 0xcb, 0xdd, 0x2b, 0xbf, 0xbe, 0xbb,
+  0xec, 0x01, 0xde, 0xbd, 0x7b, 0xe7, 0xb7, 0x6f, 0xaf, 0x4d, 0x92, 0xbc, 0x7e, 0xf9, 0xfd, 0x88,
+  0xe7, 0xe4, 0x93, 0xc4, 0x57, 0x9c, 0x1f, 0x7f, 0x48, 0x9a, 0xae, 0x7a, 0xa9, 0xe2, 0x21, 0x6b,
+  0x76, 0x8c, 0x34, 0x1e, 0x5e, 0x5f, 0xf6, 0x8d, 0xc7, 0xa0, 0xca, 0x87, 0xa7, 0x3f, 0xff, 0xd2,
+  0xd8, 0xfb, 0x2d, 0xfc, 0xe1, 0xf3, 0x33, 0x88, 0x3c, 0x7f, 0x43, 0xe1, 0x7d, 0xe7, 0x70, 0xdf,
+  0xb9, 0x2d, 0xfd, 0x30, 0xce, 0x9a, 0x32, 0x8a, 0x77, 0x47, 0x7d, 0x7c, 0x0a, 0xb3, 0x4b, 0x5c,
+  0x55, 0xbb, 0x31, 0xbd, 0xbe, 0xff, 0x7e, 0x40, 0xd2, 0x84, 0x63, 0xff, 0x64, 0xe5, 0x0b, 0xdd,
+  0xf0, 0x49, 0x37, 0xd8, 0x35, 0x03, 0x3e, 0x29, 0xfe, 0x49, 0xae, 0x2f, 0xbf, 0x9b, 0xf0, 0x5b,
+  0x60, 0xfc, 0xa5, 0xdd, 0xfd, 0xe5, 0x6b, 0xbf, 0xfb, 0x93, 0xa9, 0xb0, 0xcc, 0xc3, 0xfb, 0xf3,
+  0xc7, 0x2e, 0xde, 0x5b, 0xc2, 0xca, 0x26, 0x7c, 0xbf, 0xe2, 0x9f, 0xbe, 0xc6, 0xb4, 0xd7, 0xcf,
+  0xdf, 0xfc, 0x28, 0x34, 0x2f, 0xcc, 0x6e, 0x56, 0x3f, 0x80, 0x5f, 0xb6, 0xfb, 0xf1, 0x97, 0xcd,
+  0xbf, 0x44, 0xde, 0x77, 0x82, 0xfb, 0xda, 0xb3, 0x39, 0x6c, 0xb7, 0xc8, 0xe7, 0xaf, 0x6d, 0xfc,
+  0xed, 0xff, 0x02, 0x18, 0x8a, 0x24, 0xe3, 0x7e, 0x43, 0x00, 0x00,
+};
+
+#endif
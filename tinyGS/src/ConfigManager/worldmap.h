@@ -0,0 +1,64 @@
+/*
+  worldmap.h - World map of the dashboard, generated by tools/worldmap_svg.py
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Do not edit, generated from earth_bits by tools/worldmap_svg.py
+
+#ifndef WORLDMAP_H
+#define WORLDMAP_H
+
+const char WORLDMAP_SVG[] PROGMEM =
+  "<svg xmlns='http://www.w3.org/2000/svg' width='262' height='134' viewBox='0 0 262 134'><rect x='1' y"
+  "='1' width='262' height='134' stroke='gray' fill='none' stroke-width='2'/><path d='M77 7h6v2h-6zM101"
+  " 7h12v2h-12zM63 9h54v2h-54zM199 9h2v2h-2zM69 11h6v2h-6zM81 11h36v2h-36zM141 11h2v2h-2zM203 11h4v2h-4"
+  "zM43 13h4v2h-4zM59 13h2v2h-2zM71 13h2v2h-2zM91 13h26v2h-26zM171 13h2v2h-2zM193 13h18v2h-18zM43 15h2v"
+  "2h-2zM47 15h10v2h-10zM63 15h2v2h-2zM67 15h12v2h-12zM93 15h22v2h-22zM169 15h2v2h-2zM179 15h4v2h-4zM18"
+  "5 15h38v2h-38zM231 15h6v2h-6zM15 17h44v2h-44zM63 17h4v2h-4zM69 17h4v2h-4zM77 17h6v2h-6zM93 17h20v2h-"
+  "20zM143 17h14v2h-14zM173 17h86v2h-86zM3 19h6v2h-6zM13 19h60v2h-60zM79 19h8v2h-8zM93 19h12v2h-12zM117"
+  " 19h2v2h-2zM141 19h118v2h-118zM15 21h52v2h-52zM81 21h4v2h-4zM95 21h6v2h-6zM137 21h8v2h-8zM147 21h110"
+  "v2h-110zM13 23h12v2h-12zM27 23h36v2h-36zM75 23h6v2h-6zM99 23h2v2h-2zM135 23h8v2h-8zM147 23h94v2h-94z"
+  "M245 23h8v2h-8zM19 25h2v2h-2zM35 25h30v2h-30zM77 25h10v2h-10zM127 25h2v2h-2zM139 25h4v2h-4zM147 25h8"
+  "4v2h-84zM243 25h4v2h-4zM37 27h34v2h-34zM75 27h14v2h-14zM125 27h6v2h-6zM137 27h2v2h-2zM145 27h84v2h-8"
+  "4zM241 27h4v2h-4zM39 29h34v2h-34zM75 29h16v2h-16zM129 29h2v2h-2zM135 29h98v2h-98zM41 31h44v2h-44zM89"
+  " 31h4v2h-4zM129 31h102v2h-102zM43 33h42v2h-42zM129 33h100v2h-100zM43 35h38v2h-38zM129 35h6v2h-6zM137"
+  " 35h4v2h-4zM143 35h8v2h-8zM159 35h6v2h-6zM167 35h60v2h-60zM231 35h2v2h-2zM43 37h36v2h-36zM125 37h6v2"
+  "h-6zM145 37h20v2h-20zM169 37h54v2h-54zM43 39h34v2h-34zM125 39h6v2h-6zM151 39h16v2h-16zM169 39h46v2h-"
+  "46zM221 39h2v2h-2zM229 39h2v2h-2zM45 41h32v2h-32zM127 41h12v2h-12zM157 41h60v2h-60zM221 41h2v2h-2zM2"
+  "27 41h4v2h-4zM47 43h26v2h-26zM125 43h16v2h-16zM155 43h62v2h-62zM51 45h16v2h-16zM71 45h2v2h-2zM123 45"
+  "h42v2h-42zM167 45h50v2h-50zM53 47h8v2h-8zM121 47h34v2h-34zM157 47h10v2h-10zM171 47h46v2h-46zM55 49h6"
+  "v2h-6zM119 49h38v2h-38zM159 49h14v2h-14zM179 49h36v2h-36zM57 51h4v2h-4zM67 51h2v2h-2zM119 51h38v2h-3"
+  "8zM159 51h14v2h-14zM181 51h12v2h-12zM197 51h10v2h-10zM209 51h2v2h-2zM57 53h12v2h-12zM119 53h40v2h-40"
+  "zM161 53h10v2h-10zM183 53h8v2h-8zM197 53h10v2h-10zM65 55h6v2h-6zM119 55h40v2h-40zM161 55h6v2h-6zM183"
+  " 55h6v2h-6zM201 55h8v2h-8zM69 57h2v2h-2zM119 57h44v2h-44zM185 57h2v2h-2zM201 57h8v2h-8zM77 59h10v2h-"
+  "10zM121 59h46v2h-46zM185 59h2v2h-2zM205 59h2v2h-2zM75 61h14v2h-14zM123 61h44v2h-44zM219 61h2v2h-2zM7"
+  "7 63h18v2h-18zM137 63h28v2h-28zM203 63h2v2h-2zM213 63h2v2h-2zM75 65h20v2h-20zM137 65h26v2h-26zM201 6"
+  "5h4v2h-4zM209 65h6v2h-6zM73 67h26v2h-26zM137 67h24v2h-24zM203 67h2v2h-2zM209 67h6v2h-6zM73 69h30v2h-"
+  "30zM139 69h20v2h-20zM203 69h4v2h-4zM227 69h8v2h-8zM75 71h32v2h-32zM141 71h18v2h-18zM229 71h6v2h-6zM7"
+  "5 73h30v2h-30zM141 73h18v2h-18zM77 75h26v2h-26zM141 75h18v2h-18zM225 75h2v2h-2zM77 77h26v2h-26zM139 "
+  "77h20v2h-20zM165 77h2v2h-2zM219 77h10v2h-10zM231 77h4v2h-4zM81 79h22v2h-22zM139 79h18v2h-18zM163 79h"
+  "4v2h-4zM217 79h18v2h-18zM81 81h22v2h-22zM141 81h14v2h-14zM163 81h2v2h-2zM213 81h24v2h-24zM81 83h18v2"
+  "h-18zM141 83h16v2h-16zM163 83h2v2h-2zM211 83h28v2h-28zM81 85h16v2h-16zM141 85h14v2h-14zM213 85h26v2h"
+  "-26zM81 87h14v2h-14zM143 87h10v2h-10zM213 87h28v2h-28zM81 89h12v2h-12zM143 89h8v2h-8zM213 89h8v2h-8z"
+  "M225 89h14v2h-14zM79 91h12v2h-12zM229 91h10v2h-10zM79 93h10v2h-10zM231 93h6v2h-6zM255 93h2v2h-2zM79 "
+  "95h8v2h-8zM255 95h2v2h-2zM79 97h6v2h-6zM251 97h2v2h-2zM79 99h4v2h-4zM77 101h6v2h-6zM79 103h4v2h-4zM8"
+  "1 105h2v2h-2zM169 113h2v2h-2zM203 113h2v2h-2zM83 115h2v2h-2zM161 115h18v2h-18zM187 115h54v2h-54zM81 "
+  "117h6v2h-6zM123 117h56v2h-56zM181 117h70v2h-70zM41 119h8v2h-8zM59 119h28v2h-28zM119 119h128v2h-128zM"
+  "25 121h52v2h-52zM107 121h140v2h-140zM23 123h54v2h-54zM95 123h4v2h-4zM107 123h138v2h-138zM21 125h66v2"
+  "h-66zM91 125h158v2h-158zM3 127h256v2h-256zM3 129h256v2h-256z'/></svg>";
+
+#endif
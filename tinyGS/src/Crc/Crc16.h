@@ -0,0 +1,150 @@
+/*
+  Crc16.h - Table driven CRC-16 with compile time tables
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef CRC16_H
+#define CRC16_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Everything below is C++11 constexpr (single return statement), the
+// tables are generated by the compiler and end up in flash.
+namespace crc16_detail {
+
+constexpr uint16_t reflect(uint16_t v, int i = 0)
+{
+  return i == 16 ? 0 : (uint16_t)((((v >> i) & 1) << (15 - i)) | reflect(v, i + 1));
+}
+
+constexpr uint16_t stepReflected(uint16_t crc, uint16_t poly, int bits)
+{
+  return bits == 0 ? crc : stepReflected((crc & 1) ? (uint16_t)((crc >> 1) ^ poly) : (uint16_t)(crc >> 1), poly, bits - 1);
+}
+
+constexpr uint16_t stepNormal(uint16_t crc, uint16_t poly, int bits)
+{
+  return bits == 0 ? crc : stepNormal((crc & 0x8000) ? (uint16_t)((crc << 1) ^ poly) : (uint16_t)(crc << 1), poly, bits - 1);
+}
+
+constexpr uint16_t entry(uint16_t poly, bool refl, unsigned n)
+{
+  return refl ? stepReflected((uint16_t)n, reflect(poly), 8) : stepNormal((uint16_t)(n << 8), poly, 8);
+}
+
+// slice k: CRC of byte n followed by k zero bytes
+constexpr uint16_t nextSlice(uint16_t poly, bool refl, uint16_t prev)
+{
+  return refl ? (uint16_t)((prev >> 8) ^ entry(poly, refl, prev & 0xFF))
+              : (uint16_t)((prev << 8) ^ entry(poly, refl, prev >> 8));
+}
+
+constexpr uint16_t slice(uint16_t poly, bool refl, int k, unsigned n)
+{
+  return k == 0 ? entry(poly, refl, n) : nextSlice(poly, refl, slice(poly, refl, k - 1, n));
+}
+
+} // namespace crc16_detail
+
+#define CRC16_T4(k, n)   crc16_detail::slice(Poly, Reflect, k, (n)), crc16_detail::slice(Poly, Reflect, k, (n) + 1), \
+                         crc16_detail::slice(Poly, Reflect, k, (n) + 2), crc16_detail::slice(Poly, Reflect, k, (n) + 3)
+#define CRC16_T16(k, n)  CRC16_T4(k, n), CRC16_T4(k, (n) + 4), CRC16_T4(k, (n) + 8), CRC16_T4(k, (n) + 12)
+#define CRC16_T64(k, n)  CRC16_T16(k, n), CRC16_T16(k, (n) + 16), CRC16_T16(k, (n) + 32), CRC16_T16(k, (n) + 48)
+#define CRC16_T256(k)    CRC16_T64(k, 0), CRC16_T64(k, 64), CRC16_T64(k, 128), CRC16_T64(k, 192)
+
+// CRC-16 with the usual Rocksoft parameters. Reflect applies to both input
+// and output, which is the case for every CRC-16 we deal with.
+//   compute()        one table lookup per byte (512 bytes of table)
+//   computeSlice4()  four bytes per step (2 KB more of table, only linked if used)
+//   begin()/update()/end() to feed the data in pieces
+template <uint16_t Poly, uint16_t Init, bool Reflect, uint16_t XorOut>
+class Crc16 {
+public:
+  static constexpr uint16_t table[256] = { CRC16_T256(0) };
+  static constexpr uint16_t slices[3][256] = { { CRC16_T256(1) }, { CRC16_T256(2) }, { CRC16_T256(3) } };
+
+  static constexpr uint16_t begin() { return Reflect ? crc16_detail::reflect(Init) : Init; }
+  static constexpr uint16_t end(uint16_t crc) { return crc ^ XorOut; }
+
+  static uint16_t update(uint16_t crc, const uint8_t* data, size_t len)
+  {
+    while (len--)
+      crc = step(crc, *data++);
+    return crc;
+  }
+
+  static uint16_t updateSlice4(uint16_t crc, const uint8_t* data, size_t len)
+  {
+    for (; len >= 4; len -= 4, data += 4)
+    {
+      uint8_t a = Reflect ? (uint8_t)(data[0] ^ crc) : (uint8_t)(data[0] ^ (crc >> 8));
+      uint8_t b = Reflect ? (uint8_t)(data[1] ^ (crc >> 8)) : (uint8_t)(data[1] ^ crc);
+      crc = slices[2][a] ^ slices[1][b] ^ slices[0][data[2]] ^ table[data[3]];
+    }
+    return update(crc, data, len);
+  }
+
+  static uint16_t compute(const uint8_t* data, size_t len) { return end(update(begin(), data, len)); }
+  static uint16_t computeSlice4(const uint8_t* data, size_t len) { return end(updateSlice4(begin(), data, len)); }
+
+  // compile time CRC of a string, used for the known answer checks below
+  static constexpr uint16_t of(const char* s, size_t len) { return end(constUpdate(begin(), s, len)); }
+
+private:
+  static uint16_t step(uint16_t crc, uint8_t b)
+  {
+    return Reflect ? (uint16_t)((crc >> 8) ^ table[(crc ^ b) & 0xFF])
+                   : (uint16_t)((crc << 8) ^ table[((crc >> 8) ^ b) & 0xFF]);
+  }
+
+  static constexpr uint16_t constUpdate(uint16_t crc, const char* s, size_t len)
+  {
+    return len == 0 ? crc
+                    : constUpdate(Reflect ? (uint16_t)((crc >> 8) ^ crc16_detail::entry(Poly, Reflect, (crc ^ (uint8_t)*s) & 0xFF))
+                                          : (uint16_t)((crc << 8) ^ crc16_detail::entry(Poly, Reflect, ((crc >> 8) ^ (uint8_t)*s) & 0xFF)),
+                                  s + 1, len - 1);
+  }
+};
+
+template <uint16_t Poly, uint16_t Init, bool Reflect, uint16_t XorOut>
+constexpr uint16_t Crc16<Poly, Init, Reflect, XorOut>::table[256];
+template <uint16_t Poly, uint16_t Init, bool Reflect, uint16_t XorOut>
+constexpr uint16_t Crc16<Poly, Init, Reflect, XorOut>::slices[3][256];
+
+#undef CRC16_T4
+#undef CRC16_T16
+#undef CRC16_T64
+#undef CRC16_T256
+
+// AX.25 / HDLC frame check sequence, sent low byte first
+typedef Crc16<0x1021, 0xFFFF, true, 0xFFFF> Crc16X25;
+// CCITT as configured on the SX127x packet engine
+typedef Crc16<0x1021, 0xFFFF, false, 0x0000> Crc16CcittFalse;
+// SX126x default (RadioLib setCRC: init 0x1D0F, inverted)
+typedef Crc16<0x1021, 0x1D0F, false, 0xFFFF> Crc16Sx126x;
+// IBM CRC-16 used by some AX100 style modems
+typedef Crc16<0x8005, 0x0000, true, 0x0000> Crc16Arc;
+
+// Known answers for "123456789" (reveng catalogue, SX126x is CRC-16/AUG-CCITT
+// complemented), checked by the compiler
+static_assert(Crc16X25::of("123456789", 9) == 0x906E, "CRC-16/X-25 check value");
+static_assert(Crc16CcittFalse::of("123456789", 9) == 0x29B1, "CRC-16/CCITT-FALSE check value");
+static_assert(Crc16Sx126x::of("123456789", 9) == 0x1A33, "CRC-16/SX126x check value");
+static_assert(Crc16Arc::of("123456789", 9) == 0xBB3D, "CRC-16/ARC check value");
+
+#endif
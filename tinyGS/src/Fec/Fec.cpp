@@ -0,0 +1,73 @@
+/*
+  Fec.cpp - Forward error correction stage for FSK packets
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Fec.h"
+#include "Viterbi.h"
+#include "ReedSolomon.h"
+#include <string.h>
+
+size_t Fec::decode(uint8_t stages, uint8_t rsDepth, const uint8_t* in, size_t len, uint8_t* out, FecResult* result)
+{
+  result->rsCorrected = 0;
+  result->bitErrors = 0;
+
+  if (stages & FEC_VITERBI)
+    len = Viterbi::decode(in, len, out, &result->bitErrors);
+  else
+    memcpy(out, in, len);
+
+  if (stages & FEC_RANDOMIZER)
+    derandomize(out, len);
+
+  if (stages & FEC_RS)
+  {
+    if (rsDepth == 0)
+      rsDepth = 1;
+    size_t n = len / rsDepth;
+    if (n > RS_NN)
+      n = RS_NN;
+    if (n <= RS_NROOTS)
+    {
+      result->rsCorrected = -1;
+      return len;
+    }
+    result->rsCorrected = ReedSolomon::decodeInterleaved(out, n * rsDepth, rsDepth, stages & FEC_RS_DUAL);
+    len = (n - RS_NROOTS) * rsDepth; // interleaved data comes first, parity last
+  }
+
+  return len;
+}
+
+// h(x) = x^8 + x^7 + x^5 + x^3 + 1, all ones at the start of every frame,
+// first bytes FF 48 0E C0 9A 0D 70 BC
+void Fec::derandomize(uint8_t* data, size_t len)
+{
+  uint8_t lfsr = 0xFF;
+  for (size_t i = 0; i < len; i++)
+  {
+    uint8_t r = 0;
+    for (int k = 0; k < 8; k++)
+    {
+      r = (r << 1) | (lfsr >> 7);
+      uint8_t fb = ((lfsr >> 7) ^ (lfsr >> 4) ^ (lfsr >> 2) ^ lfsr) & 1;
+      lfsr = (lfsr << 1) | fb;
+    }
+    data[i] ^= r;
+  }
+}
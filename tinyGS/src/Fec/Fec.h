@@ -0,0 +1,47 @@
+/*
+  Fec.h - Forward error correction stage for FSK packets
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef FEC_H
+#define FEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Stages, from the modem config "fec" field. They run in CCSDS receive order.
+#define FEC_VITERBI    0x01   // K=7 r=1/2 convolutional code
+#define FEC_RANDOMIZER 0x02   // CCSDS pseudo-randomizer
+#define FEC_RS         0x04   // RS(255,223), interleaving depth from "rsI"
+#define FEC_RS_DUAL    0x08   // RS symbols in dual basis representation
+#define FEC_CCSDS_DEFAULT (FEC_RANDOMIZER | FEC_RS | FEC_RS_DUAL)
+
+struct FecResult {
+  int16_t rsCorrected = 0;   // RS symbols corrected, -1 if uncorrectable
+  uint32_t bitErrors = 0;    // channel bits corrected by the Viterbi decoder
+};
+
+class Fec {
+public:
+  // Runs the selected stages over in and writes the result to out, which
+  // must hold len + 1 bytes. The RS parity is removed from the output.
+  // Returns the output length.
+  static size_t decode(uint8_t stages, uint8_t rsDepth, const uint8_t* in, size_t len, uint8_t* out, FecResult* result);
+  static void derandomize(uint8_t* data, size_t len);
+};
+
+#endif
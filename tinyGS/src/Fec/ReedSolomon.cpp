@@ -0,0 +1,278 @@
+/*
+  ReedSolomon.cpp - CCSDS Reed-Solomon (255,223) decoder
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  The field tables, modnn() and decodeConventional() are derived from
+  init_rs.c, rs-common.h and decode_rs.h of libfec:
+  Copyright 2002-2004 Phil Karn, KA9Q
+  May be used under the terms of the GNU Lesser General Public License (LGPL).
+  Section 3 of the LGPL version 2.1 allows that code to be distributed under
+  the GNU General Public License version 2 or any later version, which is how
+  it is used here, under version 3.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "ReedSolomon.h"
+#include <string.h>
+
+#define RS_GFPOLY 0x187
+#define RS_FCR    112
+#define RS_PRIM   11
+#define RS_IPRIM  116   // RS_PRIM * RS_IPRIM = 1 mod RS_NN
+#define RS_A0     RS_NN // log of zero
+
+bool ReedSolomon::ready = false;
+uint8_t ReedSolomon::alphaTo[RS_NN + 1];
+uint8_t ReedSolomon::indexOf[RS_NN + 1];
+uint8_t ReedSolomon::toConventional[256];
+uint8_t ReedSolomon::toDual[256];
+
+uint8_t ReedSolomon::modnn(int x)
+{
+  while (x >= RS_NN)
+  {
+    x -= RS_NN;
+    x = (x >> 8) + (x & RS_NN);
+  }
+  return x;
+}
+
+void ReedSolomon::init()
+{
+  // log / antilog tables
+  indexOf[0] = RS_A0;
+  alphaTo[RS_A0] = 0;
+  int sr = 1;
+  for (int i = 0; i < RS_NN; i++)
+  {
+    indexOf[sr] = i;
+    alphaTo[i] = sr;
+    sr <<= 1;
+    if (sr & 0x100)
+      sr ^= RS_GFPOLY;
+    sr &= RS_NN;
+  }
+
+  // dual basis <-> conventional, CCSDS 131.0-B annex F
+  static const uint8_t tal[8] = { 0x8d, 0xef, 0xec, 0x86, 0xfa, 0x99, 0xaf, 0x7b };
+  for (int i = 0; i < 256; i++)
+  {
+    uint8_t v = 0;
+    for (int k = 0; k < 8; k++)
+    {
+      if (i & (1 << k))
+        v ^= tal[7 - k];
+    }
+    toDual[i] = v;
+    toConventional[v] = i;
+  }
+  ready = true;
+}
+
+int ReedSolomon::decode(uint8_t* block, int pad, bool dualBasis)
+{
+  if (!ready)
+    init();
+  if (pad < 0 || pad >= RS_KK)
+    return -1;
+
+  int n = RS_NN - pad;
+  if (dualBasis)
+  {
+    for (int i = 0; i < n; i++)
+      block[i] = toConventional[block[i]];
+  }
+  int count = decodeConventional(block, pad);
+  if (dualBasis)
+  {
+    for (int i = 0; i < n; i++)
+      block[i] = toDual[block[i]];
+  }
+  return count;
+}
+
+int ReedSolomon::decodeInterleaved(uint8_t* data, size_t len, uint8_t depth, bool dualBasis)
+{
+  if (depth == 0 || len % depth || len / depth > RS_NN || len / depth <= RS_NROOTS)
+    return -1;
+
+  int n = len / depth;
+  int total = 0;
+  bool failed = false;
+  uint8_t block[RS_NN];
+  for (int d = 0; d < depth; d++)
+  {
+    for (int i = 0; i < n; i++)
+      block[i] = data[i * depth + d];
+    int count = decode(block, RS_NN - n, dualBasis);
+    if (count < 0)
+    {
+      failed = true;
+      continue;
+    }
+    total += count;
+    for (int i = 0; i < n; i++)
+      data[i * depth + d] = block[i];
+  }
+  return failed ? -1 : total;
+}
+
+int ReedSolomon::decodeConventional(uint8_t* data, int pad)
+{
+  uint8_t lambda[RS_NROOTS + 1], s[RS_NROOTS], b[RS_NROOTS + 1], t[RS_NROOTS + 1];
+  uint8_t omega[RS_NROOTS + 1], root[RS_NROOTS], reg[RS_NROOTS + 1], loc[RS_NROOTS];
+  int i, j, r, k, el, degLambda, degOmega, count;
+
+  // syndromes, evaluated at the roots of the generator
+  for (i = 0; i < RS_NROOTS; i++)
+    s[i] = data[0];
+  for (j = 1; j < RS_NN - pad; j++)
+  {
+    for (i = 0; i < RS_NROOTS; i++)
+    {
+      if (s[i] == 0)
+        s[i] = data[j];
+      else
+        s[i] = data[j] ^ alphaTo[modnn(indexOf[s[i]] + (RS_FCR + i) * RS_PRIM)];
+    }
+  }
+
+  uint8_t synError = 0;
+  for (i = 0; i < RS_NROOTS; i++)
+  {
+    synError |= s[i];
+    s[i] = indexOf[s[i]];
+  }
+  if (!synError)
+    return 0;
+
+  // Berlekamp-Massey: error locator polynomial lambda
+  memset(&lambda[1], 0, RS_NROOTS);
+  lambda[0] = 1;
+  for (i = 0; i < RS_NROOTS + 1; i++)
+    b[i] = indexOf[lambda[i]];
+
+  el = 0;
+  for (r = 1; r <= RS_NROOTS; r++)
+  {
+    uint8_t discr = 0;
+    for (i = 0; i < r; i++)
+    {
+      if (lambda[i] != 0 && s[r - i - 1] != RS_A0)
+        discr ^= alphaTo[modnn(indexOf[lambda[i]] + s[r - i - 1])];
+    }
+    discr = indexOf[discr];
+    if (discr == RS_A0)
+    {
+      memmove(&b[1], b, RS_NROOTS);
+      b[0] = RS_A0;
+      continue;
+    }
+
+    t[0] = lambda[0];
+    for (i = 0; i < RS_NROOTS; i++)
+    {
+      if (b[i] != RS_A0)
+        t[i + 1] = lambda[i + 1] ^ alphaTo[modnn(discr + b[i])];
+      else
+        t[i + 1] = lambda[i + 1];
+    }
+    if (2 * el <= r - 1)
+    {
+      el = r - el;
+      for (i = 0; i <= RS_NROOTS; i++)
+        b[i] = (lambda[i] == 0) ? RS_A0 : modnn(indexOf[lambda[i]] - discr + RS_NN);
+    }
+    else
+    {
+      memmove(&b[1], b, RS_NROOTS);
+      b[0] = RS_A0;
+    }
+    memcpy(lambda, t, RS_NROOTS + 1);
+  }
+
+  degLambda = 0;
+  for (i = 0; i < RS_NROOTS + 1; i++)
+  {
+    lambda[i] = indexOf[lambda[i]];
+    if (lambda[i] != RS_A0)
+      degLambda = i;
+  }
+
+  // Chien search: roots of lambda are the error locations
+  memcpy(&reg[1], &lambda[1], RS_NROOTS);
+  count = 0;
+  for (i = 1, k = RS_IPRIM - 1; i <= RS_NN; i++, k = modnn(k + RS_IPRIM))
+  {
+    uint8_t q = 1;
+    for (j = degLambda; j > 0; j--)
+    {
+      if (reg[j] != RS_A0)
+      {
+        reg[j] = modnn(reg[j] + j);
+        q ^= alphaTo[reg[j]];
+      }
+    }
+    if (q != 0)
+      continue;
+    root[count] = i;
+    loc[count] = k;
+    if (++count == degLambda)
+      break;
+  }
+  if (degLambda != count)
+    return -1; // more errors than roots
+  for (j = 0; j < count; j++)
+  {
+    if (loc[j] < pad)
+      return -1; // error in the virtual fill, the block would be miscorrected
+  }
+
+  // error evaluator omega = s * lambda mod x^NROOTS
+  degOmega = degLambda - 1;
+  for (i = 0; i <= degOmega; i++)
+  {
+    uint8_t tmp = 0;
+    for (j = i; j >= 0; j--)
+    {
+      if (s[i - j] != RS_A0 && lambda[j] != RS_A0)
+        tmp ^= alphaTo[modnn(s[i - j] + lambda[j])];
+    }
+    omega[i] = indexOf[tmp];
+  }
+
+  // Forney: error values
+  for (j = count - 1; j >= 0; j--)
+  {
+    uint8_t num1 = 0;
+    for (i = degOmega; i >= 0; i--)
+    {
+      if (omega[i] != RS_A0)
+        num1 ^= alphaTo[modnn(omega[i] + i * root[j])];
+    }
+    uint8_t num2 = alphaTo[modnn(root[j] * (RS_FCR - 1) + RS_NN)];
+    uint8_t den = 0;
+    // lambda[i+1] for i even is the formal derivative of lambda
+    for (i = (degLambda < RS_NROOTS - 1 ? degLambda : RS_NROOTS - 1) & ~1; i >= 0; i -= 2)
+    {
+      if (lambda[i + 1] != RS_A0)
+        den ^= alphaTo[modnn(lambda[i + 1] + i * root[j])];
+    }
+    if (num1 != 0)
+      data[loc[j] - pad] ^= alphaTo[modnn(indexOf[num1] + indexOf[num2] + RS_NN - indexOf[den])];
+  }
+  return count;
+}
@@ -0,0 +1,58 @@
+/*
+  ReedSolomon.h - CCSDS Reed-Solomon (255,223) decoder
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef REED_SOLOMON_H
+#define REED_SOLOMON_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define RS_NN     255   // symbols per codeword
+#define RS_NROOTS 32    // parity symbols, corrects up to 16
+#define RS_KK     (RS_NN - RS_NROOTS)
+
+// RS(255,223) as specified by CCSDS 131.0-B: field polynomial 0x187, first
+// consecutive root 112, primitive element 11. Syndromes, Berlekamp-Massey,
+// Chien search and Forney over log/antilog tables built on first use.
+// Shortened codes (virtual fill) are supported through pad, and CCSDS
+// frames in the dual basis representation through dualBasis.
+class ReedSolomon {
+public:
+  // block holds RS_NN - pad symbols, data first and parity last. Corrects it
+  // in place and returns the symbols corrected, or -1 if uncorrectable.
+  static int decode(uint8_t* block, int pad = 0, bool dualBasis = false);
+
+  // depth codewords interleaved symbol by symbol (CCSDS I = 1..8), len is
+  // depth * (RS_NN - pad). Returns the total corrected, or -1 if any
+  // codeword is uncorrectable.
+  static int decodeInterleaved(uint8_t* data, size_t len, uint8_t depth, bool dualBasis = false);
+
+private:
+  static void init();
+  static int decodeConventional(uint8_t* block, int pad);
+  static uint8_t modnn(int x);
+
+  static bool ready;
+  static uint8_t alphaTo[RS_NN + 1];
+  static uint8_t indexOf[RS_NN + 1];
+  static uint8_t toConventional[256];
+  static uint8_t toDual[256];
+};
+
+#endif
@@ -0,0 +1,136 @@
+/*
+  Viterbi.cpp - K=7 r=1/2 convolutional code decoder (CCSDS)
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Viterbi.h"
+#include <string.h>
+
+// Polynomials with the newest bit in the LSB of the shift register
+#define VITERBI_POLY_A 0x4F   // 171 octal reversed
+#define VITERBI_POLY_B 0x6D   // 133 octal reversed
+#define VITERBI_RING   (VITERBI_DEPTH + VITERBI_CHUNK)
+
+uint64_t Viterbi::decisions[VITERBI_RING];
+size_t Viterbi::head = 0;
+
+// expected symbol pair (G1 << 1 | G2) for a 7 bit shift register value
+static inline uint8_t expected(uint8_t sr)
+{
+  return (uint8_t)((__builtin_parity(sr & VITERBI_POLY_A) << 1) | (__builtin_parity(sr & VITERBI_POLY_B) ^ 1));
+}
+
+// Walk back 'steps' decisions from 'state', the newest one at head - 1, and
+// write the oldest 'release' bits at bit position outBit of out.
+void Viterbi::traceback(uint8_t state, size_t steps, size_t release, uint8_t* out, size_t outBit)
+{
+  for (size_t i = 0; i < steps; i++)
+  {
+    size_t step = steps - 1 - i; // position of this decision among the ones walked
+    size_t slot = (head + VITERBI_RING - 1 - i) % VITERBI_RING;
+    if (step < release)
+    {
+      size_t bit = outBit + step;
+      if (state & 1)
+        out[bit >> 3] |= 0x80 >> (bit & 7);
+      else
+        out[bit >> 3] &= ~(0x80 >> (bit & 7));
+    }
+    state = (state >> 1) | (uint8_t)(((decisions[slot] >> state) & 1) << 5);
+  }
+}
+
+size_t Viterbi::decode(const uint8_t* symbols, size_t len, uint8_t* out, uint32_t* bitErrors)
+{
+  uint16_t metric[VITERBI_STATES];
+  uint16_t next[VITERBI_STATES];
+  uint32_t normalized = 0;
+  size_t nbits = len * 4; // one decoded bit per symbol pair
+  size_t stored = 0;
+  size_t released = 0;
+
+  // symbols expected on every branch, indexed by the 7 bit shift register
+  uint8_t branch[2 * VITERBI_STATES];
+  for (int sr = 0; sr < 2 * VITERBI_STATES; sr++)
+    branch[sr] = expected(sr);
+
+  // the encoder starts from the zero state
+  for (int s = 0; s < VITERBI_STATES; s++)
+    metric[s] = s ? 1000 : 0;
+  head = 0;
+
+  for (size_t t = 0; t < nbits; t++)
+  {
+    uint8_t pair = (symbols[t >> 2] >> (6 - 2 * (t & 3))) & 3;
+    uint8_t distance[4];
+    for (int x = 0; x < 4; x++)
+      distance[x] = __builtin_popcount(pair ^ x);
+    uint32_t decision[2] = { 0, 0 };
+    uint16_t best = 0xFFFF;
+
+    // butterflies: states 2j and 2j+1 both come from j or j+32, input is n & 1
+    for (int j = 0; j < VITERBI_STATES / 2; j++)
+    {
+      uint16_t a = metric[j];
+      uint16_t b = metric[j + VITERBI_STATES / 2];
+      for (int in = 0; in < 2; in++)
+      {
+        int n = 2 * j + in;
+        uint16_t m0 = a + distance[branch[(j << 1) | in]];
+        uint16_t m1 = b + distance[branch[((j + VITERBI_STATES / 2) << 1) | in]];
+        if (m1 < m0)
+        {
+          m0 = m1;
+          decision[n >> 5] |= 1u << (n & 31);
+        }
+        next[n] = m0;
+        if (m0 < best)
+          best = m0;
+      }
+    }
+
+    // keep the metrics small, what is taken out is part of the path metric
+    for (int n = 0; n < VITERBI_STATES; n++)
+      metric[n] = next[n] - best;
+    normalized += best;
+
+    decisions[head] = (uint64_t)decision[1] << 32 | decision[0];
+    head = (head + 1) % VITERBI_RING;
+    stored++;
+
+    if (stored == VITERBI_RING)
+    {
+      uint8_t state = 0;
+      for (int n = 1; n < VITERBI_STATES; n++)
+        if (metric[n] < metric[state])
+          state = n;
+      traceback(state, stored, VITERBI_CHUNK, out, released);
+      released += VITERBI_CHUNK;
+      stored -= VITERBI_CHUNK;
+    }
+  }
+
+  // release what is left from the best final state
+  uint8_t state = 0;
+  for (int n = 1; n < VITERBI_STATES; n++)
+    if (metric[n] < metric[state])
+      state = n;
+  traceback(state, stored, stored, out, released);
+
+  *bitErrors = normalized + metric[state];
+  return nbits / 8;
+}
@@ -0,0 +1,48 @@
+/*
+  Viterbi.h - K=7 r=1/2 convolutional code decoder (CCSDS)
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef VITERBI_H
+#define VITERBI_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define VITERBI_STATES    64   // 2^(K-1)
+#define VITERBI_DEPTH     64   // traceback depth before a bit is trusted
+#define VITERBI_CHUNK     32   // bits released on every traceback
+
+// Hard decision Viterbi decoder for the CCSDS 131.0-B convolutional code:
+// K=7, G1=171, G2=133 (octal), G2 output inverted, G1 symbol first.
+// The survivor path keeps one decision bit per state and step, a 64 bit
+// word per step, and only VITERBI_DEPTH + VITERBI_CHUNK steps are kept:
+// every VITERBI_CHUNK steps the oldest bits are traced back and released.
+class Viterbi {
+public:
+  // symbols: received bits, MSB first, two per decoded bit. Writes
+  // len / 2 bytes to out and returns them. bitErrors gets the channel bits
+  // the decoder had to flip (the metric of the surviving path).
+  static size_t decode(const uint8_t* symbols, size_t len, uint8_t* out, uint32_t* bitErrors);
+
+private:
+  static void traceback(uint8_t state, size_t steps, size_t release, uint8_t* out, size_t outBit);
+  static uint64_t decisions[VITERBI_DEPTH + VITERBI_CHUNK];
+  static size_t head;
+};
+
+#endif
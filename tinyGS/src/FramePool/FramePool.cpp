@@ -0,0 +1,72 @@
+/*
+  FramePool.cpp - Statically reserved buffers for the RX pipeline
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "FramePool.h"
+
+static_assert(FRAME_POOL_SLOTS <= 32, "FramePool uses a 32 bit mask");
+
+static uint8_t countBits(uint32_t v)
+{
+  uint8_t n = 0;
+  for (; v; v &= v - 1)
+    n++;
+  return n;
+}
+
+FrameHandle FramePool::borrow()
+{
+  FrameHandle handle;
+  const uint32_t full = (FRAME_POOL_SLOTS == 32) ? 0xFFFFFFFF : ((1UL << FRAME_POOL_SLOTS) - 1);
+  uint32_t cur = used.load(std::memory_order_relaxed);
+  uint32_t next;
+  uint8_t idx;
+
+  do
+  {
+    if ((cur & full) == full)
+    {
+      exhaustedCount.fetch_add(1, std::memory_order_relaxed);
+      return handle;
+    }
+    idx = __builtin_ctz(~cur);  // lowest free slot
+    next = cur | (1UL << idx);
+  } while (!used.compare_exchange_weak(cur, next, std::memory_order_acquire, std::memory_order_relaxed));
+
+  uint8_t n = countBits(next);
+  uint8_t mark = hwm.load(std::memory_order_relaxed);
+  while (n > mark && !hwm.compare_exchange_weak(mark, n, std::memory_order_relaxed))
+    ;
+
+  handle.idx = idx;
+  return handle;
+}
+
+void FramePool::release(FrameHandle& handle)
+{
+  if (!handle.valid())
+    return;
+
+  used.fetch_and(~(1UL << handle.idx), std::memory_order_release);
+  handle = FrameHandle();
+}
+
+uint8_t FramePool::inUse() const
+{
+  return countBits(used.load(std::memory_order_relaxed));
+}
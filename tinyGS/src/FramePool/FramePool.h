@@ -0,0 +1,104 @@
+/*
+  FramePool.h - Statically reserved buffers for the RX pipeline
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef FRAME_POOL_H
+#define FRAME_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+#define FRAME_POOL_SLOTS     30   // max 32, one bit per slot. Enough for every radio, see Radio.cpp
+#define FRAME_POOL_SLOT_SIZE 256  // a full radio FIFO
+
+// Index of a borrowed slot. Plain value so it can travel inside RxPacket
+// from the RX task to the loop, whoever holds it must give it back.
+struct FrameHandle {
+  static const uint8_t INVALID = 0xFF;
+  uint8_t idx = INVALID;
+  bool valid() const { return idx != INVALID; }
+};
+
+// Fixed set of frame sized buffers every stage of the RX pipeline borrows
+// from instead of new[]/delete[], so weeks of packets never fragment the heap.
+// Borrow and release are lock free and can be called from the RX task and the loop.
+class FramePool {
+public:
+  static FramePool& getInstance()
+  {
+    static FramePool instance;
+    return instance;
+  }
+
+  FrameHandle borrow();
+  void release(FrameHandle& handle);
+  uint8_t* data(FrameHandle handle) { return handle.valid() ? slots[handle.idx] : nullptr; }
+
+  uint8_t inUse() const;
+  uint8_t highWaterMark() const { return hwm.load(std::memory_order_relaxed); }
+  uint32_t exhausted() const { return exhaustedCount.load(std::memory_order_relaxed); }
+
+private:
+  FramePool() : used(0), hwm(0), exhaustedCount(0) {}
+
+  uint8_t slots[FRAME_POOL_SLOTS][FRAME_POOL_SLOT_SIZE];
+  std::atomic<uint32_t> used;           // bit n set -> slot n borrowed
+  std::atomic<uint8_t> hwm;
+  std::atomic<uint32_t> exhaustedCount;
+};
+
+// Typed, scoped view of a pool slot for buffers that only live during one stage.
+// The slot goes back to the pool when it goes out of scope unless detach() is called.
+template <typename T>
+class PooledBuffer {
+public:
+  explicit PooledBuffer(bool acquireNow = true)
+  {
+    if (acquireNow)
+      acquire();
+  }
+  ~PooledBuffer() { FramePool::getInstance().release(handle); }
+
+  PooledBuffer(const PooledBuffer&) = delete;
+  PooledBuffer& operator=(const PooledBuffer&) = delete;
+
+  bool acquire()
+  {
+    if (!handle.valid())
+      handle = FramePool::getInstance().borrow();
+    return handle.valid();
+  }
+
+  // hand the slot over to someone else, who becomes responsible of releasing it
+  FrameHandle detach()
+  {
+    FrameHandle h = handle;
+    handle = FrameHandle();
+    return h;
+  }
+
+  T* get() { return (T*)FramePool::getInstance().data(handle); }
+  bool valid() const { return handle.valid(); }
+  static constexpr size_t capacity() { return FRAME_POOL_SLOT_SIZE / sizeof(T); }
+
+private:
+  FrameHandle handle;
+};
+
+#endif
@@ -0,0 +1,252 @@
+/*
+  Journal.cpp - Store and forward queue for packets received without MQTT
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Journal.h"
+#include <LittleFS.h>
+#include "../Logger/Logger.h"
+
+#define JOURNAL_MAGIC 0x4A52
+
+struct __attribute__((packed)) JournalEntry {
+  uint16_t magic;
+  uint16_t len;
+};
+
+// number of complete records in a segment from pos on, a torn write at the end
+// is not counted. end gets the offset right after the last complete record.
+static uint32_t countRecords(File &f, size_t pos = 0, size_t *end = NULL)
+{
+  uint32_t count = 0;
+  size_t size = f.size();
+  JournalEntry e;
+  while (pos + sizeof(e) <= size && f.seek(pos) && f.read((uint8_t *)&e, sizeof(e)) == sizeof(e))
+  {
+    if (e.magic != JOURNAL_MAGIC || pos + sizeof(e) + e.len > size)
+      break;
+    pos += sizeof(e) + e.len;
+    count++;
+  }
+  if (end)
+    *end = pos;
+  return count;
+}
+
+void Journal::segmentPath(char *path, uint32_t segment)
+{
+  sprintf(path, JOURNAL_DIR "/%08x", segment);
+}
+
+void Journal::begin()
+{
+  // on a reboot only what reached the flash is left
+  *this = Journal();
+  if (!LittleFS.begin(true))
+  {
+    Log::error(PSTR("Journal: unable to mount the data partition, packets will only be kept in RAM"));
+    return;
+  }
+
+  mounted = true;
+  LittleFS.mkdir(JOURNAL_DIR);
+  File dir = LittleFS.open(JOURNAL_DIR);
+  bool found = false;
+  for (File f = dir.openNextFile(); f; f = dir.openNextFile())
+  {
+    uint32_t segment = strtoul(f.name(), NULL, 16);
+    size_t end;
+    flashRecords += countRecords(f, 0, &end);
+    if (!found || segment < firstSegment)
+      firstSegment = segment;
+    if (!found || segment >= nextSegment)
+    {
+      nextSegment = segment + 1;
+      // records appended after a torn write would never be read
+      writeSize = end < f.size() ? JOURNAL_SEGMENT_SIZE : f.size();
+    }
+    found = true;
+  }
+
+  if (flashRecords)
+    Log::console(PSTR("Journal: %u packets waiting to be sent"), flashRecords);
+}
+
+void Journal::loop()
+{
+  if (cacheLen > cacheRead && millis() - cacheSince > JOURNAL_FLUSH_MS)
+    flush();
+}
+
+bool Journal::append(const uint8_t *record, size_t len)
+{
+  size_t need = sizeof(JournalEntry) + len;
+  if (len > JOURNAL_RECORD_MAX)
+    return false;
+
+  if (cacheLen + need > JOURNAL_CACHE_SIZE)
+    flush();
+
+  if (cacheLen + need > JOURNAL_CACHE_SIZE)
+  {
+    // no flash and the cache is full
+    droppedRecords++;
+    return false;
+  }
+
+  if (cacheLen == cacheRead)
+    cacheSince = millis();
+
+  JournalEntry e = {JOURNAL_MAGIC, (uint16_t)len};
+  memcpy(cache + cacheLen, &e, sizeof(e));
+  memcpy(cache + cacheLen + sizeof(e), record, len);
+  cacheLen += need;
+  cacheRecords++;
+  return true;
+}
+
+void Journal::flush()
+{
+  if (!mounted || cacheLen == cacheRead)
+    return;
+
+  if (firstSegment == nextSegment || writeSize >= JOURNAL_SEGMENT_SIZE)
+  {
+    if (nextSegment - firstSegment >= JOURNAL_MAX_SEGMENTS)
+      dropOldestSegment();
+    nextSegment++;
+    writeSize = 0;
+  }
+
+  char path[20];
+  segmentPath(path, nextSegment - 1);
+  File f = LittleFS.open(path, FILE_APPEND);
+  size_t len = cacheLen - cacheRead;
+  size_t written = f ? f.write(cache + cacheRead, len) : 0;
+  if (written != len)
+  {
+    // next() stops at the torn record, so the segment is closed and the next
+    // flush starts a new one. The records that did not make it are given up,
+    // otherwise the cache would stay full and drop every later packet.
+    f.close();
+    uint32_t saved = 0;
+    JournalEntry e;
+    for (size_t pos = cacheRead; pos + sizeof(e) <= cacheRead + written; pos += sizeof(e) + e.len)
+    {
+      memcpy(&e, cache + pos, sizeof(e));
+      if (pos + sizeof(e) + e.len > cacheRead + written)
+        break;
+      saved++;
+    }
+    Log::error(PSTR("Journal: write to %s failed, %u packets lost"), path, cacheRecords - saved);
+    writeSize = JOURNAL_SEGMENT_SIZE;
+    flashRecords += saved;
+    droppedRecords += cacheRecords - saved;
+    cacheRecords = 0;
+    cacheLen = cacheRead = 0;
+    if (!pendingFlash)
+      pendingLen = 0;
+    return;
+  }
+  f.close();
+
+  writeSize += len;
+  flashRecords += cacheRecords;
+  cacheRecords = 0;
+  cacheLen = cacheRead = 0;
+  if (!pendingFlash)
+    pendingLen = 0; // the record next() returned moved to flash, it will be read again
+}
+
+void Journal::dropOldestSegment()
+{
+  char path[20];
+  segmentPath(path, firstSegment);
+  File f = LittleFS.open(path, FILE_READ);
+  uint32_t lost = f ? countRecords(f, readOffset) : 0;
+  f.close();
+  LittleFS.remove(path);
+
+  if (pendingFlash)
+    pendingLen = 0;
+  lost = lost > flashRecords ? flashRecords : lost;
+  flashRecords -= lost;
+  droppedRecords += lost;
+  firstSegment++;
+  readOffset = 0;
+  Log::console(PSTR("Journal full, %u old packets dropped"), lost);
+}
+
+size_t Journal::next(uint8_t *buf, size_t size)
+{
+  JournalEntry e;
+  while (mounted && firstSegment != nextSegment)
+  {
+    char path[20];
+    segmentPath(path, firstSegment);
+    File f = LittleFS.open(path, FILE_READ);
+    if (f && f.seek(readOffset) && f.read((uint8_t *)&e, sizeof(e)) == sizeof(e) &&
+        e.magic == JOURNAL_MAGIC && e.len <= size && f.read(buf, e.len) == e.len)
+    {
+      pendingLen = sizeof(e) + e.len;
+      pendingFlash = true;
+      return e.len;
+    }
+
+    // end of the segment, or a torn write after it
+    f.close();
+    LittleFS.remove(path);
+    firstSegment++;
+    readOffset = 0;
+    if (firstSegment == nextSegment)
+      flashRecords = 0;
+  }
+
+  if (cacheRead < cacheLen)
+  {
+    memcpy(&e, cache + cacheRead, sizeof(e));
+    if (e.len > size)
+      return 0;
+    memcpy(buf, cache + cacheRead + sizeof(e), e.len);
+    pendingLen = sizeof(e) + e.len;
+    pendingFlash = false;
+    return e.len;
+  }
+
+  return 0;
+}
+
+void Journal::pop()
+{
+  if (!pendingLen)
+    return;
+
+  if (pendingFlash)
+  {
+    readOffset += pendingLen;
+    if (flashRecords)
+      flashRecords--;
+  }
+  else
+  {
+    cacheRead += pendingLen;
+    cacheRecords--;
+    if (cacheRead == cacheLen)
+      cacheLen = cacheRead = 0;
+  }
+  pendingLen = 0;
+}
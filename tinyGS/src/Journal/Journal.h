@@ -0,0 +1,82 @@
+/*
+  Journal.h - Store and forward queue for packets received without MQTT
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define JOURNAL_DIR          "/rxj"
+#define JOURNAL_SEGMENT_SIZE 16384   // bytes per segment file
+#define JOURNAL_MAX_SEGMENTS 48      // 768 KB of the data partition, the oldest segment is dropped after that
+#define JOURNAL_CACHE_SIZE   2048    // RAM write-back cache
+#define JOURNAL_FLUSH_MS     30000   // max time a record waits in RAM
+#define JOURNAL_RECORD_MAX   512
+
+// Append-only FIFO of opaque records. New records go to a RAM cache that is
+// written to flash as a whole when it fills up or gets old, so the flash sees
+// a few large appends instead of one write per packet. On flash the journal is
+// a sequence of segment files in LittleFS (which does the wear levelling),
+// a segment is deleted once every record in it has been read back.
+// Delivery is at least once: a reboot in the middle of a segment replays it
+// from the start.
+class Journal {
+public:
+  static Journal& getInstance()
+  {
+    static Journal instance;
+    return instance;
+  }
+
+  void begin();
+  void loop();
+  bool append(const uint8_t* record, size_t len);
+  void flush();
+  // copies the oldest record to buf and returns its length, 0 if the journal is empty.
+  // The record stays in the journal until pop() is called
+  size_t next(uint8_t* buf, size_t size);
+  void pop();
+  uint32_t depth() { return flashRecords + cacheRecords; }
+  uint32_t dropped() { return droppedRecords; }
+
+private:
+  Journal() {}
+  void segmentPath(char* path, uint32_t segment);
+  void dropOldestSegment();
+  bool mounted = false;
+
+  uint8_t cache[JOURNAL_CACHE_SIZE];
+  size_t cacheLen = 0;          // end of the cached records
+  size_t cacheRead = 0;         // records before this offset were already read back
+  uint32_t cacheRecords = 0;
+  unsigned long cacheSince = 0; // millis() of the oldest unflushed record
+
+  uint32_t firstSegment = 0;    // segments on flash are [firstSegment, nextSegment)
+  uint32_t nextSegment = 0;
+  size_t writeSize = 0;         // size of segment nextSegment - 1
+  size_t readOffset = 0;        // read position inside firstSegment
+  uint32_t flashRecords = 0;
+  uint32_t droppedRecords = 0;
+
+  size_t pendingLen = 0;        // bytes pop() has to skip, 0 -> nothing read
+  bool pendingFlash = false;
+};
+
+#endif
@@ -20,127 +20,341 @@
 #include "Logger.h"
 #include "time.h"
 
-char Log::logIdx = 1;
 Log::LoggingLevels Log::logLevel = LOG_LEVEL;
-char Log::log[MAX_LOG_SIZE] = "";
+char Log::log[MAX_LOG_SIZE];
+Log::LogEntry Log::logIndex[LOG_INDEX_SIZE];
+size_t Log::logStart = 0;
+size_t Log::logUsed = 0;
+uint32_t Log::firstSeq = 1;
+uint32_t Log::nextSeq = 1;
+#if LOG_BINARY
+uint32_t Log::printedSeq = 1;
+#endif
+void (*Log::listener)(uint32_t seq, const char* timeStr, const char* logData) = nullptr;
 
-void Log::console(const char* formatP, ...)
+void Log::write(LoggingLevels level, const char* formatP, ...)
 {
   va_list arg;
   char buffer[256];
   va_start(arg, formatP);
   vsnprintf_P(buffer, sizeof(buffer), formatP, arg);
   va_end(arg);
-  AddLog(LOG_LEVEL_NONE, buffer);
+  AddLog(level, buffer);
 }
 
-void Log::error(const char* formatP, ...)
+// Based on arendst/Tasmota addLog (support.ino)
+void Log::AddLog(Log::LoggingLevels level, const char* logData)
 {
-  va_list arg;
-  char buffer[256];
-  va_start(arg, formatP);
-  vsnprintf_P(buffer, sizeof(buffer), formatP, arg);
-  va_end(arg);
-  AddLog(LOG_LEVEL_ERROR, buffer);
+  if (level > Log::logLevel)
+    return;
+
+  char timeStr[10];  // "13:45:21 "
+  size_t timeLen = formatTime(time(NULL), timeStr, sizeof(timeStr));
+
+  Serial.printf (PSTR ("%s%s\n"), timeStr, logData);
+  store(timeStr, timeLen, logData, strlen(logData));
+  if (listener)
+    listener(nextSeq - 1, timeStr, logData);
 }
 
-void Log::info(const char* formatP, ...)
+size_t Log::formatTime(time_t t, char* buf, size_t size)
 {
-  va_list arg;
-  char buffer[256];
-  va_start(arg, formatP);
-  vsnprintf_P(buffer, sizeof(buffer), formatP, arg);
-  va_end(arg);
-  AddLog(LOG_LEVEL_INFO, buffer);
+  if (t <= 0) {
+    buf[0] = '\0';
+    return 0;
+  }
+  struct tm *timeinfo = localtime (&t);
+  return snprintf_P (buf, size, "%02d:%02d:%02d ", timeinfo->tm_hour, timeinfo->tm_min, timeinfo->tm_sec);
 }
 
-void Log::debug(const char* formatP, ...)
+// adds a line made of data and data2
+void Log::store(const void* data, size_t len, const void* data2, size_t len2)
 {
-  va_list arg;
-  char buffer[256];
-  va_start(arg, formatP);
-  vsnprintf_P(buffer, sizeof(buffer), formatP, arg);
-  va_end(arg);
-  AddLog(LOG_LEVEL_DEBUG, buffer);
+  size_t total = len + len2;
+  if (total > MAX_LOG_SIZE)
+    return;
+
+  // drop the oldest lines until the new one fits
+  while (nextSeq - firstSeq == LOG_INDEX_SIZE || logUsed + total > MAX_LOG_SIZE)
+  {
+    LogEntry &oldest = logIndex[firstSeq % LOG_INDEX_SIZE];
+    logStart = (logStart + oldest.len) % MAX_LOG_SIZE;
+    logUsed -= oldest.len;
+    firstSeq++;
+  }
+
+  size_t offset = (logStart + logUsed) % MAX_LOG_SIZE;
+  ringWrite(offset, data, len);
+  ringWrite((offset + len) % MAX_LOG_SIZE, data2, len2);
+  logIndex[nextSeq % LOG_INDEX_SIZE] = {(uint16_t)offset, (uint16_t)total};
+  logUsed += total;
+  nextSeq++;
 }
 
-// Based on arendst/Tasmota addLog (support.ino)
-void Log::AddLog(Log::LoggingLevels level, const char* logData)
+void Log::ringWrite(size_t offset, const void* data, size_t len)
 {
-  if (level > Log::logLevel)
+  if (!len)
     return;
+  size_t first = MAX_LOG_SIZE - offset;
+  if (first > len)
+    first = len;
+  memcpy(log + offset, data, first);
+  memcpy(log, (const uint8_t*)data + first, len - first);
+}
 
-  char timeStr[10];  // "13:45:21 "
-  time_t currentTime = time (NULL);
-  if (currentTime > 0) {
-      struct tm *timeinfo = localtime (&currentTime);
-      snprintf_P (timeStr, sizeof (timeStr), "%02d:%02d:%02d ", timeinfo->tm_hour, timeinfo->tm_min, timeinfo->tm_sec);
-  }
-  else {
-      timeStr[0] = '\0';
+size_t Log::copyEntry(uint32_t seq, void* buf, size_t size)
+{
+  if (seq - firstSeq >= nextSeq - firstSeq)  // also catches seq < firstSeq
+    return 0;
+
+  const LogEntry &entry = logIndex[seq % LOG_INDEX_SIZE];
+  size_t len = entry.len < size ? entry.len : size;
+  size_t first = MAX_LOG_SIZE - entry.offset;
+  if (first > len)
+    first = len;
+  memcpy(buf, log + entry.offset, first);
+  memcpy((uint8_t*)buf + first, log, len - first);
+  return len;
+}
+
+#if LOG_BINARY
+
+size_t Log::getLog(uint32_t seq, char* buf, size_t size)
+{
+  uint8_t record[LOG_RECORD_SIZE];
+  size_t len = copyEntry(seq, record, sizeof(record));
+  return len ? formatRecord(record, len, buf, size) : 0;
+}
+
+size_t Log::getRecord(uint32_t seq, uint8_t* buf, size_t size)
+{
+  return copyEntry(seq, buf, size);
+}
+
+void Log::loop()
+{
+  if (printedSeq - firstSeq > nextSeq - firstSeq)
+    printedSeq = firstSeq;  // dropped before they were printed
+
+  for (; printedSeq != nextSeq; printedSeq++)
+  {
+    char line[LOG_LINE_SIZE];
+    size_t len = getLog(printedSeq, line, sizeof(line) - 1);
+    line[len] = '\0';
+    Serial.printf (PSTR ("%s\n"), line);
+    if (listener)
+      listener(printedSeq, "", line);
   }
-  
-  Serial.printf (PSTR ("%s%s\n"), timeStr, logData);
+}
+
+namespace {
+// walks the arguments of a record
+struct LogRecordReader {
+  const uint8_t* p;
+  const uint8_t* end;
 
-  // Delimited, zero-terminated buffer of log lines.
-  // Each entry has this format: [index][log data]['\1']
-  while (logIdx == log[0] ||  // If log already holds the next index, remove it
-          strlen(log) + strlen(logData) + 13 > MAX_LOG_SIZE)  // 13 = idx + time + '\1' + '\0'
+  LogArgType peek() { return p < end ? (LogArgType)*p : (LogArgType)0; }
+  bool get(LogArgType type, void* value, size_t size)
   {
-    char* it = log;
-    it++;                                // Skip web_log_index
-    it += strchrspn(it, '\1');           // Skip log line
-    it++;                                // Skip delimiting "\1"
-    memmove(log, it, MAX_LOG_SIZE -(it-log));  // Move buffer forward to remove oldest log line
+    if (peek() != type || p + 1 + size > end)
+      return false;
+    memcpy(value, p + 1, size);
+    p += 1 + size;
+    return true;
   }
-  
-  snprintf_P(log, sizeof(log), PSTR("%s%c%s%s\1"), log, logIdx++, timeStr, logData);
+  void skip()
+  {
+    switch (peek())
+    {
+    case LOG_ARG_INT: p += 1 + 4; break;
+    case LOG_ARG_INT64:
+    case LOG_ARG_DOUBLE: p += 1 + 8; break;
+    case LOG_ARG_PTR: p += 1 + sizeof(void*); break;
+    case LOG_ARG_STR: getStr(); break;
+    default: p = end;  // missing or corrupt, nothing after it can be trusted
+    }
+    if (p > end)
+      p = end;
+  }
+  const char* getStr()
+  {
+    if (peek() != LOG_ARG_STR || p + 2 > end || p + 3 + p[1] > end)
+      return nullptr;
+    const char* s = (const char*)p + 2;
+    p += 3 + p[1];
+    return s;
+  }
+};
+}
 
-  logIdx &= 0xFF;
-  if (!logIdx) 
-    logIdx++;       // Index 0 is not allowed as it is the end of char string*/
+template <typename T>
+static int formatArg(char* buf, size_t size, const char* spec, int numStars, const int* stars, T value)
+{
+  if (numStars == 0)
+    return snprintf(buf, size, spec, value);
+  if (numStars == 1)
+    return snprintf(buf, size, spec, stars[0], value);
+  return snprintf(buf, size, spec, stars[0], stars[1], value);
 }
 
-void Log::getLog(uint32_t idx, char** entry_pp, size_t* len_p)
+// Same output as snprintf with the original arguments. Every conversion is
+// rebuilt from the flags of the format string and the recorded type of the
+// argument, so length modifiers do not need to match the host that decodes it.
+size_t Log::formatRecord(const uint8_t* record, size_t len, char* buf, size_t size)
 {
-  char* entry_p = nullptr;
-  size_t len = 0;
+  const char* format;
+  uint32_t t;
+  if (!size || len < sizeof(format) + sizeof(t))
+    return 0;
+  memcpy(&format, record, sizeof(format));
+  memcpy(&t, record + sizeof(format), sizeof(t));
+  LogRecordReader args = {record + sizeof(format) + sizeof(t), record + len};
 
-  if (idx) {
-    char* it = log;
-    do {
-      uint32_t cur_idx = *it;
-      it++;
-      size_t tmp = strchrspn(it, '\1');
-      tmp++;                             // Skip terminating '\1'
-      if (cur_idx == idx) {              // Found the requested entry
-        len = tmp;
-        entry_p = it;
-        break;
+  size_t n = formatTime(t, buf, size);
+  while (*format && n + 1 < size)
+  {
+    if (*format != '%' || format[1] == '%')
+    {
+      buf[n++] = *format;
+      format += *format == '%' ? 2 : 1;
+      continue;
+    }
+
+    char spec[16] = "%";
+    size_t specLen = 1;
+    int stars[2];
+    int numStars = 0;
+    for (format++; *format && strchr("-+ #0123456789.*", *format); format++)
+    {
+      if (*format == '*')
+      {
+        uint32_t v = 0;
+        args.get(LOG_ARG_INT, &v, sizeof(v));
+        if (numStars < 2)
+          stars[numStars++] = v;
       }
-      it += tmp;
-    } while (it < log + MAX_LOG_SIZE && *it != '\0');
+      if (specLen < sizeof(spec) - 4)
+        spec[specLen++] = *format;
+    }
+    while (*format && strchr("hlLqjzt", *format))
+      format++;
+    char conversion = *format;
+    if (!conversion)
+      break;
+    format++;
+
+    // the recorded type has to fit the conversion, never hand snprintf a wrong argument
+    LogArgType type = args.peek();
+    bool match = (type == LOG_ARG_INT && strchr("diouxXc", conversion)) ||
+                 (type == LOG_ARG_INT64 && strchr("diouxX", conversion)) ||
+                 (type == LOG_ARG_DOUBLE && strchr("fFeEgGaA", conversion)) ||
+                 (type == LOG_ARG_STR && conversion == 's') ||
+                 (type == LOG_ARG_PTR && conversion == 'p');
+    if (type == LOG_ARG_INT64)
+    {
+      spec[specLen++] = 'l';
+      spec[specLen++] = 'l';
+    }
+    spec[specLen++] = conversion;
+    spec[specLen] = '\0';
+
+    int written;
+    if (!match)
+    {
+      args.skip();
+      written = snprintf(buf + n, size - n, "?");
+    }
+    else if (type == LOG_ARG_INT)
+    {
+      uint32_t v = 0;
+      args.get(type, &v, sizeof(v));
+      written = formatArg(buf + n, size - n, spec, numStars, stars, v);
+    }
+    else if (type == LOG_ARG_INT64)
+    {
+      uint64_t v = 0;
+      args.get(type, &v, sizeof(v));
+      written = formatArg(buf + n, size - n, spec, numStars, stars, (unsigned long long)v);
+    }
+    else if (type == LOG_ARG_DOUBLE)
+    {
+      double v = 0;
+      args.get(type, &v, sizeof(v));
+      written = formatArg(buf + n, size - n, spec, numStars, stars, v);
+    }
+    else if (type == LOG_ARG_STR)
+    {
+      written = formatArg(buf + n, size - n, spec, numStars, stars, args.getStr());
+    }
+    else
+    {
+      const void* v = 0;
+      args.get(type, &v, sizeof(v));
+      written = formatArg(buf + n, size - n, spec, numStars, stars, v);
+    }
+
+    if (written < 0)
+      break;
+    n += (size_t)written < size - n ? written : size - n - 1;
   }
-  *entry_pp = entry_p;
-  *len_p = len;
+
+  buf[n] = '\0';
+  return n;
+}
+
+LogRecordWriter::LogRecordWriter(uint8_t* buf, size_t size, const char* format) : buf(buf), bufSize(size)
+{
+  uint32_t t = time(NULL);
+  memcpy(buf, &format, sizeof(format));
+  memcpy(buf + sizeof(format), &t, sizeof(t));
+  len = sizeof(format) + sizeof(t);
+}
+
+void LogRecordWriter::put(LogArgType type, const void* value, size_t size)
+{
+  if (len + 1 + size > bufSize)
+    return;
+  buf[len] = type;
+  memcpy(buf + len + 1, value, size);
+  len += 1 + size;
 }
 
-// Get span until single character in string
-size_t Log::strchrspn(const char *str1, int character)
+void LogRecordWriter::add(const char* value)
 {
-  size_t ret = 0;
-  char *start = (char*)str1;
-  char *end = strchr(str1, character);
-  if (end) ret = end - start;
-  return ret;
+  if (!value)
+    value = "(null)";
+  if (len + 3 > bufSize)
+    return;
+  size_t n = strnlen(value, LOG_STR_MAX);
+  if (n > bufSize - len - 3)
+    n = bufSize - len - 3;  // truncated to what is left
+  buf[len] = LOG_ARG_STR;
+  buf[len + 1] = n;
+  memcpy(buf + len + 2, value, n);
+  buf[len + 2 + n] = '\0';
+  len += 3 + n;
+}
+
+#else
+
+size_t Log::getLog(uint32_t seq, char* buf, size_t size)
+{
+  return copyEntry(seq, buf, size);
 }
 
-char Log::getLogIdx()
+void Log::loop()
 {
-  return logIdx;
+  // lines are printed as they are logged
 }
 
+#endif
+
 void Log::setLogLevel(LoggingLevels level)
 {
   logLevel = level;
-}
\ No newline at end of file
+}
+
+void Log::setListener(void (*logListener)(uint32_t seq, const char* timeStr, const char* logData))
+{
+  listener = logListener;
+}
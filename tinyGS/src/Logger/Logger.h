@@ -17,26 +17,146 @@
   along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
+#ifndef LOGGER_H
+#define LOGGER_H
+
 #include "Arduino.h"
+#include <time.h>
+#include <type_traits>
 
 #define MAX_LOG_SIZE 4000
+#define LOG_LINE_SIZE  266   // "13:45:21 " + message + line break
 #define LOG_LEVEL    LOG_LEVEL_NONE
+// Highest level compiled in, calls above it compile to nothing and can not be
+// enabled at runtime with dmode. Release builds may use -DLOG_MAX_LEVEL=1 (errors only)
+#ifndef LOG_MAX_LEVEL
+#define LOG_MAX_LEVEL 3
+#endif
+
+// With -DLOG_BINARY=1 the log keeps records instead of text: the format string
+// pointer, the time and the arguments. Lines are only formatted when they are
+// read (serial and web console from Log::loop(), /cs), so logging costs a few
+// copies and the same RAM holds several times more lines. tools/logdump.py
+// decodes a /log.bin dump with the firmware ELF.
+#ifndef LOG_BINARY
+#define LOG_BINARY 0
+#endif
+
+#if LOG_BINARY
+#define LOG_INDEX_SIZE  512  // max lines kept, power of two
+#define LOG_RECORD_SIZE 280  // format pointer + time + arguments
+#define LOG_STR_MAX     200  // string arguments are truncated to this
+#else
+#define LOG_INDEX_SIZE  128
+#endif
+
+// type tags of the arguments in a binary record
+enum LogArgType : uint8_t {
+  LOG_ARG_INT    = 'i',  // 4 bytes, anything up to 32 bits
+  LOG_ARG_INT64  = 'I',  // 8 bytes
+  LOG_ARG_DOUBLE = 'd',  // 8 bytes, float is promoted like in printf
+  LOG_ARG_STR    = 's',  // 1 byte length, characters and '\0'
+  LOG_ARG_PTR    = 'p',  // sizeof(void*) bytes
+};
+
+class LogRecordWriter {
+public:
+  LogRecordWriter(uint8_t* buf, size_t size, const char* format);
+  template <typename T>
+  typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type add(T value)
+  {
+    if (sizeof(T) <= 4)
+    {
+      uint32_t v = (uint32_t)value;
+      put(LOG_ARG_INT, &v, sizeof(v));
+    }
+    else
+    {
+      uint64_t v = (uint64_t)value;
+      put(LOG_ARG_INT64, &v, sizeof(v));
+    }
+  }
+  void add(double value) { put(LOG_ARG_DOUBLE, &value, sizeof(value)); }
+  void add(const char* value);
+  void add(const __FlashStringHelper* value) { add((const char*)value); }
+  void add(const void* value) { put(LOG_ARG_PTR, &value, sizeof(value)); }
+  size_t size() { return len; }
+
+private:
+  void put(LogArgType type, const void* value, size_t size);
+  uint8_t* buf;
+  size_t bufSize;
+  size_t len;
+};
 
 class Log {
 public:
   enum LoggingLevels {LOG_LEVEL_NONE, LOG_LEVEL_ERROR, LOG_LEVEL_INFO, LOG_LEVEL_DEBUG};
-  static void console(const char* logData, ...);
-  static void error(const char* logData, ...);
-  static void info(const char* logData, ...);
-  static void debug(const char* logData, ...);
-  static void getLog(uint32_t idx, char** entry_pp, size_t* len_p);
-  static char getLogIdx();
+  template <typename... Args>
+  static void console(const char* logData, Args... args) { logMessage(LOG_LEVEL_NONE, logData, args...); }
+  // the level is checked before the message is formatted
+  template <typename... Args>
+  static void error(const char* logData, Args... args) { if (enabled(LOG_LEVEL_ERROR)) logMessage(LOG_LEVEL_ERROR, logData, args...); }
+  template <typename... Args>
+  static void info(const char* logData, Args... args) { if (enabled(LOG_LEVEL_INFO)) logMessage(LOG_LEVEL_INFO, logData, args...); }
+  template <typename... Args>
+  static void debug(const char* logData, Args... args) { if (enabled(LOG_LEVEL_DEBUG)) logMessage(LOG_LEVEL_DEBUG, logData, args...); }
+  static bool enabled(LoggingLevels level) { return level <= LOG_MAX_LEVEL && level <= logLevel; }
+  // copies line seq (without line break) to buf and returns its length, 0 if it is not kept any more
+  static size_t getLog(uint32_t seq, char* buf, size_t size);
+  static uint32_t getFirstSeq() { return firstSeq; }  // oldest line kept
+  static uint32_t getNextSeq() { return nextSeq; }    // sequence number of the next line, starts at 1
   static void setLogLevel(LoggingLevels level);
+  // called with every line added to the log and its sequence number, from the task that
+  // logged it (from loop() with LOG_BINARY). The line can already be read with getLog.
+  static void setListener(void (*listener)(uint32_t seq, const char* timeStr, const char* logData));
+  static void loop();
+#if LOG_BINARY
+  // copies the raw record of line seq, for dumps
+  static size_t getRecord(uint32_t seq, uint8_t* buf, size_t size);
+  static size_t formatRecord(const uint8_t* record, size_t len, char* buf, size_t size);
+#endif
 
 private:
+  template <typename... Args>
+  static void logMessage(LoggingLevels level, const char* logData, Args... args)
+  {
+#if LOG_BINARY
+    uint8_t record[LOG_RECORD_SIZE];
+    LogRecordWriter writer(record, sizeof(record), logData);
+    int expand[] = {0, (writer.add(args), 0)...};
+    (void)expand;
+    (void)level;  // already filtered
+    store(record, writer.size(), nullptr, 0);
+#else
+    write(level, logData, args...);
+#endif
+  }
+  static void write(LoggingLevels level, const char* logData, ...);
   static void AddLog(LoggingLevels logLevel, const char* logData);
-  static size_t strchrspn(const char *str1, int character);
+  static size_t formatTime(time_t t, char* buf, size_t size);
+  static void store(const void* data, size_t len, const void* data2, size_t len2);
+  static size_t copyEntry(uint32_t seq, void* buf, size_t size);
+  static void ringWrite(size_t offset, const void* data, size_t len);
+
+  // Log lines are stored back to back in a circular byte buffer, line seq is described
+  // by logIndex[seq % LOG_INDEX_SIZE]. Lines are never split in the index but may wrap
+  // around the end of the buffer.
+  struct LogEntry {
+    uint16_t offset;
+    uint16_t len;
+  };
   static char log[MAX_LOG_SIZE];
-  static char logIdx;
+  static LogEntry logIndex[LOG_INDEX_SIZE];
+  static size_t logStart;    // offset of line firstSeq
+  static size_t logUsed;
+  static uint32_t firstSeq;  // lines kept are [firstSeq, nextSeq)
+  static uint32_t nextSeq;
+#if LOG_BINARY
+  static uint32_t printedSeq; // next line loop() has to print
+#endif
   static LoggingLevels logLevel;
+  static void (*listener)(uint32_t seq, const char* timeStr, const char* logData);
 };
+
+#endif
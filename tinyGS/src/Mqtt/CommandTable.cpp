@@ -0,0 +1,65 @@
+/*
+  CommandTable.cpp - Topic parsing and lookup of the remote commands
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "CommandTable.h"
+
+// Payload examples of the commands are next to their handlers in MQTT_Client.cpp
+const CommandInfo commandTable[] = {
+  {"Fd",               COMMAND_BATCH,  CMD_FD},
+  {"SPIreadRegister",  0,              CMD_SPI_READ_REGISTER},
+  {"SPIsetRegValue",   COMMAND_BATCH,  CMD_SPI_SET_REG_VALUE},
+  {"SPIwriteRegister", COMMAND_BATCH,  CMD_SPI_WRITE_REGISTER},
+  {"aldro",            COMMAND_BATCH,  CMD_ALDRO},
+  {"batch_conf",       0,              CMD_BATCH_CONF},
+  {"begin_fsk",        COMMAND_BATCH,  CMD_BEGIN_FSK},
+  {"begin_lora",       COMMAND_BATCH,  CMD_BEGIN_LORA},
+  {"begine",           0,              CMD_BEGINE},
+  {"beginp",           0,              CMD_BEGINP},
+  {"br",               COMMAND_BATCH,  CMD_BR},
+  {"bw",               COMMAND_BATCH,  CMD_BW},
+  {"cr",               0,              CMD_CR},
+  {"crc",              COMMAND_BATCH,  CMD_CRC},
+  {"dec",              COMMAND_BATCH,  CMD_DEC},
+  {"fbw",              COMMAND_BATCH,  CMD_FBW},
+  {"filter",           COMMAND_BATCH,  CMD_FILTER},
+  {"fldro",            COMMAND_BATCH,  CMD_FLDRO},
+  {"foff",             0,              CMD_FOFF},
+  {"fok",              COMMAND_BATCH,  CMD_FOK},
+  {"frame",            COMMAND_GLOBAL, CMD_FRAME},
+  {"freq",             COMMAND_BATCH,  CMD_FREQ},
+  {"fsw",              COMMAND_BATCH,  CMD_FSW},
+  {"get_adv_prm",      0,              CMD_GET_ADV_PRM},
+  {"log",              COMMAND_GLOBAL, CMD_LOG},
+  {"lsw",              COMMAND_BATCH,  CMD_LSW},
+  {"perf",             0,              CMD_PERF},
+  {"pl",               COMMAND_BATCH,  CMD_PL},
+  {"reset",            COMMAND_GLOBAL, CMD_RESET},
+  {"rxb",              COMMAND_BATCH,  CMD_RXB},
+  {"sat",              COMMAND_BATCH,  CMD_SAT},
+  {"sat_pos_oled",     COMMAND_GLOBAL, CMD_SAT_POS_OLED},
+  {"set_adv_prm",      0,              CMD_SET_ADV_PRM},
+  {"sf",               COMMAND_BATCH,  CMD_SF},
+  {"siesta",           0,              CMD_SIESTA},
+  {"sleep",            0,              CMD_SLEEP},
+  {"status",           COMMAND_GLOBAL, CMD_STATUS},
+  {"tx",               COMMAND_GLOBAL, CMD_TX},
+  {"update",           COMMAND_GLOBAL, CMD_UPDATE},
+};
+
+const size_t numCommands = sizeof(commandTable) / sizeof(commandTable[0]);
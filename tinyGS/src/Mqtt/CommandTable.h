@@ -0,0 +1,196 @@
+/*
+  CommandTable.h - Topic parsing and lookup of the remote commands
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef COMMAND_TABLE_H
+#define COMMAND_TABLE_H
+
+// The part of the MQTT command dispatch that has no Arduino dependencies:
+// the names, flags and handler of every remote command and the decision of
+// what runs and what is acked, so it builds on the host with the tests.
+// MQTT_Client holds the handlers, indexed by CommandId.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define COMMAND_GLOBAL  0x01     // also accepted on the global topic
+#define COMMAND_BATCH   0x02     // can be used as a key of batch_conf
+#define COMMAND_NO_ACK  INT32_MIN
+#define COMMAND_UNKNOWN 0xFF     // ack of a command not in the table or not accepted on the topic
+
+enum CommandId : uint8_t {
+  CMD_FD,
+  CMD_SPI_READ_REGISTER,
+  CMD_SPI_SET_REG_VALUE,
+  CMD_SPI_WRITE_REGISTER,
+  CMD_ALDRO,
+  CMD_BATCH_CONF,
+  CMD_BEGIN_FSK,
+  CMD_BEGIN_LORA,
+  CMD_BEGINE,
+  CMD_BEGINP,
+  CMD_BR,
+  CMD_BW,
+  CMD_CR,
+  CMD_CRC,
+  CMD_DEC,
+  CMD_FBW,
+  CMD_FILTER,
+  CMD_FLDRO,
+  CMD_FOFF,
+  CMD_FOK,
+  CMD_FRAME,
+  CMD_FREQ,
+  CMD_FSW,
+  CMD_GET_ADV_PRM,
+  CMD_LOG,
+  CMD_LSW,
+  CMD_PERF,
+  CMD_PL,
+  CMD_RESET,
+  CMD_RXB,
+  CMD_SAT,
+  CMD_SAT_POS_OLED,
+  CMD_SET_ADV_PRM,
+  CMD_SF,
+  CMD_SIESTA,
+  CMD_SLEEP,
+  CMD_STATUS,
+  CMD_TX,
+  CMD_UPDATE,
+  CMD_COUNT
+};
+
+struct CommandInfo {
+  const char* name;
+  uint8_t flags;
+  CommandId handler;
+};
+
+// sorted by name (strcmp order) for commandLookup(), checked at boot
+extern const CommandInfo commandTable[];
+extern const size_t numCommands;
+
+struct CommandTopic {
+  bool global;     // tinygs/global/cmnd/... instead of tinygs/<user>/<station>/cmnd/...
+  int radio;       // from cmnd/<radio>/<command>, -1 without it
+  char* command;
+};
+
+// Splits topic in place with strtok, so the parts after the command can still
+// be read with strtok(NULL, "/"). False if it has no command or addresses a
+// radio the station does not have.
+static inline bool parseCommandTopic(char* topic, uint8_t radios, CommandTopic& t)
+{
+  t.global = true;
+  t.radio = -1;
+  strtok(topic, "/");                      // tinygs
+  const char* user = strtok(NULL, "/");
+  if (!user)
+    return false;
+  if (strcmp(user, "global"))
+  {
+    t.global = false;
+    strtok(NULL, "/"); // station
+  }
+  strtok(NULL, "/"); // cmnd
+  t.command = strtok(NULL, "/");
+  if (!t.command)
+    return false;
+
+  if (isdigit(t.command[0]))
+  {
+    int radio = atoi(t.command);
+    t.command = strtok(NULL, "/");
+    if (!t.command || radio >= radios)
+      return false;
+    t.radio = radio;
+  }
+  return true;
+}
+
+// Binary search of a table of entries with a name member, sorted in strcmp order
+template <typename T>
+static const T* commandLookup(const T* table, size_t n, const char* name)
+{
+  size_t low = 0;
+  size_t high = n;
+  while (low < high)
+  {
+    size_t mid = (low + high) / 2;
+    int cmp = strcmp(name, table[mid].name);
+    if (!cmp)
+      return &table[mid];
+    if (cmp < 0)
+      high = mid;
+    else
+      low = mid + 1;
+  }
+  return nullptr;
+}
+
+template <typename T>
+static bool commandTableSorted(const T* table, size_t n)
+{
+  for (size_t i = 1; i < n; i++)
+    if (strcmp(table[i - 1].name, table[i].name) >= 0)
+      return false;
+  return true;
+}
+
+// key of batch_conf, null if it is unknown or can not be batched
+static inline const CommandInfo* findBatchCommand(const char* key)
+{
+  const CommandInfo* cmd = commandLookup(commandTable, numCommands, key);
+  return cmd && cmd->flags & COMMAND_BATCH ? cmd : nullptr;
+}
+
+// Runs the command of a cmnd topic, which is split in place, and tells what
+// to send back. run(cmd, radio) is only called for a command accepted on the
+// topic and returns its result. Commands on the global topic are never acked,
+// the others get the result on stat/[<radio>/]<command> unless it is
+// COMMAND_NO_ACK. Returns true with ackTopic and ack set if there is an ack.
+template <typename Run>
+static bool dispatchCommand(char* topic, uint8_t radios, Run run, char* ackTopic, size_t ackSize, uint16_t& ack)
+{
+  CommandTopic t;
+  if (!parseCommandTopic(topic, radios, t))
+    return false;
+
+  if (t.radio >= 0)
+    snprintf(ackTopic, ackSize, "%d/%s", t.radio, t.command);
+  else
+    snprintf(ackTopic, ackSize, "%s", t.command);
+
+  // the remote tune commands are only accepted on the station topic
+  int32_t result = COMMAND_UNKNOWN;
+  const CommandInfo* cmd = commandLookup(commandTable, numCommands, t.command);
+  if (cmd && (!t.global || cmd->flags & COMMAND_GLOBAL))
+    result = run(*cmd, t.radio < 0 ? 0 : t.radio);
+
+  if (t.global || result == COMMAND_NO_ACK)
+    return false;
+  ack = result;
+  return true;
+}
+
+#endif
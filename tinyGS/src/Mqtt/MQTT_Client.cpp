@@ -25,6 +25,12 @@
 #include "../Radio/Radio.h"
 #include "../OTA/OTA.h"
 #include "../Logger/Logger.h"
+#include "../FramePool/FramePool.h"
+#include "../Satellites/Satellites.h"
+#include "RxBinary.h"
+#include "PublishStream.h"
+#include "../Journal/Journal.h"
+#include <base64.h>
 
 MQTT_Client::MQTT_Client()
     : PubSubClient(espClient)
@@ -60,11 +66,11 @@ void MQTT_Client::loop()
   if (connectionAtempts > connectionTimeout)
   {
     Log::console(PSTR("Unable to connect to MQTT Server after many atempts. Restarting..."));
+    Journal::getInstance().flush();
     // if board is on LOW POWER mode instead of directly reboot it, force a 4hours deep sleep. 
     ConfigManager &configManager = ConfigManager::getInstance();
     if (configManager.getLowPower()) 
     {
-      Radio &radio = Radio::getInstance();
       uint32_t sleep_seconds = 4*3600; // 4 hours deep sleep. 
       Log::debug(PSTR("deep_sleep_enter"));
       esp_sleep_enable_timer_wakeup( 1000000ULL * sleep_seconds); // using ULL  Unsigned Long long
@@ -73,7 +79,8 @@ void MQTT_Client::loop()
       WiFi.disconnect(true);
       delay(100);
       //  TODO: apagar OLED
-      radio.moduleSleep();
+      for (uint8_t i = 0; i < Radio::count(); i++)
+        Radio::getInstance(i).moduleSleep();
       esp_deep_sleep_start();
       delay(1000);   // shouldn't arrive here
     }
@@ -93,19 +100,66 @@ void MQTT_Client::loop()
       sendWelcome();
     else
     {
-      StaticJsonDocument<128> doc;
+      StaticJsonDocument<416> doc;
       doc["Vbat"] = voltage();
       doc["Mem"] = ESP.getFreeHeap();
       doc["RSSI"] =WiFi.RSSI();
       doc["radio"]= status.radio_error;
       doc["InstRSSI"]= status.modeminfo.currentRssi;
+      // the radio counters are station totals, the duty cycle the mean of all radios
+      uint32_t rxDropped = 0;
+      HdlcStats hdlc;
+      RxDutyStats duty;
+      uint32_t dutyCycle = 0;
+      RxMode rxMode = RX_CONTINUOUS;
+      for (uint8_t i = 0; i < Radio::count(); i++)
+      {
+        Radio& radio = Radio::getInstance(i);
+        rxDropped += radio.getRxDropped();
+        const HdlcStats& h = radio.getHdlcStats();
+        hdlc.frames += h.frames;
+        hdlc.crcErrors += h.crcErrors;
+        hdlc.aborts += h.aborts;
+        hdlc.frameErrors += h.frameErrors;
+        hdlc.dropped += h.dropped;
+        dutyCycle += radio.getDutyCycle();
+        if (radio.getRxMode() == RX_CONTINUOUS)
+          continue;
+        if (rxMode == RX_CONTINUOUS)
+          rxMode = radio.getRxMode();
+        const RxDutyStats& d = radio.getDutyStats();
+        duty.scans += d.scans;
+        duty.detections += d.detections;
+        duty.missed += d.missed;
+      }
+      doc["rxDrop"]= rxDropped;
+      doc["poolHwm"]= FramePool::getInstance().highWaterMark();
+      doc["poolExh"]= FramePool::getInstance().exhausted();
+      doc["hdlcOk"]= hdlc.frames;
+      doc["hdlcCrc"]= hdlc.crcErrors;
+      doc["hdlcAbt"]= hdlc.aborts;
+      doc["hdlcErr"]= hdlc.frameErrors;
+      doc["hdlcDrop"]= hdlc.dropped;
+      doc["jrnl"]= Journal::getInstance().depth();
+      doc["jrnlDrop"]= Journal::getInstance().dropped();
+      if (rxMode != RX_CONTINUOUS)
+      {
+        doc["rxMode"]= rxMode;
+        doc["duty"]= dutyCycle / Radio::count();
+        doc["cadScan"]= duty.scans;
+        doc["cadDet"]= duty.detections;
+        doc["cadMiss"]= duty.missed;
+      }
 
-      char buffer[256];
-      serializeJson(doc, buffer);
-      Log::debug(PSTR("%s"), buffer);
-      publish(buildTopic(teleTopic, topicPing).c_str(), buffer, false);
+      publishJson(buildTopic(TOPIC_TELE, topicPing), doc);
     }
   }
+
+  if (connected() && now - lastBackfill > backfillInterval && !Radio::anyPending())
+  {
+    lastBackfill = now;
+    sendBackfill();
+  }
 }
 
 void MQTT_Client::reconnect()
@@ -115,11 +169,13 @@ void MQTT_Client::reconnect()
   char clientId[13];
   sprintf(clientId, "%04X%08X", (uint16_t)(chipId >> 32), (uint32_t)chipId);
 
-  if (connect(clientId, configManager.getMqttUser(), configManager.getMqttPass(), buildTopic(teleTopic, topicStatus).c_str(), 2, false, "0"))
+  buildTopicPrefixes();
+  if (connect(clientId, configManager.getMqttUser(), configManager.getMqttPass(), buildTopic(TOPIC_TELE, topicStatus), 2, false, "0"))
   {
     yield();
     Log::console(PSTR("Connected to MQTT!"));
     status.mqtt_connected = true;
+    rxBinary = 0; // the server enables it again after reading the welcome
     subscribeToAll();
     sendWelcome();
   }
@@ -155,21 +211,32 @@ void MQTT_Client::reconnect()
   }
 }
 
-String MQTT_Client::buildTopic(const char *baseTopic, const char *cmnd)
+void MQTT_Client::buildTopicPrefixes()
 {
   ConfigManager &configManager = ConfigManager::getInstance();
-  String topic = baseTopic;
-  topic.replace("%user%", configManager.getMqttUser());
-  topic.replace("%station%", configManager.getThingName());
-  topic.replace("%cmnd%", cmnd);
+  for (uint8_t i = 0; i < TOPIC_BASES; i++)
+  {
+    int len = snprintf(topicPrefix[i], sizeof(topicPrefix[i]), topicBases[i], configManager.getMqttUser(), configManager.getThingName());
+    topicPrefixLen[i] = len < (int)sizeof(topicPrefix[i]) ? len : sizeof(topicPrefix[i]) - 1;
+  }
+}
+
+// The returned buffer is reused by the next call, publish() and subscribe() copy it
+const char* MQTT_Client::buildTopic(TopicBase base, const char *cmnd)
+{
+  size_t len = topicPrefixLen[base];
+  size_t cmndLen = strnlen(cmnd, sizeof(topic) - len - 1);
+  memcpy(topic, topicPrefix[base], len);
+  memcpy(topic + len, cmnd, cmndLen);
+  topic[len + cmndLen] = '\0';
 
   return topic;
 }
 
 void MQTT_Client::subscribeToAll()
 {
-  subscribe(buildTopic(globalTopic, "#").c_str());
-  subscribe(buildTopic(cmndTopic, "#").c_str());
+  subscribe(buildTopic(TOPIC_GLOBAL, "#"));
+  subscribe(buildTopic(TOPIC_CMND, "#"));
 }
 
 void MQTT_Client::sendWelcome()
@@ -183,7 +250,7 @@ void MQTT_Client::sendWelcome()
   char clientId[13];
   sprintf(clientId, "%04X%08X", (uint16_t)(chipId >> 32), (uint32_t)chipId);
 
-  const size_t capacity = JSON_ARRAY_SIZE(2) + JSON_OBJECT_SIZE(17) + 22 + 20 + 20 + 20 + 40+ 20;
+  const size_t capacity = JSON_ARRAY_SIZE(2) + JSON_OBJECT_SIZE(18) + 22 + 20 + 20 + 20 + 40+ 20;
   DynamicJsonDocument doc(capacity);
   JsonArray station_location = doc.createNestedArray("station_location");
   station_location.add(configManager.getLatitude());
@@ -206,62 +273,213 @@ void MQTT_Client::sendWelcome()
   doc["seconds"] = millis()/1000;
   doc["Vbat"] = voltage();
   doc["chip"] = ESP.getChipModel();
+  doc["rxb"] = RXB_VERSION;
 
-  char buffer[1048];
-  serializeJson(doc, buffer);
-  publish(buildTopic(teleTopic, topicWelcome).c_str(), buffer, false);
+  publishJson(buildTopic(TOPIC_TELE, topicWelcome), doc);
 }
 
-void MQTT_Client::sendRx(String packet, bool noisy)
+void MQTT_Client::sendRx(uint8_t radio, const uint8_t *frame, size_t len, bool noisy)
 {
   ConfigManager &configManager = ConfigManager::getInstance();
-  time_t now;
-  time(&now);
-  struct timeval tv;
-  gettimeofday(&tv, NULL);
+  const ModemInfo &m = Radio::getInstance(radio).getModem();
+  const PacketInfo &p = Radio::getInstance(radio).getLastPacket();
+
+  RxbHeader hdr = {};
+  hdr.radio = radio;
+  hdr.norad = m.NORAD;
+  hdr.usecTime = p.usecTime;
+  hdr.usecError = p.usecError;
+  hdr.timeOffset = status.time_offset;
+  hdr.frequency = m.frequency;
+  hdr.freqOffset = m.freqOffset;
+  hdr.bw = m.bw;
+  if (m.modem_mode == "LoRa")
+  {
+    hdr.flags |= RXB_LORA;
+    hdr.sf = m.sf;
+    hdr.cr = m.cr;
+  }
+  else
+  {
+    hdr.bitrate = m.bitrate;
+    hdr.freqDev = m.freqDev;
+  }
+  hdr.rssi = p.rssi;
+  hdr.snr = p.snr;
+  hdr.frequencyError = p.frequencyerror;
+  hdr.latitude = configManager.getLatitude();
+  hdr.longitude = configManager.getLongitude();
+  if (p.crc_error)
+    hdr.flags |= RXB_CRC_ERROR;
+  if (noisy)
+    hdr.flags |= RXB_NOISY;
+  if (p.fec)
+  {
+    hdr.flags |= RXB_FEC;
+    hdr.fecCorrected = p.fecCorrected;
+    hdr.fecBitErrors = p.fecBitErrors;
+  }
+
+  if (connected() && publishRx(hdr, frame, len, m.satellite, m.modem_mode.c_str()))
+    return;
 
-  const size_t capacity = JSON_ARRAY_SIZE(2) + JSON_OBJECT_SIZE(23) + 25;
+  // no connection, keep it in the journal with its original timestamp
+  // record: rxb message followed by the satellite name
+  Journal &journal = Journal::getInstance();
+  uint8_t record[JOURNAL_RECORD_MAX];
+  size_t satLen = strlen(m.satellite);
+  size_t recLen = rxbEncode(hdr, frame, len, record, sizeof(record) - satLen);
+  if (recLen)
+    memcpy(record + recLen, m.satellite, satLen);
+  if (!recLen || !journal.append(record, recLen + satLen))
+  {
+    Log::console(PSTR("No MQTT connection, packet lost"));
+    return;
+  }
+  Log::console(PSTR("No MQTT connection, packet stored (%u waiting)"), journal.depth());
+}
+
+bool MQTT_Client::publishRx(const RxbHeader &hdr, const uint8_t *frame, size_t len, const char *satellite, const char *mode)
+{
+  if (rxBinary)
+  {
+    RxbHeader h = hdr;
+    if (!rxbSetLength(h, len, rxBinary))
+    {
+      Log::error(PSTR("Frame too long for the binary uplink (%u bytes)"), len);
+      return true; // it would not fit in the journal either
+    }
+
+    Log::debug(PSTR("rxb v%u %u bytes, NORAD %u"), h.version, h.headerLen + len, hdr.norad);
+    PERF_MARK(PERF_ENCODE);
+    if (!beginPublish(buildTopic(TOPIC_TELE, topicRxBin), h.headerLen + len, false))
+      return false;
+    if (write((const uint8_t *)&h, h.headerLen) + write(frame, len) != h.headerLen + len)
+    {
+      espClient.stop(); // the broker got a partial message, start over with a new connection
+      return false;
+    }
+    PERF_MARK(PERF_PUBLISH);
+    return endPublish();
+  }
+
+  String packet = base64::encode(frame, len);
+  const size_t capacity = JSON_ARRAY_SIZE(2) + JSON_OBJECT_SIZE(26) + 25;
   DynamicJsonDocument doc(capacity);
   JsonArray station_location = doc.createNestedArray("station_location");
-  station_location.add(configManager.getLatitude());
-  station_location.add(configManager.getLongitude());
-  doc["mode"] = status.modeminfo.modem_mode;
-  doc["frequency"] = status.modeminfo.frequency;
-  doc["frequency_offset"] = status.modeminfo.freqOffset;
-  doc["satellite"] = status.modeminfo.satellite;
-
-  if (String(status.modeminfo.modem_mode) == "LoRa")
+  station_location.add(hdr.latitude);
+  station_location.add(hdr.longitude);
+  doc["mode"] = mode;
+  doc["frequency"] = hdr.frequency;
+  doc["frequency_offset"] = hdr.freqOffset;
+  doc["satellite"] = satellite;
+
+  if (hdr.flags & RXB_LORA)
   {
-    doc["sf"] = status.modeminfo.sf;
-    doc["cr"] = status.modeminfo.cr;
-    doc["bw"] = status.modeminfo.bw;
+    doc["sf"] = hdr.sf;
+    doc["cr"] = hdr.cr;
+    doc["bw"] = hdr.bw;
   }
   else
   {
-    doc["bitrate"] = status.modeminfo.bitrate;
-    doc["freqdev"] = status.modeminfo.freqDev;
-    doc["rxBw"] = status.modeminfo.bw;
+    doc["bitrate"] = hdr.bitrate;
+    doc["freqdev"] = hdr.freqDev;
+    doc["rxBw"] = hdr.bw;
   }
 
-  doc["rssi"] = status.lastPacketInfo.rssi;
-  doc["snr"] = status.lastPacketInfo.snr;
-  doc["frequency_error"] = status.lastPacketInfo.frequencyerror;
-  doc["unix_GS_time"] = now;
-  doc["usec_time"] = (int64_t)tv.tv_usec + tv.tv_sec * 1000000ll;
-  doc["time_offset"] = status.time_offset;
-  doc["crc_error"] = status.lastPacketInfo.crc_error;
+  doc["rssi"] = hdr.rssi;
+  doc["snr"] = hdr.snr;
+  doc["frequency_error"] = hdr.frequencyError;
+  doc["unix_GS_time"] = (time_t)(hdr.usecTime / 1000000ll);
+  doc["usec_time"] = hdr.usecTime;
+  if (hdr.usecError != RXB_TIME_ERROR_UNKNOWN)
+    doc["usec_err"] = hdr.usecError;
+  doc["time_offset"] = hdr.timeOffset;
+  doc["crc_error"] = (bool)(hdr.flags & RXB_CRC_ERROR);
   doc["data"] = packet.c_str();
-  doc["NORAD"] = status.modeminfo.NORAD;
-  doc["noisy"] = noisy;
+  doc["NORAD"] = hdr.norad;
+  doc["noisy"] = (bool)(hdr.flags & RXB_NOISY);
+  if (hdr.flags & RXB_FEC)
+  {
+    doc["fec_corrected"] = hdr.fecCorrected;
+    doc["fec_bit_errors"] = hdr.fecBitErrors;
+  }
+  if (hdr.flags & RXB_REPLAY)
+    doc["replay"] = true;
+  if (hdr.radio)
+    doc["radio"] = hdr.radio;
+
+  PERF_MARK(PERF_ENCODE);
+  if (!publishJson(buildTopic(TOPIC_TELE, topicRx), doc))
+    return false;
+  PERF_MARK(PERF_PUBLISH);
+  return true;
+}
+
+// Serializes the document straight into the connection, there is no copy of the
+// message in RAM and its size is not limited by MQTT_MAX_PACKET_SIZE
+bool MQTT_Client::publishJson(const char *topic, const JsonDocument &doc)
+{
+  size_t len = measureJson(doc);
+  Log::debug(PSTR("%s: %u bytes"), topic, len);
+  if (!beginPublish(topic, len, false))
+    return false;
+
+  PublishStream stream(*this);
+  serializeJson(doc, stream);
+  if (stream.end() != len)
+  {
+    espClient.stop(); // the broker got a partial message, start over with a new connection
+    return false;
+  }
+  return endPublish();
+}
+
+// Sends the oldest packet of the journal, called at a limited rate so live packets go first
+void MQTT_Client::sendBackfill()
+{
+  Journal &journal = Journal::getInstance();
+  uint8_t record[JOURNAL_RECORD_MAX];
+  size_t recLen = journal.next(record, sizeof(record));
+  if (!recLen)
+    return;
+
+  RxbHeader hdr;
+  const uint8_t *frame;
+  if (!rxbDecode(record, recLen, &hdr, &frame))
+  {
+    Log::error(PSTR("Journal: malformed record dropped"));
+    journal.pop();
+    return;
+  }
+
+  char satellite[sizeof(status.modeminfo.satellite)];
+  size_t satLen = recLen - hdr.headerLen - hdr.dataLen;
+  if (satLen >= sizeof(satellite))
+    satLen = sizeof(satellite) - 1;
+  memcpy(satellite, frame + hdr.dataLen, satLen);
+  satellite[satLen] = '\0';
 
-  char buffer[1536];
-  serializeJson(doc, buffer);
-  Log::debug(PSTR("%s"), buffer);
-  publish(buildTopic(teleTopic, topicRx).c_str(), buffer, false);
+  hdr.flags |= RXB_REPLAY;
+  if (!publishRx(hdr, frame, hdr.dataLen, satellite, (hdr.flags & RXB_LORA) ? "LoRa" : "FSK"))
+    return;
+
+  journal.pop();
+  if (!journal.depth())
+    Log::console(PSTR("Journal: all stored packets sent"));
 }
 
 void MQTT_Client::sendStatus()
 {
+  for (uint8_t i = 0; i < Radio::count(); i++)
+    sendStatus(i);
+}
+
+// one message per radio, the ones after the first are tagged with their index
+void MQTT_Client::sendStatus(uint8_t radio)
+{
+  const ModemInfo &m = Radio::getInstance(radio).getModem();
+  const PacketInfo &p = Radio::getInstance(radio).getLastPacket();
   ConfigManager &configManager = ConfigManager::getInstance();
   time_t now;
   time(&now);
@@ -277,41 +495,48 @@ void MQTT_Client::sendStatus()
   doc["board"] = configManager.getBoard();
   doc["tx"] = configManager.getAllowTx();
 
-  doc["mode"] = status.modeminfo.modem_mode;
-  doc["frequency"] = status.modeminfo.frequency;
-  doc["frequency_offset"] = status.modeminfo.freqOffset;
-  doc["satellite"] = status.modeminfo.satellite;
-  doc["NORAD"] = status.modeminfo.NORAD;
+  doc["mode"] = m.modem_mode;
+  doc["frequency"] = m.frequency;
+  doc["frequency_offset"] = m.freqOffset;
+  doc["satellite"] = m.satellite;
+  doc["NORAD"] = m.NORAD;
 
-  if (String(status.modeminfo.modem_mode) == "LoRa")
+  if (m.modem_mode == "LoRa")
   {
-    doc["sf"] = status.modeminfo.sf;
-    doc["cr"] = status.modeminfo.cr;
-    doc["bw"] = status.modeminfo.bw;
+    doc["sf"] = m.sf;
+    doc["cr"] = m.cr;
+    doc["bw"] = m.bw;
   }
   else
   {
-    doc["bitrate"] = status.modeminfo.bitrate;
-    doc["freqdev"] = status.modeminfo.freqDev;
-    doc["rxBw"] = status.modeminfo.bw;
+    doc["bitrate"] = m.bitrate;
+    doc["freqdev"] = m.freqDev;
+    doc["rxBw"] = m.bw;
   }
 
-  doc["pl"] = status.modeminfo.preambleLength;
-  doc["CRC"] = status.modeminfo.crc;
-  doc["FLDRO"] = status.modeminfo.fldro;
-  doc["OOK"] = status.modeminfo.OOK;
-
-  doc["rssi"] = status.lastPacketInfo.rssi;
-  doc["snr"] = status.lastPacketInfo.snr;
-  doc["frequency_error"] = status.lastPacketInfo.frequencyerror;
-  doc["crc_error"] = status.lastPacketInfo.crc_error;
+  doc["pl"] = m.preambleLength;
+  doc["CRC"] = m.crc;
+  doc["FLDRO"] = m.fldro;
+  doc["OOK"] = m.OOK;
+
+  // on air time model of the settings above, us
+  const ModemTiming& timing = Radio::getInstance(radio).getTiming();
+  doc["symbol_us"] = timing.symbol();
+  doc["preamble_us"] = timing.preamble();
+  doc["byte_us"] = timing.perByte();
+  doc["max_airtime_us"] = timing.airtime(timing.isLoRa() ? RX_LORA_MAX_LEN : m.len);  // m.len is the FSK packet length
+
+  doc["rssi"] = p.rssi;
+  doc["snr"] = p.snr;
+  doc["frequency_error"] = p.frequencyerror;
+  doc["crc_error"] = p.crc_error;
   doc["unix_GS_time"] = now;
   doc["usec_time"] = (int64_t)tv.tv_usec + tv.tv_sec * 1000000ll;
   doc["time_offset"] = status.time_offset;
+  if (radio)
+    doc["radio"] = radio;
 
-  char buffer[1024];
-  serializeJson(doc, buffer);
-  publish(buildTopic(statTopic, topicStatus).c_str(), buffer, false);
+  publishJson(buildTopic(TOPIC_STAT, topicStatus), doc);
 }
 
 void MQTT_Client::sendAdvParameters()
@@ -319,12 +544,18 @@ void MQTT_Client::sendAdvParameters()
   ConfigManager &configManager = ConfigManager::getInstance();
   StaticJsonDocument<512> doc;
   doc["adv_prm"].set(configManager.getAvancedConfig());
-  char buffer[512];
-  serializeJson(doc, buffer);
-  Log::debug(PSTR("%s"), buffer);
-  publish(buildTopic(teleTopic, topicGet_adv_prm).c_str(), buffer, false);
+  publishJson(buildTopic(TOPIC_TELE, topicGet_adv_prm), doc);
 }
 
+#if PERF_STATS
+void MQTT_Client::sendPerf()
+{
+  DynamicJsonDocument doc(Perf::jsonCapacity());
+  Perf::getInstance().toJson(doc);
+  publishJson(buildTopic(TOPIC_STAT, topicPerf), doc);
+}
+#endif
+
 // helper funcion (this has to dissapear)
 bool isValidFrequency(uint8_t radio, float f)
 {
@@ -335,409 +566,343 @@ bool isValidFrequency(uint8_t radio, float f)
         (radio == 8 && (f < 2400|| f > 2500)));
 }
 
-void MQTT_Client::manageMQTTData(char *topic, uint8_t *payload, unsigned int length)
+int32_t MQTT_Client::runCommand(CommandId id, char *payload, size_t length)
 {
-  Radio &radio = Radio::getInstance();
-
-  bool global = true;
-  char *command;
-  strtok(topic, "/");                      // tinygs
-  if (strcmp(strtok(NULL, "/"), "global")) // user
+  Radio &radio = Radio::getInstance(cmdRadio);
+  switch (id)
   {
-    global = false;
-    strtok(NULL, "/"); // station
-  }
-  strtok(NULL, "/"); // cmnd
-  command = strtok(NULL, "/");
-  uint16_t result = 0xFF;
-
-  if (!strcmp(command, commandSatPos))
-  {
-    manageSatPosOled((char *)payload, length);
-    return; // no ack
-  }
-
-  if (!strcmp(command, commandReset))
-    ESP.restart();
-
-  if (!strcmp(command, commandUpdate))
-  {
-    OTA::update();
-    return; // no ack
-  }
-
-  if (!strcmp(command, commandFrame))
-  {
-    uint8_t frameNumber = atoi(strtok(NULL, "/"));
-    DynamicJsonDocument doc(JSON_ARRAY_SIZE(5) * 15 + JSON_ARRAY_SIZE(15));
-    deserializeJson(doc, payload, length);
-    status.remoteTextFrameLength[frameNumber] = doc.size();
-    Log::debug(PSTR("Received frame: %u"), status.remoteTextFrameLength[frameNumber]);
-
-    for (uint8_t n = 0; n < status.remoteTextFrameLength[frameNumber]; n++)
-    {
-      status.remoteTextFrame[frameNumber][n].text_font = doc[n][0];
-      status.remoteTextFrame[frameNumber][n].text_alignment = doc[n][1];
-      status.remoteTextFrame[frameNumber][n].text_pos_x = doc[n][2];
-      status.remoteTextFrame[frameNumber][n].text_pos_y = doc[n][3];
-      String text = doc[n][4];
-      status.remoteTextFrame[frameNumber][n].text = text;
-
-      Log::debug(PSTR("Text: %u Font: %u Alig: %u Pos x: %u Pos y: %u -> %s"), n,
-                 status.remoteTextFrame[frameNumber][n].text_font,
-                 status.remoteTextFrame[frameNumber][n].text_alignment,
-                 status.remoteTextFrame[frameNumber][n].text_pos_x,
-                 status.remoteTextFrame[frameNumber][n].text_pos_y,
-                 status.remoteTextFrame[frameNumber][n].text.c_str());
-    }
-
-    result = 0;
-  }
-
-  if (!strcmp(command, commandStatus))
-  {
-    uint8_t mode = payload[0] - '0';
-    Log::debug(PSTR("Remote status requested: %u"), mode); // right now just one mode
-    sendStatus();
-    return;
-  }
-
-  if (!strcmp(command, commandLog))
+  case CMD_FD:
+    return radio.remote_fd(payload, length);
+  // GOD MODE  With great power comes great responsibility!
+  case CMD_SPI_READ_REGISTER:
+    return radio.remote_SPIreadRegister(payload, length);
+  // SPIsetRegValue  (only sx1278) [1,2,3,4,5]
+  case CMD_SPI_SET_REG_VALUE:
+    return radio.remote_SPIsetRegValue(payload, length);
+  // SPIwriteRegister  (only sx1278) [1,2]
+  case CMD_SPI_WRITE_REGISTER:
+    radio.remote_SPIwriteRegister(payload, length);
+    return 0;
+  case CMD_ALDRO:
+    return radio.remote_aldro(payload, length);
+  case CMD_BATCH_CONF:
+    return remoteBatchConf(payload, length);
+  // Remote_Begin_FSK [433.5,100.0,10.0,250.0,10,100,16,0,0]
+  case CMD_BEGIN_FSK:
+    return radio.remote_begin_fsk(payload, length);
+  // Remote_Begin_Lora [437.7,125.0,11,8,18,11,120,8,0]
+  case CMD_BEGIN_LORA:
+    return radio.remote_begin_lora(payload, length);
+  case CMD_BEGINE:
+    return remoteBegine(payload, length);
+  case CMD_BEGINP:
+    return remoteBeginp(payload, length);
+  case CMD_BR:
+    return radio.remote_br(payload, length);
+  case CMD_BW:
+    return radio.remote_bw(payload, length);
+  case CMD_CR:
+    return radio.remote_cr(payload, length);
+  case CMD_CRC:
+    return radio.remote_crc(payload, length);
+  // Satellite_Decoder [46276,1] or [[46276,1],[51658,2]]   (NORAD,decoder), kept in flash
+  case CMD_DEC:
+    return remoteSatDecoder(payload, length);
+  case CMD_FBW:
+    return radio.remote_fbw(payload, length);
+  // Satellite_Filter [1,0,51]   (lenght,position,byte1,byte2,byte3,byte4)
+  case CMD_FILTER:
+    remoteSatFilter(payload, length);
+    return 0;
+  case CMD_FLDRO:
+    return radio.remote_fldro(payload, length);
+  // Set frequency offset
+  case CMD_FOFF:
+    if (length < 1)
+      return COMMAND_NO_ACK;
+    return radio.remoteSetFreqOffset(payload, length);
+  // Remote_FSK_Set_OOK + DataShapingOOK(only sx1278) [1,2]
+  case CMD_FOK:
+    return radio.remote_fook(payload, length);
+  case CMD_FRAME:
+    return remoteFrame(payload, length);
+  case CMD_FREQ:
+    return radio.remote_freq(payload, length);
+  // Remote_FSK_syncword [8,1,2,3,4,5,6,7,8,9]
+  case CMD_FSW:
+    return radio.remote_fsw(payload, length);
+  case CMD_GET_ADV_PRM:
+    sendAdvParameters();
+    return COMMAND_NO_ACK;
+  case CMD_LOG:
   {
     char logStr[length + 1];
     memcpy(logStr, payload, length);
     logStr[length] = '\0';
     Log::console(PSTR("%s"), logStr);
-    return; // do not send ack for this one
-  }
-
-  if (!strcmp(command, commandTx))
-  {
-    result = radio.sendTx(payload, length);
-    Log::console(PSTR("Sending TX packet!"));
+    return COMMAND_NO_ACK;
   }
-
-  // ######################################################
-  // ############## Remote tune commands ##################
-  // ######################################################
-  if (global)
-    return;
-
-  if (!strcmp(command, commandBeginp))
+  // Remote_LoRa_syncword [8,1,2,3,4,5,6,7,8,9]
+  case CMD_LSW:
+    return radio.remote_lsw(payload, length);
+  // RX latency histograms on stat/perf, "reset" clears them after sending
+  case CMD_PERF:
+#if PERF_STATS
+    sendPerf();
+    if (length == 5 && !memcmp(payload, "reset", 5))
+      Perf::getInstance().reset();
+    return COMMAND_NO_ACK;
+#else
+    return COMMAND_UNKNOWN;
+#endif
+  case CMD_PL:
+    return radio.remote_pl(payload, length);
+  case CMD_RESET:
+    ESP.restart();
+    return COMMAND_NO_ACK;
+  // Binary RX uplink, RxBinary.h version to use or 0 to go back to JSON [1]
+  case CMD_RXB:
+    return remoteRxBinary(payload, length);
+  // Remote_Satellite_Name [\"FossaSat-3\" , 46494 ]
+  case CMD_SAT:
+    remoteSatCmnd(payload, length);
+    return 0;
+  case CMD_SAT_POS_OLED:
+    manageSatPosOled(payload, length);
+    return COMMAND_NO_ACK;
+  case CMD_SET_ADV_PRM:
   {
     char buff[length + 1];
     memcpy(buff, payload, length);
     buff[length] = '\0';
     Log::debug(PSTR("%s"), buff);
-
-    size_t size = JSON_ARRAY_SIZE(10) + 10 * JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(16) + JSON_ARRAY_SIZE(8) + JSON_ARRAY_SIZE(8) + 64;
-    DynamicJsonDocument doc(size);
-    DeserializationError error = deserializeJson(doc, payload, length);
-
-    if (error.code() != DeserializationError::Ok || !doc.containsKey("mode"))
-    {
-      Log::console(PSTR("ERROR: Your modem config is invalid. Resetting to default"));
-      return;
-    }
-
-    // check frequecy is valid prior to load 
-    board_t board;
-    if (!ConfigManager::getInstance().getBoardConfig(board))
-      return; 
-    
-    if (!isValidFrequency(board.L_radio, doc["freq"]))
-    {
-      Log::console(PSTR("ERROR: Wrong frequency. Ignoring."));
-      return;
-    }
-
-    ConfigManager::getInstance().setModemStartup(buff);
+    ConfigManager::getInstance().setAvancedConfig(buff);
+    return 0;
   }
-
-  if (!strcmp(command, commandBegine))
+  case CMD_SF:
+    return radio.remote_sf(payload, length);
+  // Send station to lightsleep (siesta) x seconds
+  case CMD_SIESTA:
+    if (length < 1)
+      return COMMAND_NO_ACK;
+    remoteGoToSiesta(payload, length);
+    return 0;
+  // Send station to deepsleep x seconds
+  case CMD_SLEEP:
+    if (length < 1)
+      return COMMAND_NO_ACK;
+    remoteGoToSleep(payload, length);
+    return 0;
+  case CMD_STATUS:
   {
-    size_t size = JSON_ARRAY_SIZE(10) + 10 * JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(16) + JSON_ARRAY_SIZE(8) + JSON_ARRAY_SIZE(8) + 64;
-    DynamicJsonDocument doc(size);
-    DeserializationError error = deserializeJson(doc, payload, length);
-
-    if (error.code() != DeserializationError::Ok || !doc.containsKey("mode"))
-    {
-      Log::console(PSTR("ERROR: The received modem configuration is invalid. Ignoring."));
-      return;
-    }
-
-    // check frequecy is valid prior to load  
-    board_t board;
-    if (!ConfigManager::getInstance().getBoardConfig(board))
-      return; 
-    
-    if (!isValidFrequency(board.L_radio, doc["freq"]))
-    {
-      Log::console(PSTR("ERROR: Wrong frequency. Ignoring."));
-      return;
-    }
-   
-    ModemInfo &m = status.modeminfo;
-    m.modem_mode = doc["mode"].as<String>();
-    strcpy(m.satellite, doc["sat"].as<char *>());
-    m.NORAD = doc["NORAD"];
-
-  
-    if (m.modem_mode == "LoRa")
-    {
-      m.frequency = doc["freq"];
-      m.bw = doc["bw"];
-      m.sf = doc["sf"];
-      m.cr = doc["cr"];
-      m.sw = doc["sw"];
-      m.power = doc["pwr"];
-      m.preambleLength = doc["pl"];
-      m.gain = doc["gain"];
-      m.crc = doc["crc"];
-      m.fldro = doc["fldro"];
-    }
-    else
-    {
-      m.frequency = doc["freq"];
-      m.bw = doc["bw"];
-      m.bitrate = doc["br"];
-      m.freqDev = doc["fd"];
-      m.power = doc["pwr"];
-      m.preambleLength = doc["pl"];
-      m.OOK = doc["ook"];
-      m.len = doc["len"];
-      m.swSize = doc["fsw"].size();
-      for (int i = 0; i < 8; i++)
-      {
-        if (i < m.swSize)
-          m.fsw[i] = doc["fsw"][i];
-        else
-          m.fsw[i] = 0;
-      }
-      m.enc= doc["enc"];
-    }
-
-    // packets Filter
-    uint8_t filterSize = doc["filter"].size();
-    for (int i = 0; i < 8; i++)
-    {
-      if (i < filterSize)
-        status.modeminfo.filter[i] = doc["filter"][i];
-      else
-        status.modeminfo.filter[i] = 0;
-    }
-
-    radio.begin();
-//    radio.currentRssi();
-    result = 0;
+    uint8_t mode = length ? payload[0] - '0' : 0;
+    Log::debug(PSTR("Remote status requested: %u"), mode); // right now just one mode
+    sendStatus();
+    return COMMAND_NO_ACK;
   }
+  case CMD_TX:
+  {
+    int16_t result = radio.sendTx((uint8_t *)payload, length);
+    Log::console(PSTR("Sending TX packet!"));
+    return result;
+  }
+  case CMD_UPDATE:
+    OTA::update();
+    return COMMAND_NO_ACK;
+  case CMD_COUNT:
+    break;
+  }
+  return COMMAND_UNKNOWN;
+}
 
-  // Remote_Begin_Lora [437.7,125.0,11,8,18,11,120,8,0]
-  if (!strcmp(command, commandBeginLora))
-    result = radio.remote_begin_lora((char *)payload, length);
-
-  // Remote_Begin_FSK [433.5,100.0,10.0,250.0,10,100,16,0,0]
-  if (!strcmp(command, commandBeginFSK))
-    result = radio.remote_begin_fsk((char *)payload, length);
-
-  if (!strcmp(command, commandFreq))
-    result = radio.remote_freq((char *)payload, length);
-
-  if (!strcmp(command, commandBw))
-    result = radio.remote_bw((char *)payload, length);
-
-  if (!strcmp(command, commandSf))
-    result = radio.remote_sf((char *)payload, length);
-
-  if (!strcmp(command, commandCr))
-    result = radio.remote_cr((char *)payload, length);
-
-  if (!strcmp(command, commandCrc))
-    result = radio.remote_crc((char *)payload, length);
-
-  // Remote_LoRa_syncword [8,1,2,3,4,5,6,7,8,9]
-  if (!strcmp(command, commandLsw))
-    result = radio.remote_lsw((char *)payload, length);
-
-  if (!strcmp(command, commandFldro))
-    result = radio.remote_fldro((char *)payload, length);
-
-  if (!strcmp(command, commandAldro))
-    result = radio.remote_aldro((char *)payload, length);
+void MQTT_Client::manageMQTTData(char *topic, uint8_t *payload, unsigned int length)
+{
+  char ackTopic[MQTT_TOPIC_SIZE];
+  uint16_t ack;
+  // cmnd/<radio>/<command> addresses the radios after the first one
+  bool sendAck = dispatchCommand(topic, Radio::count(), [&](const CommandInfo &cmd, uint8_t radio) -> int32_t {
+    cmdRadio = radio;
+    return runCommand(cmd.handler, (char *)payload, length);
+  }, ackTopic, sizeof(ackTopic), ack);
+
+  if (sendAck)
+    publish(buildTopic(TOPIC_STAT, ackTopic), (uint8_t *)&ack, 2U, false);
+}
 
-  if (!strcmp(command, commandPl))
-    result = radio.remote_pl((char *)payload, length);
+int32_t MQTT_Client::remoteFrame(char *payload, size_t payload_len)
+{
+  uint8_t frameNumber = atoi(strtok(NULL, "/")); // follows the command in the topic
+  DynamicJsonDocument doc(JSON_ARRAY_SIZE(5) * 15 + JSON_ARRAY_SIZE(15));
+  deserializeJson(doc, payload, payload_len);
+  status.remoteTextFrameLength[frameNumber] = doc.size();
+  Log::debug(PSTR("Received frame: %u"), status.remoteTextFrameLength[frameNumber]);
 
-  if (!strcmp(command, commandBr))
-    result = radio.remote_br((char *)payload, length);
+  for (uint8_t n = 0; n < status.remoteTextFrameLength[frameNumber]; n++)
+  {
+    status.remoteTextFrame[frameNumber][n].text_font = doc[n][0];
+    status.remoteTextFrame[frameNumber][n].text_alignment = doc[n][1];
+    status.remoteTextFrame[frameNumber][n].text_pos_x = doc[n][2];
+    status.remoteTextFrame[frameNumber][n].text_pos_y = doc[n][3];
+    String text = doc[n][4];
+    status.remoteTextFrame[frameNumber][n].text = text;
+
+    Log::debug(PSTR("Text: %u Font: %u Alig: %u Pos x: %u Pos y: %u -> %s"), n,
+               status.remoteTextFrame[frameNumber][n].text_font,
+               status.remoteTextFrame[frameNumber][n].text_alignment,
+               status.remoteTextFrame[frameNumber][n].text_pos_x,
+               status.remoteTextFrame[frameNumber][n].text_pos_y,
+               status.remoteTextFrame[frameNumber][n].text.c_str());
+  }
 
-  if (!strcmp(command, commandFd))
-    result = radio.remote_fd((char *)payload, length);
+  return 0;
+}
 
-  if (!strcmp(command, commandFbw))
-    result = radio.remote_fbw((char *)payload, length);
+int32_t MQTT_Client::remoteBeginp(char *payload, size_t payload_len)
+{
+  // only the modem of the first radio is kept across reboots
+  if (cmdRadio)
+    return remoteBegine(payload, payload_len);
 
-  // Remote_FSK_syncword [8,1,2,3,4,5,6,7,8,9]
-  if (!strcmp(command, commandFsw))
-    result = radio.remote_fsw((char *)payload, length);
+  char buff[payload_len + 1];
+  memcpy(buff, payload, payload_len);
+  buff[payload_len] = '\0';
+  Log::debug(PSTR("%s"), buff);
 
-  // Remote_FSK_Set_OOK + DataShapingOOK(only sx1278) [1,2]
-  if (!strcmp(command, commandFook))
-    result = radio.remote_fook((char *)payload, length);
+  size_t size = JSON_ARRAY_SIZE(10) + 10 * JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(20) + JSON_ARRAY_SIZE(8) + JSON_ARRAY_SIZE(8) + 64;
+  DynamicJsonDocument doc(size);
+  DeserializationError error = deserializeJson(doc, payload, payload_len);
 
-  // Remote_Satellite_Name [\"FossaSat-3\" , 46494 ]
-  if (!strcmp(command, commandSat))
+  if (error.code() != DeserializationError::Ok || !doc.containsKey("mode"))
   {
-    remoteSatCmnd((char *)payload, length);
-    result = 0;
+    Log::console(PSTR("ERROR: Your modem config is invalid. Resetting to default"));
+    return COMMAND_NO_ACK;
   }
 
-  // Satellite_Filter [1,0,51]   (lenght,position,byte1,byte2,byte3,byte4)
-  if (!strcmp(command, commandSatFilter))
-  {
-    remoteSatFilter((char *)payload, length);
-    result = 0;
-  }
+  // check frequecy is valid prior to load 
+  board_t board;
+  if (!ConfigManager::getInstance().getBoardConfig(board))
+    return COMMAND_NO_ACK;
 
-  // Send station to lightsleep (siesta) x seconds
-  if (!strcmp(command, commandGoToSiesta))
+  if (!isValidFrequency(board.L_radio, doc["freq"]))
   {
-    if (length < 1)
-      return;
-    remoteGoToSiesta((char *)payload, length);
-    result = 0;
+    Log::console(PSTR("ERROR: Wrong frequency. Ignoring."));
+    return COMMAND_NO_ACK;
   }
 
- // Send station to deepsleep x seconds
-  if (!strcmp(command, commandGoToSleep))
-  {
-    if (length < 1)
-      return;
-    remoteGoToSleep((char *)payload, length);
-    result = 0;
-  }
+  ConfigManager::getInstance().setModemStartup(buff);
+  return 0;
+}
 
-  // Set frequency offset
-  if (!strcmp(command, commandSetFreqOffset))
-  {
-    if (length < 1)
-      return;
-    result = radio.remoteSetFreqOffset((char *)payload, length);
-  
-  }
+int32_t MQTT_Client::remoteBegine(char *payload, size_t payload_len)
+{
+  size_t size = JSON_ARRAY_SIZE(10) + 10 * JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(20) + JSON_ARRAY_SIZE(8) + JSON_ARRAY_SIZE(8) + 64;
+  DynamicJsonDocument doc(size);
+  DeserializationError error = deserializeJson(doc, payload, payload_len);
 
-  if (!strcmp(command, commandSetAdvParameters))
+  if (error.code() != DeserializationError::Ok || !doc.containsKey("mode"))
   {
-    char buff[length + 1];
-    memcpy(buff, payload, length);
-    buff[length] = '\0';
-    Log::debug(PSTR("%s"), buff);
-    ConfigManager::getInstance().setAvancedConfig(buff);
+    Log::console(PSTR("ERROR: The received modem configuration is invalid. Ignoring."));
+    return COMMAND_NO_ACK;
   }
 
-  if (!strcmp(command, commandGetAdvParameters))
+  // check frequecy is valid prior to load  
+  board_t board;
+  if (!ConfigManager::getInstance().getRadioConfig(cmdRadio, board))
+    return COMMAND_NO_ACK;
+
+  if (!isValidFrequency(board.L_radio, doc["freq"]))
   {
-    sendAdvParameters();
-    return;
+    Log::console(PSTR("ERROR: Wrong frequency. Ignoring."));
+    return COMMAND_NO_ACK;
   }
 
-  // GOD MODE  With great power comes great responsibility!
-  // SPIsetRegValue  (only sx1278) [1,2,3,4,5]
-  if (!strcmp(command, commandSPIsetRegValue))
-    result = radio.remote_SPIsetRegValue((char *)payload, length);
+  Radio &radio = Radio::getInstance(cmdRadio);
+  ModemInfo &m = radio.getModem();
+  m.modem_mode = doc["mode"].as<String>();
+  strcpy(m.satellite, doc["sat"].as<char *>());
+  m.NORAD = doc["NORAD"];
+  if (doc.containsKey("dec"))
+    Satellites::setDecoder(m.NORAD, doc["dec"]);
 
-  // SPIwriteRegister  (only sx1278) [1,2]
-  if (!strcmp(command, commandSPIwriteRegister))
+
+  if (m.modem_mode == "LoRa")
   {
-    radio.remote_SPIwriteRegister((char *)payload, length);
-    result = 0;
+    m.frequency = doc["freq"];
+    m.bw = doc["bw"];
+    m.sf = doc["sf"];
+    m.cr = doc["cr"];
+    m.sw = doc["sw"];
+    m.power = doc["pwr"];
+    m.preambleLength = doc["pl"];
+    m.gain = doc["gain"];
+    m.crc = doc["crc"];
+    m.fldro = doc["fldro"];
   }
-
-  if (!strcmp(command, commandSPIreadRegister) && !global)
-    result = radio.remote_SPIreadRegister((char *)payload, length);
-
-  if (!strcmp(command, commandBatchConf))
+  else
   {
-    Log::debug(PSTR("BatchConfig"));
-    DynamicJsonDocument doc(2048);
-    deserializeJson(doc, payload, length);
-    JsonObject root = doc.as<JsonObject>();
-    result = 0;
-
-    for (JsonPair kv : root)
+    m.frequency = doc["freq"];
+    m.bw = doc["bw"];
+    m.bitrate = doc["br"];
+    m.freqDev = doc["fd"];
+    m.power = doc["pwr"];
+    m.preambleLength = doc["pl"];
+    m.OOK = doc["ook"];
+    m.len = doc["len"];
+    m.swSize = doc["fsw"].size();
+    for (int i = 0; i < 8; i++)
     {
-      const char *key = kv.key().c_str();
-      char *value = (char *)kv.value().as<char *>();
-      size_t len = strlen(value);
-      Log::debug(PSTR("%s %s %u"), key, value, len);
-
-      if (!strcmp(key, commandCrc))
-        result = radio.remote_crc(value, len);
-
-      else if (!strcmp(key, commandFreq))
-        result = radio.remote_freq(value, len);
-
-      else if (!strcmp(key, commandBeginLora))
-        result = radio.remote_begin_lora(value, len);
-
-      else if (!strcmp(key, commandBw))
-        result = radio.remote_bw(value, len);
-
-      else if (!strcmp(key, commandSf))
-        result = radio.remote_sf(value, len);
-
-      else if (!strcmp(key, commandLsw))
-        result = radio.remote_lsw(value, len);
-
-      else if (!strcmp(key, commandFldro))
-        result = radio.remote_fldro(value, len);
-
-      else if (!strcmp(key, commandAldro))
-        result = radio.remote_aldro(value, len);
-
-      else if (!strcmp(key, commandPl))
-        result = radio.remote_pl(value, len);
-
-      else if (!strcmp(key, commandBeginFSK))
-        result = radio.remote_begin_fsk(value, len);
-
-      else if (!strcmp(key, commandBr))
-        result = radio.remote_br(value, len);
-
-      else if (!strcmp(key, commandFd))
-        result = radio.remote_fd(value, len);
-
-      else if (!strcmp(key, commandFbw))
-        result = radio.remote_fbw(value, len);
-
-      else if (!strcmp(key, commandFsw))
-        result = radio.remote_fsw(value, len);
+      if (i < m.swSize)
+        m.fsw[i] = doc["fsw"][i];
+      else
+        m.fsw[i] = 0;
+    }
+    m.enc= doc["enc"];
+    m.fec = doc["fec"] | 0;
+    m.rsDepth = doc["rsI"] | 1;
+  }
 
-      else if (!strcmp(key, commandFook))
-        result = radio.remote_fook(value, len);
+  // packets Filter
+  uint8_t filterSize = doc["filter"].size();
+  for (int i = 0; i < 8; i++)
+  {
+    if (i < filterSize)
+      m.filter[i] = doc["filter"][i];
+    else
+      m.filter[i] = 0;
+  }
 
-      else if (!strcmp(key, commandSat))
-        remoteSatCmnd(value, len);
+  radio.begin();
+//    radio.currentRssi();
+  return 0;
+}
 
-      else if (!strcmp(key, commandSatFilter))
-        remoteSatFilter(value, len);
+int32_t MQTT_Client::remoteBatchConf(char *payload, size_t payload_len)
+{
+  Log::debug(PSTR("BatchConfig"));
+  DynamicJsonDocument doc(2048);
+  deserializeJson(doc, payload, payload_len);
+  JsonObject root = doc.as<JsonObject>();
+  int32_t result = 0;
 
-      else if (!strcmp(key, commandSPIsetRegValue))
-        result = radio.remote_SPIsetRegValue(value, len);
+  for (JsonPair kv : root)
+  {
+    const char *key = kv.key().c_str();
+    char *value = (char *)kv.value().as<char *>();
+    size_t len = strlen(value);
+    Log::debug(PSTR("%s %s %u"), key, value, len);
 
-      else if (!strcmp(key, commandSPIwriteRegister))
-        radio.remote_SPIwriteRegister(value, len);
+    const CommandInfo *cmd = findBatchCommand(key);
+    if (cmd)
+      result = runCommand(cmd->handler, value, len);
 
-      if (result) // there was an error
-      {
-        Log::debug(PSTR("Error ocurred during batch config!!"));
-        break;
-      }
+    if (result) // there was an error
+    {
+      Log::debug(PSTR("Error ocurred during batch config!!"));
+      break;
     }
   }
 
-  if (!global)
-    publish(buildTopic(statTopic, command).c_str(), (uint8_t *)&result, 2U, false);
+  return result;
 }
 
 void MQTT_Client::manageSatPosOled(char *payload, size_t payload_len)
@@ -750,44 +915,89 @@ void MQTT_Client::manageSatPosOled(char *payload, size_t payload_len)
 
 void MQTT_Client::remoteSatCmnd(char *payload, size_t payload_len)
 {
+  ModemInfo &m = Radio::getInstance(cmdRadio).getModem();
   DynamicJsonDocument doc(256);
   deserializeJson(doc, payload, payload_len);
-  strcpy(status.modeminfo.satellite, doc[0]);
+  strcpy(m.satellite, doc[0]);
   uint32_t NORAD = doc[1];
-  status.modeminfo.NORAD = NORAD;
+  m.NORAD = NORAD;
 
-  Log::debug(PSTR("Listening Satellite: %s NORAD: %u"), status.modeminfo.satellite, NORAD);
+  Log::debug(PSTR("Listening Satellite: %s NORAD: %u"), m.satellite, NORAD);
 }
 
 void MQTT_Client::remoteSatFilter(char *payload, size_t payload_len)
 {
+  ModemInfo &m = Radio::getInstance(cmdRadio).getModem();
   DynamicJsonDocument doc(256);
   deserializeJson(doc, payload, payload_len);
   uint8_t filter_size = doc.size();
 
-  status.modeminfo.filter[0] = doc[0];
-  status.modeminfo.filter[1] = doc[1];
+  m.filter[0] = doc[0];
+  m.filter[1] = doc[1];
 
-  Log::debug(PSTR("Set Sat Filter Size %d"), status.modeminfo.filter[0]);
-  Log::debug(PSTR("Set Sat Filter POS  %d"), status.modeminfo.filter[1]);
+  Log::debug(PSTR("Set Sat Filter Size %d"), m.filter[0]);
+  Log::debug(PSTR("Set Sat Filter POS  %d"), m.filter[1]);
   Log::debug(PSTR("-> "));
   for (uint8_t filter_pos = 2; filter_pos < filter_size; filter_pos++)
   {
-    status.modeminfo.filter[filter_pos] = doc[filter_pos];
-    Log::debug(PSTR(" 0x%x  ,"), status.modeminfo.filter[filter_pos]);
+    m.filter[filter_pos] = doc[filter_pos];
+    Log::debug(PSTR(" 0x%x  ,"), m.filter[filter_pos]);
   }
   Log::debug(PSTR("Sat packets Filter enabled"));
 }
 
+int16_t MQTT_Client::remoteSatDecoder(char *payload, size_t payload_len)
+{
+  DynamicJsonDocument doc(JSON_ARRAY_SIZE(SATELLITES_MAX) + SATELLITES_MAX * JSON_ARRAY_SIZE(2));
+  if (deserializeJson(doc, payload, payload_len) != DeserializationError::Ok)
+    return -1;
+
+  JsonArray list = doc.as<JsonArray>();
+  if (!list[0].is<JsonArray>())
+  {
+    // single entry
+    if (!Satellites::setDecoder(list[0], list[1]))
+      return -1;
+    Satellites::saveOverride(list[0], list[1]);
+    Log::debug(PSTR("Set Sat Decoder NORAD: %u decoder: %u"), (uint32_t)list[0], (uint8_t)list[1]);
+    return 0;
+  }
+
+  for (JsonArray entry : list)
+  {
+    if (!Satellites::setDecoder(entry[0], entry[1]))
+      return -1;
+    Satellites::saveOverride(entry[0], entry[1]);
+  }
+  Log::debug(PSTR("Sat Decoder registry: %u entries"), Satellites::size());
+  return 0;
+}
+
+int16_t MQTT_Client::remoteRxBinary(char *payload, size_t payload_len)
+{
+  StaticJsonDocument<JSON_ARRAY_SIZE(1)> doc;
+  if (deserializeJson(doc, payload, payload_len) != DeserializationError::Ok)
+    return -1;
+
+  // accepts both 1 and [1]
+  uint8_t version = doc.is<JsonArray>() ? doc[0].as<uint8_t>() : doc.as<uint8_t>();
+  if (version && version != RXB_VERSION)
+    return -1;
+
+  rxBinary = version;
+  Log::debug(PSTR("Binary RX uplink: %u"), rxBinary);
+  return 0;
+}
+
 void MQTT_Client::remoteGoToSleep(char *payload, size_t payload_len)
 {
-  Radio &radio = Radio::getInstance();
   DynamicJsonDocument doc(60);
   deserializeJson(doc, payload, payload_len);
 
   uint32_t sleep_seconds = doc[0];                        // max 
   //uint8_t  int_pin = doc [1];   // 99 no int pin
 
+  Journal::getInstance().flush();
   Log::debug(PSTR("deep_sleep_enter"));
   esp_sleep_enable_timer_wakeup( 1000000ULL * sleep_seconds); // using ULL  Unsigned Long long
   //esp_sleep_enable_ext0_wakeup(int_pin,0);
@@ -796,7 +1006,8 @@ void MQTT_Client::remoteGoToSleep(char *payload, size_t payload_len)
   WiFi.disconnect(true);
   delay(100);
   //  TODO: apagar OLED
-  radio.moduleSleep();
+  for (uint8_t i = 0; i < Radio::count(); i++)
+    Radio::getInstance(i).moduleSleep();
   esp_deep_sleep_start();
   delay(1000);   // shouldn't arrive here
 
@@ -866,6 +1077,8 @@ void MQTT_Client::begin()
   ConfigManager &configManager = ConfigManager::getInstance();
   setServer(configManager.getMqttServer(), configManager.getMqttPort());
   setCallback(manageMQTTDataCallback);
+  if (!commandTableSorted(commandTable, numCommands))
+    Log::error(PSTR("The MQTT command table is not sorted, some commands will be ignored"));
 }
 
 
@@ -26,6 +26,10 @@
 #include "../ConfigManager/ConfigManager.h"
 #include "../Status.h"
 #include <PubSubClient.h>
+#include "RxBinary.h"
+#include "CommandTable.h"
+#include <ArduinoJson.h>
+#include "../Perf/Perf.h"
 #if MQTT_MAX_PACKET_SIZE != 1000  && !PLATFORMIO
 #error "Using Arduino IDE is not recommended, please follow this guide https://github.com/G4lile0/tinyGS/wiki/Arduino-IDE or edit /PubSubClient/src/PubSubClient.h  and set #define MQTT_MAX_PACKET_SIZE 1000"
 #endif
@@ -36,6 +40,8 @@
 #include <WiFiClient.h>
 #endif
 
+#define MQTT_TOPIC_SIZE 112  // "tinygs/<user>/<station>/stat/" and the longest command
+
 extern Status status;
 
 class MQTT_Client : public PubSubClient {
@@ -48,11 +54,15 @@ public:
   void begin();
   void loop();
   void sendWelcome();
-  void sendRx(String packet, bool noisy);
+  void sendRx(uint8_t radio, const uint8_t* frame, size_t len, bool noisy);
   void manageMQTTData(char *topic, uint8_t *payload, unsigned int length);
   void sendStatus();
   void sendAdvParameters();
+#if PERF_STATS
+  void sendPerf();
+#endif
   void scheduleRestart() { scheduledRestart = true; };
+  void buildTopicPrefixes();
 
 protected:
 #ifdef SECURE_MQTT
@@ -64,80 +74,68 @@ protected:
 
 private:
   MQTT_Client();
-  String buildTopic(const char * baseTopic, const char * cmnd);
+  enum TopicBase : uint8_t { TOPIC_GLOBAL, TOPIC_CMND, TOPIC_TELE, TOPIC_STAT, TOPIC_BASES };
+  const char* buildTopic(TopicBase base, const char * cmnd);
   void subscribeToAll();
   void manageSatPosOled(char* payload, size_t payload_len);
   void remoteSatCmnd(char* payload, size_t payload_len);
   void remoteSatFilter(char* payload, size_t payload_len);
+  int16_t remoteSatDecoder(char* payload, size_t payload_len);
+  int16_t remoteRxBinary(char* payload, size_t payload_len);
+  bool publishJson(const char* topic, const JsonDocument& doc);
+  void sendStatus(uint8_t radio);
+  bool publishRx(const RxbHeader& hdr, const uint8_t* frame, size_t len, const char* satellite, const char* mode);
+  void sendBackfill();
   void remoteGoToSleep(char* payload, size_t payload_len);
   void remoteGoToSiesta(char* payload, size_t payload_len);
+  int32_t remoteFrame(char* payload, size_t payload_len);
+  int32_t remoteBeginp(char* payload, size_t payload_len);
+  int32_t remoteBegine(char* payload, size_t payload_len);
+  int32_t remoteBatchConf(char* payload, size_t payload_len);
 
 
   int  voltage();
   
   bool usingNewCert = true;
   unsigned long lastPing = 0;
+  unsigned long lastBackfill = 0;
   unsigned long lastConnectionAtempt = 0;
   uint8_t connectionAtempts = 0;
   bool scheduledRestart = false;
+  uint8_t cmdRadio = 0;   // radio the command being handled is for
+  uint8_t rxBinary = 0;   // RxBinary.h version enabled by the server, 0 -> JSON on tele/rx
 
   const unsigned long pingInterval = 1 * 60 * 1000;
+  const unsigned long backfillInterval = 200;  // stored packets are sent at 5/s at most
   const unsigned long reconnectionInterval = 20 * 1000;
   const unsigned long randomTimeMin = 10 * 1000;
   const unsigned long randomTimeMax = 20 * 1000;
   unsigned long randomTime = 0;
   const uint16_t connectionTimeout = 6;
 
-  const char* globalTopic PROGMEM = "tinygs/global/%cmnd%";
-  const char* cmndTopic PROGMEM = "tinygs/%user%/%station%/cmnd/%cmnd%";
-  const char* teleTopic PROGMEM = "tinygs/%user%/%station%/tele/%cmnd%";
-  const char* statTopic PROGMEM = "tinygs/%user%/%station%/stat/%cmnd%";
+  // indexed by TopicBase, expanded with the user and the station name by buildTopicPrefixes()
+  const char* topicBases[TOPIC_BASES] PROGMEM = {
+    "tinygs/global/",
+    "tinygs/%s/%s/cmnd/",
+    "tinygs/%s/%s/tele/",
+    "tinygs/%s/%s/stat/"
+  };
+  char topicPrefix[TOPIC_BASES][MQTT_TOPIC_SIZE];
+  uint8_t topicPrefixLen[TOPIC_BASES] = {};
+  char topic[MQTT_TOPIC_SIZE];  // last topic returned by buildTopic()
 
   // tele
   const char* topicWelcome PROGMEM = "welcome";
   const char* topicPing PROGMEM= "ping";
   const char* topicStatus PROGMEM = "status";
   const char* topicRx PROGMEM= "rx";
+  const char* topicRxBin PROGMEM= "rxb";
   const char* topicGet_adv_prm PROGMEM = "get_adv_prm";
+  const char* topicPerf PROGMEM = "perf";
 
-  // command
-  const char* commandBatchConf PROGMEM= "batch_conf";
-  const char* commandUpdate PROGMEM= "update";
-  const char* commandSatPos PROGMEM= "sat_pos_oled";
-  const char* commandReset PROGMEM= "reset";
-  const char* commandFreq PROGMEM= "freq";
-  const char* commandBw PROGMEM= "bw";
-  const char* commandSf PROGMEM= "sf";
-  const char* commandCr PROGMEM= "cr";
-  const char* commandCrc PROGMEM= "crc";
-  const char* commandLsw PROGMEM= "lsw";
-  const char* commandFldro PROGMEM= "fldro";
-  const char* commandAldro PROGMEM= "aldro";
-  const char* commandPl PROGMEM= "pl";
-  const char* commandBegine PROGMEM= "begine";
-  const char* commandBeginp PROGMEM= "beginp";
-  const char* commandBeginLora PROGMEM= "begin_lora";
-  const char* commandBeginFSK PROGMEM= "begin_fsk";
-  const char* commandBr PROGMEM= "br";
-  const char* commandFd PROGMEM= "Fd";
-  const char* commandFbw PROGMEM= "fbw";
-  const char* commandFsw PROGMEM= "fsw";
-  const char* commandFook PROGMEM= "fok";
-  const char* commandFrame PROGMEM= "frame";
-  const char* commandSat PROGMEM= "sat";
-  const char* commandStatus PROGMEM= "status";
-  const char* commandLog PROGMEM= "log";
-  const char* commandTx PROGMEM= "tx";
-  const char* commandSatFilter PROGMEM= "filter";
-  const char* commandGoToSleep PROGMEM= "sleep";
-  const char* commandGoToSiesta PROGMEM= "siesta";
-  const char* commandSetFreqOffset PROGMEM= "foff";
-  const char* commandSetAdvParameters PROGMEM= "set_adv_prm";
-  const char* commandGetAdvParameters PROGMEM= "get_adv_prm";
-    // GOD MODE  With great power comes great responsibility!
-  const char* commandSPIsetRegValue PROGMEM= "SPIsetRegValue";
-  const char* commandSPIwriteRegister PROGMEM= "SPIwriteRegister";
-  const char* commandSPIreadRegister PROGMEM= "SPIreadRegister";
+  // Remote commands, received on cmnd/<name> and global/<name> and listed in
+  // CommandTable.cpp. Returns the result sent back on stat/<name>, or COMMAND_NO_ACK.
+  int32_t runCommand(CommandId id, char* payload, size_t length);
 };
 
 #endif
\ No newline at end of file
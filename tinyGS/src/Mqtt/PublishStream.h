@@ -0,0 +1,80 @@
+/*
+  PublishStream.h - Print adaptor that streams an MQTT publish payload
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef PUBLISH_STREAM_H
+#define PUBLISH_STREAM_H
+
+#include <Print.h>
+
+#define PUBLISH_CHUNK_SIZE 256
+
+// Collects the payload of a message opened with beginPublish() and hands
+// it to the client in PUBLISH_CHUNK_SIZE pieces. ArduinoJson writes most of
+// the output one character at a time and every write to the TLS client is
+// a record of its own, so writing to the client directly would be very slow.
+class PublishStream : public Print {
+public:
+  PublishStream(Print& client) : client(client) {}
+
+  size_t write(uint8_t c) override
+  {
+    if (len == sizeof(chunk))
+      flush();
+    chunk[len++] = c;
+    return 1;
+  }
+
+  size_t write(const uint8_t* data, size_t size) override
+  {
+    if (len + size > sizeof(chunk))
+    {
+      flush();
+      if (size > sizeof(chunk))
+      {
+        sent += client.write(data, size);
+        return size;
+      }
+    }
+    memcpy(chunk + len, data, size);
+    len += size;
+    return size;
+  }
+
+  void flush() override
+  {
+    if (len)
+      sent += client.write(chunk, len);
+    len = 0;
+  }
+
+  // flushes and returns the number of bytes the client accepted
+  size_t end()
+  {
+    flush();
+    return sent;
+  }
+
+private:
+  Print& client;
+  uint8_t chunk[PUBLISH_CHUNK_SIZE];
+  size_t len = 0;
+  size_t sent = 0;
+};
+
+#endif
@@ -0,0 +1,124 @@
+/*
+  RxBinary.h - Compact binary uplink for received packets
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef RX_BINARY_H
+#define RX_BINARY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Message published on tele/rxb once the server enables it: a fixed
+// little endian header followed by the raw frame bytes. The station
+// advertises the newest version it speaks in the welcome message and keeps
+// sending JSON on tele/rx until the server answers with cmnd/rxb and the
+// version to send, from 1 to RXB_VERSION.
+// This header has no Arduino dependencies so the same encoder and
+// decoder build on the host, tools/rxb.py is the Python equivalent.
+
+#define RXB_VERSION 1
+#define RXB_TIME_ERROR_UNKNOWN 0xFFFFFFFF  // usecError when the clock was never synced
+
+enum RxbFlags : uint8_t {
+  RXB_CRC_ERROR = 0x01,
+  RXB_NOISY     = 0x02,
+  RXB_LORA      = 0x04,   // modem parameters are sf/cr/bw, otherwise bitrate/freqDev/bw
+  RXB_FEC       = 0x08,   // fecCorrected and fecBitErrors are valid
+  RXB_REPLAY    = 0x10,   // received while offline, sent from the journal
+};
+
+struct __attribute__((packed)) RxbHeader {
+  uint8_t  version;
+  uint8_t  flags;
+  uint8_t  headerLen;       // offset of the frame, later versions only append fields
+  uint8_t  sf;
+  uint32_t norad;
+  int64_t  usecTime;        // end of the sync word on the station clock, us since the epoch
+  float    timeOffset;
+  float    frequency;       // MHz
+  float    freqOffset;      // Hz
+  float    bw;              // kHz
+  float    bitrate;         // kbps
+  float    freqDev;         // kHz
+  float    rssi;
+  float    snr;
+  float    frequencyError;  // Hz
+  float    latitude;
+  float    longitude;
+  int16_t  fecCorrected;
+  uint8_t  cr;
+  uint8_t  radio;           // receiving radio of the station
+  uint32_t fecBitErrors;
+  uint16_t dataLen;
+  uint32_t usecError;       // error estimate of usecTime in us, RXB_TIME_ERROR_UNKNOWN if not synced
+};
+
+static_assert(sizeof(RxbHeader) == 74, "RxbHeader layout is part of the wire format");
+
+// Header bytes sent in a message of the given version, 0 if it is not supported
+static inline size_t rxbHeaderSize(uint8_t version)
+{
+  return version == RXB_VERSION ? sizeof(RxbHeader) : 0;
+}
+
+// Fills the version and length fields of a header sent right before a frame
+// of len bytes, in the version the server asked for. Only the first headerLen
+// bytes of hdr are sent.
+static inline bool rxbSetLength(RxbHeader &hdr, size_t len, uint8_t version = RXB_VERSION)
+{
+  size_t headerLen = rxbHeaderSize(version);
+  if (!headerLen || len > 0xFFFF)
+    return false;
+
+  hdr.version = version;
+  hdr.headerLen = headerLen;
+  hdr.dataLen = len;
+  return true;
+}
+
+// Writes header + frame to out, returns the message size or 0 if it does not fit
+static inline size_t rxbEncode(const RxbHeader &hdr, const uint8_t *data, size_t len, uint8_t *out, size_t outSize,
+                               uint8_t version = RXB_VERSION)
+{
+  RxbHeader h = hdr;
+  if (!rxbSetLength(h, len, version) || h.headerLen + len > outSize)
+    return 0;
+
+  memcpy(out, &h, h.headerLen);
+  memcpy(out + h.headerLen, data, len);
+  return h.headerLen + len;
+}
+
+// Parses a message, the fields a newer header appends are skipped.
+// data points inside msg. Returns false if the message is malformed.
+static inline bool rxbDecode(const uint8_t *msg, size_t msgLen, RxbHeader *hdr, const uint8_t **data)
+{
+  if (msgLen < sizeof(RxbHeader) || msg[0] == 0 || msg[2] < sizeof(RxbHeader) || msg[2] > msgLen)
+    return false;
+
+  size_t headerLen = msg[2];
+  memcpy(hdr, msg, sizeof(RxbHeader));
+  if (headerLen + hdr->dataLen > msgLen)
+    return false;
+
+  *data = msg + headerLen;
+  return true;
+}
+
+#endif
@@ -0,0 +1,99 @@
+/*
+  Perf.cpp - Latency histograms of the RX path
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Perf.h"
+
+#if PERF_STATS
+
+// stage names, [PERF_IRQ] is the whole path
+static const char *const stageNames[PERF_POINTS] = {"total", "read", "queue", "decode", "filter", "encode", "publish"};
+
+void Perf::start(uint32_t irq, uint32_t read)
+{
+  trace[PERF_IRQ] = irq;
+  trace[PERF_READ] = read;
+  trace[PERF_QUEUE] = (uint32_t)esp_timer_get_time();
+  marked = (1 << PERF_IRQ) | (1 << PERF_READ) | (1 << PERF_QUEUE);
+}
+
+void Perf::mark(PerfPoint point)
+{
+  if (!marked)
+    return; // not part of a traced frame, e.g. the journal backfill
+
+  trace[point] = (uint32_t)esp_timer_get_time();
+  marked |= 1 << point;
+}
+
+void Perf::end()
+{
+  if (!(marked & (1 << PERF_PUBLISH)))
+  {
+    marked = 0; // dropped before it was published
+    return;
+  }
+
+  // a skipped point (no decoder, no filter...) takes no time
+  for (uint8_t p = 1; p < PERF_POINTS; p++)
+  {
+    if (!(marked & (1 << p)))
+      trace[p] = trace[p - 1];
+    add(stages[p], trace[p] - trace[p - 1]);
+  }
+  add(stages[PERF_IRQ], trace[PERF_PUBLISH] - trace[PERF_IRQ]);
+  marked = 0;
+}
+
+void Perf::add(Histogram &h, uint32_t us)
+{
+  uint8_t bucket = us ? 31 - __builtin_clz(us) : 0;
+  if (bucket >= PERF_BUCKETS)
+    bucket = PERF_BUCKETS - 1;
+  h.buckets[bucket]++;
+  h.count++;
+  h.sum += us;
+  if (us > h.max)
+    h.max = us;
+}
+
+void Perf::reset()
+{
+  memset(stages, 0, sizeof(stages));
+}
+
+void Perf::toJson(JsonDocument &doc)
+{
+  doc["unit"] = "us";
+  for (uint8_t p = 0; p < PERF_POINTS; p++)
+  {
+    const Histogram &h = stages[p];
+    JsonObject stage = doc.createNestedObject(stageNames[p]);
+    stage["n"] = h.count;
+    stage["avg"] = h.count ? (uint32_t)(h.sum / h.count) : 0;
+    stage["max"] = h.max;
+    JsonArray buckets = stage.createNestedArray("h");
+    uint8_t used = PERF_BUCKETS;
+    while (used && !h.buckets[used - 1])
+      used--;
+    for (uint8_t i = 0; i < used; i++)
+      buckets.add(h.buckets[i]);
+  }
+}
+
+#endif
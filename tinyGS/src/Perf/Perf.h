@@ -0,0 +1,105 @@
+/*
+  Perf.h - Latency histograms of the RX path
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef PERF_H
+#define PERF_H
+
+// Build with -DPERF_STATS=0 to remove the instrumentation, the PERF_* macros
+// expand to nothing and the perf command and web API are left out
+#ifndef PERF_STATS
+#define PERF_STATS 1
+#endif
+
+#include <stdint.h>
+
+#define PERF_BUCKETS 21   // bucket i counts times in [2^i, 2^(i+1)) us, the last one has no upper bound
+
+// Points a received frame goes through, the stage named after a point is
+// the time from the previous point to it
+enum PerfPoint : uint8_t {
+  PERF_IRQ,       // DIO interrupt, Radio::setFlag()
+  PERF_READ,      // frame read out of the FIFO by the RX task
+  PERF_QUEUE,     // taken out of rxQueue by the loop
+  PERF_DECODE,    // FEC and line decoding done
+  PERF_FILTER,    // satellite filter passed
+  PERF_ENCODE,    // uplink message built
+  PERF_PUBLISH,   // message written to the MQTT connection
+  PERF_POINTS
+};
+
+#if PERF_STATS
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <esp_timer.h>
+
+#define PERF_READ_TIME(pkt)   ((pkt)->perfRead = (uint32_t)esp_timer_get_time())
+#define PERF_START(pkt)       Perf::getInstance().start((uint32_t)(pkt)->irqTime, (pkt)->perfRead)
+#define PERF_MARK(point)      Perf::getInstance().mark(point)
+#define PERF_END()            Perf::getInstance().end()
+
+// Follows one frame at a time from the radio interrupt to the end of its
+// publish and adds the time of every stage to a histogram. The interrupt and
+// FIFO read times travel with the packet through rxQueue, the rest is marked
+// by the loop while it processes the packet. Frames that are dropped,
+// filtered or stored in the journal are not counted. Times are microseconds
+// of esp_timer, which unlike the cycle counter is shared by both cores and
+// does not stop in light sleep. The interrupt time is the one Radio::setFlag()
+// latches for the packet timestamp.
+class Perf {
+public:
+  static Perf& getInstance()
+  {
+    static Perf instance;
+    return instance;
+  }
+
+  void start(uint32_t irq, uint32_t read);
+  void mark(PerfPoint point);
+  void end();
+  void reset();
+  void toJson(JsonDocument& doc);
+  static constexpr size_t jsonCapacity() { return JSON_OBJECT_SIZE(PERF_POINTS + 1) + PERF_POINTS * (JSON_OBJECT_SIZE(4) + JSON_ARRAY_SIZE(PERF_BUCKETS)); }
+
+private:
+  struct Histogram {
+    uint32_t count;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t buckets[PERF_BUCKETS];
+  };
+
+  Perf() {}
+  static void add(Histogram& h, uint32_t us);
+
+  Histogram stages[PERF_POINTS] = {};  // [PERF_IRQ] holds the total
+  uint32_t trace[PERF_POINTS];
+  uint8_t marked = 0;                  // bit per point set in trace, 0 -> no frame in flight
+};
+
+#else
+
+#define PERF_READ_TIME(pkt)   do {} while (0)
+#define PERF_START(pkt)       do {} while (0)
+#define PERF_MARK(point)      do {} while (0)
+#define PERF_END()            do {} while (0)
+
+#endif
+
+#endif
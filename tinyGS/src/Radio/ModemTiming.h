@@ -0,0 +1,109 @@
+/*
+  ModemTiming.h - On air time model of the active modem configuration
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef MODEM_TIMING_H
+#define MODEM_TIMING_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Time on air of a frame with the modem settings last applied, in us. The
+// settings are reduced to a few constants when they change so every query
+// is a handful of integer operations, whatever the frame length. Like
+// RxBinary.h this has no Arduino dependencies and builds on the host.
+class ModemTiming {
+public:
+  // Semtech SX1276 datasheet 4.1.1.7 and SX1268 datasheet 6.1.4. cr is
+  // 5..8, ldro 2 -> automatic (symbol longer than 16 ms). The implicit
+  // header mode saves the 20 bits of the header.
+  void setLoRa(float bw, uint8_t sf, uint8_t cr, uint8_t ldro, bool crc, uint16_t preambleLength, bool implicitHeader = false)
+  {
+    clear();
+    if (!sf || bw <= 0 || cr < 5)
+      return;
+
+    float symbol = (1UL << sf) * 1000.0f / bw;
+    bool lowRate = ldro == 2 ? symbol > 16000 : ldro;
+    lora = true;
+    symbolUs = symbol;
+    // SF5 and SF6 (sx126x only) have a longer sync word and a shorter header
+    preambleUs = (preambleLength + (sf < 7 ? 6.25f : 4.25f)) * symbol;
+    overheadBits = (sf < 7 ? 20 : 28) - 4 * sf + (crc ? 16 : 0) - (implicitHeader ? 20 : 0);
+    bitsPerBlock = 4 * (sf - (lowRate ? 2 : 0));
+    blockSymbols = cr;
+    byteUs = 8 * cr * symbol / bitsPerBlock;
+  }
+
+  // preambleLength in bits, syncWordSize in bytes, len 0 -> variable
+  // length mode with a length byte. Manchester sends two chips per bit of
+  // the payload (sx127x), the preamble and sync word are sent as they are.
+  void setFsk(float bitrate, uint16_t preambleLength, uint8_t syncWordSize, uint8_t len, bool manchester)
+  {
+    clear();
+    if (bitrate <= 0)
+      return;
+
+    float bit = 1000.0f / bitrate;
+    byteUs = 8 * bit * (manchester ? 2 : 1);
+    symbolUs = byteUs;
+    preambleUs = (preambleLength + 8 * syncWordSize) * bit;
+    lengthByte = len == 0;
+  }
+
+  void clear() { *this = ModemTiming(); }
+  bool valid() const { return symbolUs > 0; }
+  bool isLoRa() const { return lora; }
+
+  uint32_t symbol() const { return symbolUs; }       // LoRa symbol, FSK byte
+  uint32_t preamble() const { return preambleUs; }   // preamble and sync word
+  uint32_t perByte() const { return byteUs; }        // average per payload byte
+
+  // from the end of the sync word to the RxDone interrupt
+  uint32_t afterSync(size_t len) const
+  {
+    if (!lora)
+      return (lengthByte + len) * byteUs;
+
+    // header and payload go in blocks of cr symbols, the first 8 symbols
+    // are always sent at the reduced rate
+    int32_t bits = 8 * (int32_t)len + overheadBits;
+    int32_t blocks = bits > 0 ? (bits + bitsPerBlock - 1) / bitsPerBlock : 0;
+    return (8 + blocks * blockSymbols) * symbolUs;
+  }
+
+  uint32_t airtime(size_t len) const { return preambleUs + afterSync(len); }
+
+  // n payload bits after the sync word, FSK only
+  uint32_t bits(uint32_t n) const { return lora ? 0 : n * byteUs / 8; }
+
+  // how late the RxDone interrupt can come after the last bit
+  uint32_t resolution() const { return symbolUs; }
+
+private:
+  bool lora = false;
+  bool lengthByte = false;
+  float symbolUs = 0;
+  float preambleUs = 0;
+  float byteUs = 0;
+  int32_t overheadBits = 0;
+  int32_t bitsPerBlock = 1;
+  int32_t blockSymbols = 0;
+};
+
+#endif
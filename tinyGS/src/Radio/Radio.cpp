@@ -22,40 +22,96 @@
 #if ARDUINOJSON_USE_LONG_LONG == 0 && !PLATFORMIO
 #error "Using Arduino IDE is not recommended, please follow this guide https://github.com/G4lile0/tinyGS/wiki/Arduino-IDE or /ArduinoJson/src/ArduinoJson/Configuration.hpp and amend to #define ARDUINOJSON_USE_LONG_LONG 1 around line 68"
 #endif
-#include <base64.h>
 #include "../Logger/Logger.h"
+#include <esp_timer.h>
 
 //@estbhan
 //04/08/2023
 #include "../BitCode/BitCode.h"
 #include "../Satellites/Satellites.h"
+#include "../Fec/Fec.h"
 
 #define CHECK_ERROR(errCode) if (errCode != RADIOLIB_ERR_NONE) { Log::console(PSTR("Radio failed, code %d\n Check that the configuration is valid for your board"), errCode);status.radio_error=errCode; return errCode; }
 
-bool received = false;
-bool eInterrupt = true;
-bool noisyInterrupt = false;
-
 bool allow_decode=true;
 
-Radio::Radio()
+// Serialises access to the radio module between the RX task and the loop
+class RadioLock {
+public:
+  RadioLock(SemaphoreHandle_t l) : lock(l) { if (lock) xSemaphoreTakeRecursive(lock, portMAX_DELAY); }
+  ~RadioLock() { if (lock) xSemaphoreGiveRecursive(lock); }
+private:
+  SemaphoreHandle_t lock;
+};
+
+Radio* Radio::instances[MAX_RADIOS] = {};
+
+// RadioLib takes plain functions, one interrupt handler per instance
+template <uint8_t N>
+void IRAM_ATTR Radio::setFlag()
+{
+  instances[N]->interrupt();
+}
+
+void (*const Radio::irqHandlers[MAX_RADIOS])() = {
+  setFlag<0>,
+#if MAX_RADIOS > 1
+  setFlag<1>,
+#endif
+};
+static_assert(MAX_RADIOS <= 2, "add a setFlag<N> handler for each radio");
+
+// the first radio stays on the bus the boards always used, the second one gets the other
+Radio::Radio(uint8_t index)
+  : index(index),
+    modem(index ? ownModem : status.modeminfo),
+    lastPacket(index ? ownPacket : status.lastPacketInfo),
+    irqHandler(irqHandlers[index]),
 #if CONFIG_IDF_TARGET_ESP32S3
-  : spi(HSPI)
+    spi(index ? FSPI : HSPI)
 #elif CONFIG_IDF_TARGET_ESP32C3
-  : spi(SPI)  
+    spi(SPI)
 #else
-  : spi(VSPI)
+    spi(index ? HSPI : VSPI)
 #endif
 {
 }
 
+bool Radio::anyPending()
+{
+  for (uint8_t i = 0; i < count(); i++)
+    if (getInstance(i).rxPending())
+      return true;
+  return false;
+}
+
+// Automatic light sleep at the current CPU clock, without frequency scaling.
+// Needs an Arduino core built with power management and tickless idle.
+static esp_err_t enableLightSleep()
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+  esp_pm_config_esp32s3_t pm;
+#elif CONFIG_IDF_TARGET_ESP32C3
+  esp_pm_config_esp32c3_t pm;
+#else
+  esp_pm_config_esp32_t pm;
+#endif
+  pm.max_freq_mhz = getCpuFrequencyMhz();
+  pm.min_freq_mhz = getCpuFrequencyMhz();
+  pm.light_sleep_enable = true;
+  return esp_pm_configure(&pm);
+}
+
 void Radio::init()
 {
-  Power& power = Power::getInstance();
-  power.checkAXP();                                       // check and setup AXP192 and AXP2101 power controller
-  Log::console(PSTR("[SX12xx] Initializing ... "));
+  if (!index)
+  {
+    Power& power = Power::getInstance();
+    power.checkAXP();                                       // check and setup AXP192 and AXP2101 power controller
+  }
+  Log::console(PSTR("[SX12xx] Initializing radio %u ... "), index);
   board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!ConfigManager::getInstance().getRadioConfig(index, board))
     return;
 
   spi.begin(board.L_SCK, board.L_MISO, board.L_MOSI, board.L_NSS);
@@ -99,17 +155,36 @@ void Radio::init()
     Log::debug(PSTR("setRfSwitchPins(RxEn->GPIO-%d, TxEn->GPIO-%d)"), board.RX_EN, board.TX_EN);
   }
 
+  // the FIFO is drained by a dedicated task woken from the DIO ISR, so loop() latency
+  // (TLS publish, OLED refresh...) does not make us lose back to back frames
+  radioLock = xSemaphoreCreateRecursiveMutex();
+
+  // low power stations may light sleep while a CAD scan has the radio asleep,
+  // the lock keeps the CPU awake the rest of the time
+  if (ConfigManager::getInstance().getLowPower() && esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "radioRx", &pmLock) == ESP_OK)
+  {
+    esp_pm_lock_acquire(pmLock);
+    esp_err_t err = index ? ESP_OK : enableLightSleep();  // once for all the radios
+    if (err != ESP_OK)
+      Log::console(PSTR("Light sleep not available (%d), only the radio is duty cycled"), err);
+  }
+  char taskName[configMAX_TASK_NAME_LEN];
+  snprintf(taskName, sizeof(taskName), "radioRx%u", index);
+  xTaskCreatePinnedToCore(rxTask, taskName, RX_TASK_STACK, this, RX_TASK_PRIORITY, &rxTaskHandle, RX_TASK_CORE);
+
   begin();
 }
 
 int16_t Radio::begin()
 {
-  status.radio_ready = false;
+  ready = false;
   board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!ConfigManager::getInstance().getRadioConfig(index, board))
     return -1;
   
-  ModemInfo &m = status.modeminfo;
+  RadioLock lock(radioLock);
+  ModemInfo &m = modem;
+  rxMode = RX_CONTINUOUS; // setRxMode() picks it again once the modem is set up
 
   if (m.modem_mode == "LoRa")
   {
@@ -141,17 +216,18 @@ int16_t Radio::begin()
   // set the function that will be called
   // when new packet is received
   // attach the ISR to radio interrupt
-  radioHal->setDio0Action(setFlag);
+  radioHal->setDio0Action(irqHandler);
   // start listening for LoRa packets
   Log::console(PSTR("[%s] Starting to listen to %s"), moduleNameString, m.satellite);
   CHECK_ERROR(radioHal->startReceive());
-  status.modeminfo.currentRssi = radioHal->getRSSI(false,true);
+  modem.currentRssi = radioHal->getRSSI(false,true);
+  restartRx();
 
-  status.radio_ready = true;
+  ready = true;
   return RADIOLIB_ERR_NONE;
 }
 
-void Radio::setFlag()
+void IRAM_ATTR Radio::interrupt()
 {
   if (received || !eInterrupt)
     noisyInterrupt = true;
@@ -159,7 +235,78 @@ void Radio::setFlag()
   if (!eInterrupt)
     return;
 
+  if (!received)
+    irqTime = esp_timer_get_time();
   received = true;
+
+  BaseType_t higherPriorityTaskWoken = pdFALSE;
+  if (rxTaskHandle)
+    vTaskNotifyGiveFromISR(rxTaskHandle, &higherPriorityTaskWoken);
+  if (higherPriorityTaskWoken)
+    portYIELD_FROM_ISR();
+}
+
+void Radio::rxTask(void* param)
+{
+  Radio* radio = (Radio*)param;
+  for (;;)
+  {
+    bool irq = ulTaskNotifyTake(pdTRUE, radio->scanTimeout());
+    if (radio->rxMode == RX_CAD_SCAN)
+      radio->scanStep(irq);
+    else
+      radio->readPacket();
+  }
+}
+
+// Runs on the RX task: read the frame out of the radio as soon as possible and hand it
+// to the loop through its RX queue. Nothing here may log or touch the network.
+void Radio::readPacket()
+{
+  if (!received)
+    return;
+
+  RadioLock lock(radioLock);
+
+  // disable the interrupt service routine while
+  // reading the data
+  disableInterrupt();
+
+  // reset flag
+  received = false;
+
+  RxPacket *pkt = rx.prepare();
+  if (!pkt)
+  {
+    // the loop is not keeping up, drop this one but keep listening
+    startRx();
+    return;
+  }
+
+  // read received data
+  size_t len = radioHal->getPacketLength();
+  // workaround for radiolib FSX fixed packet definition returning always a size of 255bytes
+  if (len == 255) len = modem.len;
+  if (len > RX_FRAME_MAX_LEN) len = RX_FRAME_MAX_LEN;
+
+  pkt->len = len;
+  pkt->state = radioHal->readData(rx.data(pkt), len);
+  pkt->rssi = radioHal->getRSSI();
+  pkt->snr = radioHal->getSNR();
+  pkt->frequencyerror = radioHal->getFrequencyError();
+  pkt->noisy = noisyInterrupt;
+  noisyInterrupt = false;
+  PERF_READ_TIME(pkt);
+
+  // station clock at the interrupt, esp_timer does not jump when SNTP sets the clock
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  pkt->irqTime = irqTime;
+  pkt->usecTime = tv.tv_sec * 1000000ll + tv.tv_usec - (esp_timer_get_time() - irqTime);
+
+  // put module back to listen mode
+  startRx();
+  rx.commit();
 }
 
 void Radio::enableInterrupt()
@@ -175,7 +322,12 @@ void Radio::disableInterrupt()
 void Radio::startRx()
 {
   // put module back to listen mode
-  radioHal->startReceive();
+  if (rxMode == RX_SNIFF)
+    radioHal->startReceiveDutyCycle(dutyRxUs, dutySleepUs);
+  else if (rxMode == RX_CAD_SCAN)
+    startScan();
+  else
+    radioHal->startReceive();
 
   // we're ready to receive more packets,
   // enable interrupt service routine
@@ -185,8 +337,9 @@ void Radio::startRx()
 
  void Radio::currentRssi()
 {
+  RadioLock lock(radioLock);
   // get current RSSI
-  status.modeminfo.currentRssi = radioHal->getRSSI(false,true);
+  modem.currentRssi = radioHal->getRSSI(false,true);
 
 }
 
@@ -197,13 +350,15 @@ int16_t Radio::sendTx(uint8_t *data, size_t length)
     Log::error(PSTR("TX disabled by config"));
     return -1;
   }
+  RadioLock lock(radioLock);
   disableInterrupt();
 
   // send data
   int16_t state = 0;
 
+  Log::debug(PSTR("TX %u bytes, %u us on air"), length, timing.airtime(length));
   state = radioHal->transmit(data, length);
-  radioHal->setDio0Action(setFlag); // TODO: Check, is this needed?? include it inside startRX ??
+  radioHal->setDio0Action(irqHandler); // TODO: Check, is this needed?? include it inside startRX ??
   startRx();
 
   return state;
@@ -216,57 +371,62 @@ int16_t Radio::sendTestPacket()
 
 int16_t Radio::moduleSleep()
 {
+  RadioLock lock(radioLock);
   return radioHal->sleep();
 }
 
 uint8_t Radio::listen()
 {
-  // check if the flag is set (received interruption)
-  if (!received)
+  // frames left over from the last FSK capture go first, one per call
+  if (rx.deframer().available())
+    return publishHdlcFrame();
+
+  // check if the RX task queued a packet
+  RxPacket *pkt = rx.front();
+  if (!pkt)
     return 1;
 
-  // disable the interrupt service routine while
-  // processing the data
-  disableInterrupt();
+  PERF_START(pkt);
+  uint8_t ret = processPacket(pkt);
+  PERF_END();
 
-  // reset flag
-  received = false;
+  rx.pop();
 
-  size_t respLen = 0;
-  uint8_t *respFrame = 0;
-  int16_t state = 0;
+  return ret;
+}
 
-  PacketInfo newPacketInfo;
-  status.lastPacketInfo.crc_error = false;
-  // read received data
-  respLen = radioHal->getPacketLength();
-  // workaround for radiolib FSX fixed packet definition returning always a size of 255bytes
-  if (respLen == 255) respLen = status.modeminfo.len;
+uint8_t Radio::processPacket(RxPacket *pkt)
+{
+  RxFrame frame(rx.data(pkt), pkt->len);
+  int16_t state = pkt->state;
 
-  respFrame = new uint8_t[respLen];
-  state = radioHal->readData(respFrame, respLen);
-  newPacketInfo.rssi = radioHal->getRSSI();
-  newPacketInfo.snr = radioHal->getSNR();
-  newPacketInfo.frequencyerror = radioHal->getFrequencyError();
+  PacketInfo newPacketInfo;
+  lastPacket.crc_error = false;
+  lastPacket.fec = false;
+  newPacketInfo.rssi = pkt->rssi;
+  newPacketInfo.snr = pkt->snr;
+  newPacketInfo.frequencyerror = pkt->frequencyerror;
 
 
   // check if the packet info is exactly the same as the last one
-  if (newPacketInfo.rssi == status.lastPacketInfo.rssi &&
-      newPacketInfo.snr == status.lastPacketInfo.snr &&
-      newPacketInfo.frequencyerror == status.lastPacketInfo.frequencyerror)
+  if (newPacketInfo.rssi == lastPacket.rssi &&
+      newPacketInfo.snr == lastPacket.snr &&
+      newPacketInfo.frequencyerror == lastPacket.frequencyerror)
   {
     Log::console(PSTR("Interrupt triggered but no new data available. Check wiring and electrical interferences."));
-    delete[] respFrame;
-    startRx();
     return 4;
   }
 
+  // the interrupt comes once the whole frame is in, timestamp the end of its sync word
+  lastPacket.usecTime = pkt->usecTime - timing.afterSync(pkt->len);
+  lastPacket.usecError = timeError(timing.resolution());
+
   struct tm *timeinfo;
   time_t currenttime = time(NULL);
   if (currenttime < 0)
   {
     Log::error(PSTR("Failed to obtain time"));
-    status.lastPacketInfo.time = "";
+    lastPacket.time = "";
   }
   else
   {
@@ -289,129 +449,78 @@ uint8_t Radio::listen()
     } // add leading zero if required
     thisTime = thisTime + String(timeinfo->tm_sec);
 
-    status.lastPacketInfo.time = thisTime;
+    lastPacket.time = thisTime;
   }
 
-  status.lastPacketInfo.rssi = newPacketInfo.rssi;
-  status.lastPacketInfo.snr = newPacketInfo.snr;
-  status.lastPacketInfo.frequencyerror = newPacketInfo.frequencyerror;
+  lastPacket.rssi = newPacketInfo.rssi;
+  lastPacket.snr = newPacketInfo.snr;
+  lastPacket.frequencyerror = newPacketInfo.frequencyerror;
 
   // print RSSI (Received Signal Strength Indicator)
   Log::console(PSTR("[%s] RSSI:\t\t%f dBm\n[%s] SNR:\t\t%f dB\n[%s] Frequency error:\t%f Hz"),
-   moduleNameString, status.lastPacketInfo.rssi, 
-   moduleNameString, status.lastPacketInfo.snr, 
-   moduleNameString, status.lastPacketInfo.frequencyerror);
+   moduleNameString, lastPacket.rssi, 
+   moduleNameString, lastPacket.snr, 
+   moduleNameString, lastPacket.frequencyerror);
 
-  if (state == RADIOLIB_ERR_NONE && respLen > 0)
+  if (state == RADIOLIB_ERR_NONE && frame.len > 0)
   {
-    // read optional data
-    Log::console(PSTR("Packet (%u bytes):"), respLen);
-    uint16_t buffSize = respLen * 2 + 1;
-    if (buffSize > 255)
-      buffSize = 255;
-    char *byteStr = new char[buffSize];
-    for (int i = 0; i < respLen; i++)
-    {
-      sprintf(byteStr + i * 2 % (buffSize - 1), "%02x", respFrame[i]);
-      if (i * 2 % buffSize == buffSize - 3 || i == respLen - 1)
-        Log::console(PSTR("%s"), byteStr); // print before the buffer is going to loop back
-    }
-    delete[] byteStr;
+    RxPath::logHex(frame.data, frame.len);
 
        if (allow_decode){
-      String modo=status.modeminfo.modem_mode;
+      String modo=modem.modem_mode;
       if (modo=="FSK"){
         int bytes_sincro=0;
-          for (int i=0;i<sizeof(status.modeminfo.fsw);i++){
-            if (status.modeminfo.fsw[i]!=0){bytes_sincro++;}
+          for (int i=0;i<sizeof(modem.fsw);i++){
+            if (modem.fsw[i]!=0){bytes_sincro++;}
           }
-          buffSize = (respLen+bytes_sincro) * 2 + 1;
-          if (buffSize > 255)
-            buffSize = 255;
-          char *byteStr_fsk = new char[buffSize];
-          for (int i=0;i<bytes_sincro;i++){
-            sprintf(byteStr_fsk+(i*2),"%02X", status.modeminfo.fsw[i]);}
-          for (int i = 0; i < respLen; i++)
+          uint8_t decoder = Satellites::coding(modem.NORAD);
+          RxDecode decoded = rx.decode(frame, decoder, modem.fec, modem.rsDepth, modem.fsw, bytes_sincro);
+          if (frame.fec)
           {
-            sprintf(byteStr_fsk + (bytes_sincro + i) * 2 % (buffSize - 1), "%02X", respFrame[i]);
-            if (i * 2 % buffSize == buffSize - 3 || i == respLen - 1)
-              Log::console(PSTR("%s"), byteStr_fsk); // print before the buffer is going to loop back
+            lastPacket.fec = true;
+            lastPacket.fecCorrected = frame.fecResult.rsCorrected;
+            lastPacket.fecBitErrors = frame.fecResult.bitErrors;
           }
-          Log::console(PSTR("Packet Buffer Size: %i"), buffSize);
-          int coding=Satellites::coding(status.modeminfo.NORAD);
-          if (coding==1){
-            char *ax25;
-            unsigned char *ax25bin;
-            size_t sizeAx25bin=0;
-            ax25=new char[buffSize];
-            ax25bin=new unsigned char[buffSize];
-            BitCode::nrz2ax25(byteStr_fsk,buffSize,ax25,ax25bin,&sizeAx25bin);
-            Log::console(PSTR("%s"),ax25);
-            //RAW packet is replaced by the processed packet.
-            respFrame=ax25bin;
-            respLen=sizeAx25bin;
+          if (decoded == RX_DECODE_NO_POOL)
+            return 6;
+          if (decoded == RX_DECODE_HDLC)
+          {
+            // the frames of the capture are placed from the end of its sync word
+            hdlcSyncUs = lastPacket.usecTime;
+            hdlcSyncBits = 8 * bytes_sincro;
+            hdlcPlaced = !lastPacket.fec;
+            hdlcErrorUs = lastPacket.usecError;
+            if (!hdlcPlaced && hdlcErrorUs != RXB_TIME_ERROR_UNKNOWN)
+              hdlcErrorUs += timing.afterSync(pkt->len);
+            hdlcNoisy = pkt->noisy;
+            return publishHdlcFrame();
           }
-          delete[] byteStr_fsk;
-      }
-    }
-    
-    // if Filter enabled filter the received packet
-    if (status.modeminfo.filter[0] != 0)
-    {
-      bool filter_flag = false;
-      uint8_t filter_size = status.modeminfo.filter[0];
-      uint8_t filter_ini = status.modeminfo.filter[1];
-
-      for (uint8_t filter_pos = 0; filter_pos < filter_size; filter_pos++)
-      {
-        if (status.modeminfo.filter[2 + filter_pos] != respFrame[filter_ini + filter_pos])
-          filter_flag = true;
-      }
-
-      // if the msg start with tiny (test packet) remove filter
-      if (respFrame[0] == 0x54 && respFrame[1] == 0x69 && respFrame[2] == 0x6e && respFrame[3] == 0x79)
-        filter_flag = false;
-
-      if (filter_flag)
-      {
-        Log::console(PSTR("Filter enabled, doesn't looks like the expected satellite packet"));
-        delete[] respFrame;
-        startRx();
-        return 5;
       }
     }
 
-    status.lastPacketInfo.crc_error = false;
-    String encoded = base64::encode(respFrame, respLen);
-    MQTT_Client::getInstance().sendRx(encoded, noisyInterrupt);
+    PERF_MARK(PERF_DECODE);
+    uint8_t ret = publishFrame(frame.data, frame.len, pkt->noisy);
+    if (ret)
+      return ret;
   }
   else if (state == RADIOLIB_ERR_CRC_MISMATCH)
   {
     // packet was received, but is malformed
-    status.lastPacketInfo.crc_error = true;
+    lastPacket.crc_error = true;
 
     // if filter is active, filter the CRC errors
-    if (status.modeminfo.filter[0] == 0)
+    if (modem.filter[0] == 0)
     {
-      String error_encoded = base64::encode("Error_CRC");
-      MQTT_Client::getInstance().sendRx(error_encoded, noisyInterrupt);
+      static const char errorCrc[] = "Error_CRC";
+      MQTT_Client::getInstance().sendRx(index, (const uint8_t *)errorCrc, sizeof(errorCrc) - 1, pkt->noisy);
     }
     else
     {
       Log::console(PSTR("Filter enabled, Error CRC filtered"));
-      delete[] respFrame;
-      startRx();
       return 5;
     }
   }
 
-  delete[] respFrame;
-
-  noisyInterrupt = false;
-
-  // put module back to listen mode
-  startRx();
-
   if (state == RADIOLIB_ERR_NONE)
   {
     return 0;
@@ -425,7 +534,7 @@ uint8_t Radio::listen()
   else if (state == RADIOLIB_ERR_LORA_HEADER_DAMAGED)
   {
     // packet was received, but is malformed
-    Log::console(PSTR("[%S] Damaged header! Data cannot be retrieved"), moduleNameString);
+    Log::console(PSTR("[%s] Damaged header! Data cannot be retrieved"), moduleNameString);
     return 2;
   }
   else
@@ -436,6 +545,221 @@ uint8_t Radio::listen()
   }
 }
 
+uint8_t Radio::publishFrame(const uint8_t *respFrame, size_t respLen, bool noisy)
+{
+  // if Filter enabled filter the received packet
+  if (modem.filter[0] != 0)
+  {
+    bool filter_flag = false;
+    uint8_t filter_size = modem.filter[0];
+    uint8_t filter_ini = modem.filter[1];
+
+    for (uint8_t filter_pos = 0; filter_pos < filter_size; filter_pos++)
+    {
+      if (modem.filter[2 + filter_pos] != respFrame[filter_ini + filter_pos])
+        filter_flag = true;
+    }
+
+    // if the msg start with tiny (test packet) remove filter
+    if (respFrame[0] == 0x54 && respFrame[1] == 0x69 && respFrame[2] == 0x6e && respFrame[3] == 0x79)
+      filter_flag = false;
+
+    if (filter_flag)
+    {
+      Log::console(PSTR("Filter enabled, doesn't looks like the expected satellite packet"));
+      return 5;
+    }
+  }
+
+  PERF_MARK(PERF_FILTER);
+  lastPacket.crc_error = false;
+  MQTT_Client::getInstance().sendRx(index, respFrame, respLen, noisy);
+  return 0;
+}
+
+uint8_t Radio::publishHdlcFrame()
+{
+  // the frames after the first one start later in the capture. The FEC
+  // output does not map to line bits, there the error covers the whole capture.
+  HdlcDeframer &hdlc = rx.deframer();
+  int32_t bits = hdlc.frameOffset() - hdlcSyncBits;
+  lastPacket.usecTime = hdlcSyncUs + (hdlcPlaced && bits > 0 ? timing.bits(bits) : 0);
+  lastPacket.usecError = hdlcErrorUs;
+
+  Log::console(PSTR("AX.25 frame (%u bytes)"), hdlc.frameLen());
+  uint8_t ret = publishFrame(hdlc.frame(), hdlc.frameLen(), hdlcNoisy);
+  hdlc.pop();
+  return ret;
+}
+
+// Rebuilds the on air time model after the modem settings changed
+void Radio::updateTiming()
+{
+  ModemInfo &m = modem;
+  if (m.modem_mode == "LoRa")
+    timing.setLoRa(m.bw, m.sf, m.cr, m.fldro, m.crc, m.preambleLength);
+  else
+    timing.setFsk(m.bitrate, m.preambleLength, m.swSize, m.len, m.enc == 1);
+}
+
+// Low power stations listen to LoRa in bursts instead of keeping the radio in
+// continuous RX. A preamble is caught if the receiver still has a whole burst
+// of it after sleeping through the start, so preamble >= 2 bursts + sleep.
+// Chips that duty cycle themselves (sx126x sniff) do it on their own, the
+// others run CADs from the RX task and only enter RX when one sees a
+// preamble. Preambles too short for a worthwhile sleep keep continuous RX.
+void Radio::setRxMode()
+{
+  ModemInfo &m = modem;
+  rxMode = RX_CONTINUOUS;
+  allowLightSleep(false);
+  if (!ConfigManager::getInstance().getLowPower() || m.modem_mode != "LoRa" || !timing.valid())
+    return;
+
+  uint32_t preambleUs = m.preambleLength * timing.symbol();
+  dutyRxUs = RX_DUTY_SNIFF_SYMBOLS * timing.symbol() + RX_DUTY_WAKE_US;
+  if (preambleUs >= 2 * dutyRxUs + RX_DUTY_MIN_SLEEP_US)
+  {
+    dutySleepUs = preambleUs - 2 * dutyRxUs;
+    if (radioHal->startReceiveDutyCycle(dutyRxUs, dutySleepUs) == RADIOLIB_ERR_NONE)
+      rxMode = RX_SNIFF;
+  }
+
+  if (rxMode == RX_CONTINUOUS)
+  {
+    dutyRxUs = RX_DUTY_CAD_SYMBOLS * timing.symbol() + RX_DUTY_WAKE_US;
+    if (preambleUs < 2 * dutyRxUs + RX_DUTY_MIN_SLEEP_US)
+    {
+      Log::console(PSTR("Preamble too short for duty cycled RX, listening continuously"));
+      return;
+    }
+    dutySleepUs = preambleUs - 2 * dutyRxUs;
+    rxMode = RX_CAD_SCAN;
+  }
+
+  dutyStats = RxDutyStats();
+  dutyStats.since = esp_timer_get_time();
+  Log::console(PSTR("Duty cycled RX (%s): %u us awake every %u us"), rxMode == RX_SNIFF ? "sniff" : "CAD", dutyRxUs, dutyRxUs + dutySleepUs);
+}
+
+void Radio::startScan()
+{
+  allowLightSleep(false);
+  scanState = SCAN_CAD;
+  scanPhaseStart = esp_timer_get_time();
+  radioHal->startChannelScan();
+}
+
+// How long the RX task waits for the radio in the current step of a CAD scan
+TickType_t Radio::scanTimeout()
+{
+  if (rxMode != RX_CAD_SCAN)
+    return portMAX_DELAY;
+
+  if (scanState == SCAN_SLEEP)
+  {
+    // rounded down, a longer sleep could miss a preamble
+    TickType_t ticks = pdMS_TO_TICKS(dutySleepUs / 1000);
+    return ticks ? ticks : 1;
+  }
+
+  // a detection can be anywhere in the preamble, or the CAD interrupt was lost
+  uint32_t us = scanState == SCAN_LISTEN ? timing.airtime(RX_LORA_MAX_LEN) : 4 * dutyRxUs;
+  return pdMS_TO_TICKS(us / 1000) + 1;
+}
+
+// One step of the CAD scan, on the RX task after the radio interrupt or the
+// timeout of the current step
+void Radio::scanStep(bool irq)
+{
+  RadioLock lock(radioLock);
+  if (rxMode != RX_CAD_SCAN)
+  {
+    // the mode changed while we waited
+    readPacket();
+    return;
+  }
+
+  int64_t now = esp_timer_get_time();
+  switch (scanState)
+  {
+  case SCAN_CAD:
+    dutyStats.awakeUs += now - scanPhaseStart;
+    if (!received)
+    {
+      startScan();
+      return;
+    }
+    received = false;
+    dutyStats.scans++;
+    if (radioHal->getChannelScanResult() == RADIOLIB_PREAMBLE_DETECTED)
+    {
+      dutyStats.detections++;
+      scanState = SCAN_LISTEN;
+      scanPhaseStart = now;
+      radioHal->startReceive();
+    }
+    else
+    {
+      scanState = SCAN_SLEEP;
+      radioHal->sleep();
+      allowLightSleep(true);
+    }
+    break;
+
+  case SCAN_LISTEN:
+    dutyStats.awakeUs += now - scanPhaseStart;
+    if (received)
+    {
+      readPacket(); // starts the next scan
+      return;
+    }
+    dutyStats.missed++;
+    startScan();
+    break;
+
+  case SCAN_SLEEP:
+    startScan();
+    break;
+  }
+}
+
+void Radio::allowLightSleep(bool allow)
+{
+  if (!pmLock || allow == sleepAllowed)
+    return;
+
+  sleepAllowed = allow;
+  if (allow)
+    esp_pm_lock_release(pmLock);
+  else
+    esp_pm_lock_acquire(pmLock);
+}
+
+// Share of the time the radio listens, in 1/1000
+uint16_t Radio::getDutyCycle()
+{
+  if (rxMode == RX_CONTINUOUS)
+    return 1000;
+
+  int64_t elapsed = esp_timer_get_time() - dutyStats.since;
+  if (rxMode == RX_SNIFF || elapsed <= 0)
+    return dutyRxUs * 1000ULL / (dutyRxUs + dutySleepUs);
+
+  return dutyStats.awakeUs * 1000 / elapsed;
+}
+
+// Error estimate of a packet timestamp in us: the interrupt resolution and latency
+// plus the station clock error, which grows with the time since the last SNTP sync
+uint32_t Radio::timeError(uint32_t resolution)
+{
+  if (!status.lastTimeSync)
+    return RXB_TIME_ERROR_UNKNOWN;
+
+  uint64_t sinceSync = esp_timer_get_time() - status.lastTimeSync;
+  return RX_IRQ_LATENCY_US + resolution + CLOCK_SYNC_ERROR_US + sinceSync * CLOCK_DRIFT_PPM / 1000000;
+}
+
 void Radio::readState(int state)
 {
   if (state == RADIOLIB_ERR_NONE)
@@ -449,33 +773,32 @@ void Radio::readState(int state)
   }
 }
 
+// Back to listening after the modem settings changed, in the RX mode they
+// allow
+void Radio::restartRx()
+{
+  RadioLock lock(radioLock);
+  updateTiming();
+  setRxMode();
+  startRx();
+}
+
 // remote
 int16_t Radio::remote_freq(char *payload, size_t payload_len)
 {
   float frequency = _atof(payload, payload_len);
   Log::console(PSTR("Set Frequency: %.3f MHz"), frequency);
 
-  int16_t state = 0;
-  board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!radioHal)
     return -1;
-  if (board.L_radio)
-  {
-    ((SX1278 *)lora)->sleep(); // sleep mandatory if FastHop isn't ON.
-    state = ((SX1278 *)lora)->setFrequency(frequency + status.modeminfo.freqOffset);
-    ((SX1278 *)lora)->startReceive();
-  }
-  else
-  {
-    ((SX1268 *)lora)->sleep();
-    state = ((SX1268 *)lora)->setFrequency(frequency + status.modeminfo.freqOffset);
-    ((SX1268 *)lora)->startReceive();
-  }
-
+  RadioLock lock(radioLock);
+  radioHal->sleep(); // sleep mandatory if FastHop isn't ON.
+  int16_t state = radioHal->setFrequency(frequency + modem.freqOffset);
   readState(state);
   if (state == RADIOLIB_ERR_NONE)
-    status.modeminfo.frequency = frequency;
+    modem.frequency = frequency;
 
+  restartRx();
   return state;
 }
 
@@ -483,12 +806,15 @@ int16_t Radio::remoteSetFreqOffset(char *payload, size_t payload_len)
 {
   float frequency_offset = _atof(payload, payload_len);
   Log::console(PSTR("Set Frequency OffSet to %.3f Hz"), frequency_offset);
-  status.modeminfo.freqOffset = frequency_offset / 1000000;
-  status.radio_ready = false;
+  modem.freqOffset = frequency_offset / 1000000;
+  if (!radioHal)
+    return -1;
+  ready = false;
+  RadioLock lock(radioLock);
   CHECK_ERROR(radioHal->sleep());  // sleep mandatory if FastHop isn't ON.
-  CHECK_ERROR(radioHal->setFrequency(status.modeminfo.frequency+status.modeminfo.freqOffset)); 
-  CHECK_ERROR(radioHal->startReceive()); 
-  status.radio_ready = true;
+  CHECK_ERROR(radioHal->setFrequency(modem.frequency+modem.freqOffset)); 
+  restartRx();
+  ready = true;
   return RADIOLIB_ERR_NONE;
 }
 
@@ -497,27 +823,15 @@ int16_t Radio::remote_bw(char *payload, size_t payload_len)
   float bw = _atof(payload, payload_len);
   Log::console(PSTR("Set bandwidth: %.3f MHz"), bw);
 
-  int16_t state = 0;
-  board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!radioHal)
     return -1;
-  if (board.L_radio)
-  {
-    state = ((SX1278 *)lora)->setBandwidth(bw);
-    ((SX1278 *)lora)->startReceive();
-    ((SX1278 *)lora)->setPacketReceivedAction(setFlag);
-  }
-  else
-  {
-    state = ((SX1268 *)lora)->setBandwidth(bw);
-    ((SX1268 *)lora)->startReceive();
-    ((SX1268 *)lora)->setPacketReceivedAction(setFlag);
-  }
-
+  RadioLock lock(radioLock);
+  int16_t state = radioHal->setBandwidth(bw);
   readState(state);
   if (state == RADIOLIB_ERR_NONE)
-    status.modeminfo.bw = bw;
+    modem.bw = bw;
 
+  restartRx();
   return state;
 }
 
@@ -526,28 +840,15 @@ int16_t Radio::remote_sf(char *payload, size_t payload_len)
   uint8_t sf = _atof(payload, payload_len);
   Log::console(PSTR("Set spreading factor: %u"), sf);
 
-  int16_t state = 0;
-  board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!radioHal)
     return -1;
-  if (board.L_radio)
-  {
-    state = ((SX1278 *)lora)->setSpreadingFactor(sf);
-    ((SX1278 *)lora)->startReceive();
-    ((SX1278 *)lora)->setPacketReceivedAction(setFlag);
-  }
-  else
-  {
-    state = ((SX1268 *)lora)->setSpreadingFactor(sf);
-    ((SX1268 *)lora)->startReceive();
-    ((SX1268 *)lora)->setPacketReceivedAction(setFlag);
-  }
-
+  RadioLock lock(radioLock);
+  int16_t state = radioHal->setSpreadingFactor(sf);
   readState(state);
-
   if (state == RADIOLIB_ERR_NONE)
-    status.modeminfo.sf = sf;
+    modem.sf = sf;
 
+  restartRx();
   return state;
 }
 
@@ -556,28 +857,15 @@ int16_t Radio::remote_cr(char *payload, size_t payload_len)
   uint8_t cr = _atoi(payload, payload_len);
   Log::console(PSTR("Set coding rate: %u"), cr);
 
-  int16_t state = 0;
-  board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!radioHal)
     return -1;
-  if (board.L_radio)
-  {
-    state = ((SX1278 *)lora)->setCodingRate(cr);
-    ((SX1278 *)lora)->startReceive();
-    ((SX1278 *)lora)->setPacketReceivedAction(setFlag);
-  }
-  else
-  {
-    state = ((SX1268 *)lora)->setCodingRate(cr);
-    ((SX1268 *)lora)->startReceive();
-    ((SX1268 *)lora)->setPacketReceivedAction(setFlag);
-  }
-
+  RadioLock lock(radioLock);
+  int16_t state = radioHal->setCodingRate(cr);
   readState(state);
-
   if (state == RADIOLIB_ERR_NONE)
-    status.modeminfo.cr = cr;
+    modem.cr = cr;
 
+  restartRx();
   return state;
 }
 
@@ -585,44 +873,35 @@ int16_t Radio::remote_crc(char *payload, size_t payload_len)
 {
   bool crc = _atoi(payload, payload_len);
   Log::console(PSTR("Set CRC: %s"), crc ? F("ON") : F("OFF"));
-  int16_t state = 0;
-  board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
-    return -1;
-  if (board.L_radio)
-  {
-    state = ((SX1278 *)lora)->setCRC(crc);
-    ((SX1278 *)lora)->startReceive();
-    ((SX1278 *)lora)->setPacketReceivedAction(setFlag);
-  }
-  else
-  {
-    state = ((SX1268 *)lora)->setCRC(crc);
-    ((SX1268 *)lora)->startReceive();
-    ((SX1268 *)lora)->setPacketReceivedAction(setFlag);
-  }
 
+  if (!radioHal)
+    return -1;
+  RadioLock lock(radioLock);
+  int16_t state = radioHal->setCRC(crc);
   readState(state);
+  if (state == RADIOLIB_ERR_NONE)
+    modem.crc = crc;
+
+  restartRx();
   return state;
 }
 
 int16_t Radio::remote_lsw(char *payload, size_t payload_len)
 {
   uint8_t sw = _atoi(payload, payload_len);
-  char strHex[2];
+  char strHex[3];
   sprintf(strHex, "%1x", sw);
   Log::console(PSTR("Set lsw: %s"), strHex);
 
-  int16_t state = 0;
-  board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!radioHal)
     return -1;
-  if (board.L_radio)
-    state = ((SX1278 *)lora)->setSyncWord(sw);
-  else
-    state = ((SX1268 *)lora)->setSyncWord(sw, 0x44);
-
+  RadioLock lock(radioLock);
+  int16_t state = radioHal->setSyncWord(sw);
   readState(state);
+  if (state == RADIOLIB_ERR_NONE)
+    modem.sw = sw;
+
+  restartRx();
   return state;
 }
 
@@ -631,57 +910,31 @@ int16_t Radio::remote_fldro(char *payload, size_t payload_len)
   bool ldro = _atoi(payload, payload_len);
   Log::console(PSTR("Set ForceLDRO: %s"), ldro ? F("ON") : F("OFF"));
 
-  int16_t state = 0;
-  board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!radioHal)
     return -1;
-  if (board.L_radio)
-  {
-    state = ((SX1278 *)lora)->forceLDRO(ldro);
-    ((SX1278 *)lora)->startReceive();
-    ((SX1278 *)lora)->setPacketReceivedAction(setFlag);
-  }
-  else
-  {
-    state = ((SX1268 *)lora)->forceLDRO(ldro);
-    ((SX1268 *)lora)->startReceive();
-    ((SX1268 *)lora)->setPacketReceivedAction(setFlag);
-  }
-
+  RadioLock lock(radioLock);
+  int16_t state = radioHal->forceLDRO(ldro);
   readState(state);
-
   if (state == RADIOLIB_ERR_NONE)
-  {
-    if (ldro)
-      status.modeminfo.fldro = true;
-    else
-      status.modeminfo.fldro = false;
-  }
+    modem.fldro = ldro;
 
+  restartRx();
   return state;
 }
 
 int16_t Radio::remote_aldro(char *payload, size_t payload_len)
 {
   Log::console(PSTR("Set AutoLDRO "));
-  int16_t state = 0;
-  board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
-    return -1;
-  if (board.L_radio)
-  {
-    state = ((SX1278 *)lora)->autoLDRO();
-    ((SX1278 *)lora)->startReceive();
-    ((SX1278 *)lora)->setPacketReceivedAction(setFlag);
-  }
-  else
-  {
-    state = ((SX1268 *)lora)->autoLDRO();
-    ((SX1268 *)lora)->startReceive();
-    ((SX1268 *)lora)->setPacketReceivedAction(setFlag);
-  }
 
+  if (!radioHal)
+    return -1;
+  RadioLock lock(radioLock);
+  int16_t state = radioHal->autoLDRO();
   readState(state);
+  if (state == RADIOLIB_ERR_NONE)
+    modem.fldro = 2;
+
+  restartRx();
   return state;
 }
 
@@ -689,27 +942,16 @@ int16_t Radio::remote_pl(char *payload, size_t payload_len)
 {
   uint16_t pl = _atoi(payload, payload_len);
   Log::console(PSTR("Set Preamble %u"), pl);
-  int16_t state = 0;
-  board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
-    return -1;
-  if (board.L_radio)
-  {
-    state = ((SX1278 *)lora)->setPreambleLength(pl);
-    ((SX1278 *)lora)->startReceive();
-    ((SX1278 *)lora)->setPacketReceivedAction(setFlag);
-  }
-  else
-  {
-    state = ((SX1268 *)lora)->setPreambleLength(pl);
-    ((SX1268 *)lora)->startReceive();
-    ((SX1268 *)lora)->setPacketReceivedAction(setFlag);
-  }
 
+  if (!radioHal)
+    return -1;
+  RadioLock lock(radioLock);
+  int16_t state = radioHal->setPreambleLength(pl);
   readState(state);
   if (state == RADIOLIB_ERR_NONE)
-    status.modeminfo.preambleLength = pl;
+    modem.preambleLength = pl;
 
+  restartRx();
   return state;
 }
 
@@ -721,53 +963,36 @@ int16_t Radio::remote_begin_lora(char *payload, size_t payload_len)
   float bw = doc[1];
   uint8_t sf = doc[2];
   uint8_t cr = doc[3];
-  uint8_t syncWord78 = doc[4];
+  uint8_t syncWord = doc[4];
   int8_t power = doc[5];
   uint8_t current_limit = doc[6];
   uint16_t preambleLength = doc[7];
   uint8_t gain = doc[8];
-  uint16_t syncWord68 = doc[4];
 
-  char sw78StrHex[2];
-  char sw68StrHex[3];
-  sprintf(sw78StrHex, "%1x", syncWord78);
-  sprintf(sw68StrHex, "%2x", syncWord68);
-  Log::console(PSTR("Set Frequency: %.3f MHz\nSet bandwidth: %.3f MHz\nSet spreading factor: %u\nSet coding rate: %u\nSet sync Word 127x: 0x%s\nSet sync Word 126x: 0x%s"), freq, bw, sf, cr, sw78StrHex, sw68StrHex);
+  Log::console(PSTR("Set Frequency: %.3f MHz\nSet bandwidth: %.3f MHz\nSet spreading factor: %u\nSet coding rate: %u\nSet sync Word: 0x%x"), freq, bw, sf, cr, syncWord);
   Log::console(PSTR("Set Power: %d\nSet C limit: %u\nSet Preamble: %u\nSet Gain: %u"), power, current_limit, preambleLength, gain);
 
-  int16_t state = 0;
   board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!ConfigManager::getInstance().getRadioConfig(index, board))
     return -1;
-  if (board.L_radio)
-  {
-    ((SX1278 *)lora)->sleep(); // sleep mandatory if FastHop isn't ON.
-    state = ((SX1278 *)lora)->begin(freq + status.modeminfo.freqOffset, bw, sf, cr, syncWord78, power, preambleLength, gain);
-    ((SX1278 *)lora)->startReceive();
-    ((SX1278 *)lora)->setPacketReceivedAction(setFlag);
-  }
-  else
-  {
-    board_t board;
-    if (!ConfigManager::getInstance().getBoardConfig(board))
-      return -1;
-    state = ((SX1268 *)lora)->begin(freq + status.modeminfo.freqOffset, bw, sf, cr, syncWord68, power, preambleLength, board.L_TCXO_V);
-    ((SX1268 *)lora)->startReceive();
-    ((SX1268 *)lora)->setPacketReceivedAction(setFlag);
-  }
-
+  RadioLock lock(radioLock);
+  radioHal->sleep(); // sleep mandatory if FastHop isn't ON.
+  int16_t state = radioHal->begin(freq + modem.freqOffset, bw, sf, cr, syncWord, power, preambleLength, gain, board.L_TCXO_V);
+  radioHal->setDio0Action(irqHandler);
   readState(state);
   if (state == RADIOLIB_ERR_NONE)
   {
-    status.modeminfo.modem_mode = "LoRa";
-    status.modeminfo.frequency = freq;
-    status.modeminfo.bw = bw;
-    status.modeminfo.power = power;
-    status.modeminfo.preambleLength = preambleLength;
-    status.modeminfo.sf = sf;
-    status.modeminfo.cr = cr;
+    modem.modem_mode = "LoRa";
+    modem.frequency = freq;
+    modem.bw = bw;
+    modem.power = power;
+    modem.preambleLength = preambleLength;
+    modem.sf = sf;
+    modem.cr = cr;
+    modem.sw = syncWord;
   }
 
+  restartRx();
   return state;
 }
 
@@ -788,50 +1013,31 @@ int16_t Radio::remote_begin_fsk(char *payload, size_t payload_len)
   Log::console(PSTR("Set Frequency: %.3f MHz\nSet bit rate: %.3f\nSet Frequency deviation: %.3f kHz\nSet receiver bandwidth: %.3f kHz\nSet Power: %d"), freq, br, freqDev, rxBw, power);
   Log::console(PSTR("Set Preamble Length: %u\nOOK Modulation %s\nSet datashaping %u"), preambleLength, (ook == 255) ? F("ON") : F("OFF"), ook);
 
-  int16_t state = 0;
   board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!ConfigManager::getInstance().getRadioConfig(index, board))
     return -1;
-  if (board.L_radio)
-  {
-    state = ((SX1278 *)lora)->beginFSK(freq + status.modeminfo.freqOffset, br, freqDev, rxBw, power, preambleLength, (ook == 255));
-    ((SX1278 *)lora)->setDataShaping(ook);
-    ((SX1278 *)lora)->startReceive();
-    ((SX1278 *)lora)->setPacketReceivedAction(setFlag);
-    ((SX1278 *)lora)->setCRC(false);
-   // ((SX1278 *)lora)->_mod->SPIsetRegValue(SX127X_REG_SYNC_CONFIG, SX127X_PREAMBLE_POLARITY_AA, 5, 5);  
-    ((SX1278 *)lora)->fixedPacketLengthMode(len);
-
-  }
-  else
-  {
-    board_t board;
-    if (!ConfigManager::getInstance().getBoardConfig(board))
-      return -1;
-    state = ((SX1268 *)lora)->beginFSK(freq + status.modeminfo.freqOffset, br, freqDev, rxBw, power, preambleLength, board.L_TCXO_V);
-    ((SX1268 *)lora)->setDataShaping(ook);
-    ((SX1268 *)lora)->startReceive();
-    ((SX1268 *)lora)->setPacketReceivedAction(setFlag);
-    ((SX1268 *)lora)->setCRC(false);
-    ((SX1268 *)lora)->fixedPacketLengthMode(len);
-    
-
-  }
+  RadioLock lock(radioLock);
+  int16_t state = radioHal->beginFSK(freq + modem.freqOffset, br, freqDev, rxBw, power, preambleLength, (ook == 255), board.L_TCXO_V);
+  radioHal->setDataShaping(ook);
+  radioHal->setCRC(0);
+  radioHal->fixedPacketLengthMode(len);
+  radioHal->setDio0Action(irqHandler);
   readState(state);
 
   if (state == RADIOLIB_ERR_NONE)
   {
-    status.modeminfo.modem_mode = "FSK";
-    status.modeminfo.frequency = freq;
-    status.modeminfo.bw = rxBw;
-    status.modeminfo.power = power;
-    status.modeminfo.preambleLength = preambleLength;
-    status.modeminfo.bitrate = br;
-    status.modeminfo.freqDev = freqDev;
-    status.modeminfo.OOK = ook;
-    status.modeminfo.len = len;
+    modem.modem_mode = "FSK";
+    modem.frequency = freq;
+    modem.bw = rxBw;
+    modem.power = power;
+    modem.preambleLength = preambleLength;
+    modem.bitrate = br;
+    modem.freqDev = freqDev;
+    modem.OOK = ook;
+    modem.len = len;
   }
 
+  restartRx();
   return state;
 }
 
@@ -840,19 +1046,15 @@ int16_t Radio::remote_br(char *payload, size_t payload_len)
   uint8_t br = _atoi(payload, payload_len);
   Log::console(PSTR("Set FSK Bit rate: %u"), br);
 
-  int16_t state = 0;
-  board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!radioHal)
     return -1;
-  if (board.L_radio)
-    state = ((SX1278 *)lora)->setBitRate(br);
-  else
-    state = ((SX1268 *)lora)->setBitRate(br);
-
+  RadioLock lock(radioLock);
+  int16_t state = radioHal->setBitRate(br);
   readState(state);
   if (state == RADIOLIB_ERR_NONE)
-    status.modeminfo.bitrate = br;
+    modem.bitrate = br;
 
+  restartRx();
   return state;
 }
 
@@ -861,19 +1063,15 @@ int16_t Radio::remote_fd(char *payload, size_t payload_len)
   uint8_t fd = _atoi(payload, payload_len);
   Log::console(PSTR("Set FSK Frequency Dev.: %u"), fd);
 
-  int16_t state = 0;
-  board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!radioHal)
     return -1;
-  if (board.L_radio)
-    state = ((SX1278 *)lora)->setFrequencyDeviation(fd);
-  else
-    state = ((SX1268 *)lora)->setFrequencyDeviation(fd);
-
+  RadioLock lock(radioLock);
+  int16_t state = radioHal->setFrequencyDeviation(fd);
   readState(state);
   if (state == RADIOLIB_ERR_NONE)
-    status.modeminfo.freqDev = fd;
+    modem.freqDev = fd;
 
+  restartRx();
   return state;
 }
 
@@ -882,19 +1080,15 @@ int16_t Radio::remote_fbw(char *payload, size_t payload_len)
   float frequency = _atof(payload, payload_len);
   Log::console(PSTR("Set FSK bandwidth: %.3f kHz"), frequency);
 
-  int16_t state = 0;
-  board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!radioHal)
     return -1;
-  if (board.L_radio)
-    state = ((SX1278 *)lora)->setRxBandwidth(frequency);
-  else
-    state = ((SX1268 *)lora)->setRxBandwidth(frequency);
-
+  RadioLock lock(radioLock);
+  int16_t state = radioHal->setRxBandwidth(frequency);
   readState(state);
   if (state == RADIOLIB_ERR_NONE)
-    status.modeminfo.bw = frequency;
+    modem.bw = frequency;
 
+  restartRx();
   return state;
 }
 
@@ -913,24 +1107,23 @@ int16_t Radio::remote_fsw(char *payload, size_t payload_len)
   for (uint8_t words = 0; words < synnwordsize; words++)
   {
     syncWord[words] = doc[words];
-    status.modeminfo.fsw[words] = syncWord[words];
     Serial.print(F(" 0x"));
     Serial.print(syncWord[words], HEX);
     Serial.print(F(", "));
   }
 
-   status.modeminfo.swSize = synnwordsize;
-
-  int16_t state = 0;
-  board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!radioHal)
     return -1;
-  if (board.L_radio)
-    state = ((SX1278 *)lora)->setSyncWord(syncWord, synnwordsize);
-  else
-    state = ((SX1268 *)lora)->setSyncWord(syncWord, synnwordsize);
-
+  RadioLock lock(radioLock);
+  int16_t state = radioHal->setSyncWord(syncWord, synnwordsize);
   readState(state);
+  if (state == RADIOLIB_ERR_NONE)
+  {
+    memcpy(modem.fsw, syncWord, synnwordsize);
+    modem.swSize = synnwordsize;
+  }
+
+  restartRx();
   return state;
 }
 
@@ -944,27 +1137,21 @@ int16_t Radio::remote_fook(char *payload, size_t payload_len)
   Log::console(PSTR("OOK Modulation: %s"), enableOOK ? F("ON") : F("OFF"));
   Log::console(PSTR("Set OOK datashaping: %u"), ook_shape);
 
-  int state = 0;
-  board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!radioHal)
     return -1;
-  if (board.L_radio)
-  {
-    state = ((SX1278 *)lora)->setOOK(enableOOK);
-  }
-  else
+  RadioLock lock(radioLock);
+  int16_t state = radioHal->setOOK(enableOOK);
+  if (state == RADIOLIB_ERR_UNSUPPORTED)
   {
     Log::error(PSTR("OOK not supported by the selected lora module!"));
     return -1;
   }
-
   readState(state);
-  if (!ConfigManager::getInstance().getBoardConfig(board))
-    return -1;
-  if (board.L_radio)
-    state = ((SX1278 *)lora)->setDataShapingOOK(ook_shape);
 
+  state = radioHal->setDataShapingOOK(ook_shape);
   readState(state);
+
+  restartRx();
   return state;
 }
 
@@ -976,8 +1163,9 @@ void Radio::remote_SPIwriteRegister(char *payload, size_t payload_len)
   uint8_t data = doc[1];
   Log::console(PSTR("REG ID: 0x%x to 0x%x"), reg, data);
   board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!ConfigManager::getInstance().getRadioConfig(index, board))
     return;
+  RadioLock lock(radioLock);
   //if (board.L_radio)
   //  ((SX1278 *)lora)->_mod->SPIwriteRegister(reg, data);
   //  else
@@ -991,8 +1179,9 @@ int16_t Radio::remote_SPIreadRegister(char *payload, size_t payload_len)
 
   int16_t state = 0;
   board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!ConfigManager::getInstance().getRadioConfig(index, board))
     return -1;
+  RadioLock lock(radioLock);
   //if (board.L_radio)
    // data = ((SX1278 *)lora)->_mod->SPIreadRegister(reg);
   // else
@@ -1030,8 +1219,9 @@ int16_t Radio::remote_SPIsetRegValue(char *payload, size_t payload_len)
 
   int16_t state = 0;
   board_t board;
-  if (!ConfigManager::getInstance().getBoardConfig(board))
+  if (!ConfigManager::getInstance().getRadioConfig(index, board))
     return -1;
+  RadioLock lock(radioLock);
   //if (board.L_radio)
   //  state = ((SX1278 *)lora)->_mod->SPIsetRegValue(reg, value, msb, lsb, checkinterval);
   //else
@@ -22,14 +22,54 @@
 #define RADIOLIB_EXCLUDE_HTTP
 
 #include <RadioLib.h>
+#include <esp_pm.h>
 #include "../ConfigManager/ConfigManager.h"
 #include "../Status.h"
 #include "../Mqtt/MQTT_Client.h"
 #include "RadioHal.hpp"
+#include "RxPath.h"
 #include "src/Power/Power.h"
+#include "../Perf/Perf.h"
+#include "ModemTiming.h"
 
 extern Status status;
 
+#define RX_LORA_MAX_LEN  255    // largest LoRa payload
+#define RX_TASK_STACK    4096
+#define RX_TASK_PRIORITY 3      // above loopTask so a slow publish never delays the FIFO read
+#if CONFIG_FREERTOS_UNICORE
+#define RX_TASK_CORE     0
+#else
+#define RX_TASK_CORE     ARDUINO_RUNNING_CORE  // same core that owns the radio SPI bus
+#endif
+
+// packet timestamp error budget, see Radio::timeError()
+#define RX_IRQ_LATENCY_US   50      // DIO edge to the timestamp taken in setFlag()
+#define CLOCK_SYNC_ERROR_US 2000    // offset left by an SNTP sync over the internet
+#define CLOCK_DRIFT_PPM     20      // crystal drift between SNTP syncs
+
+// duty cycled reception of low power stations, see Radio::setRxMode()
+#define RX_DUTY_SNIFF_SYMBOLS 8     // preamble symbols the sx126x needs in each RX window
+#define RX_DUTY_CAD_SYMBOLS   2     // length of a CAD
+#define RX_DUTY_WAKE_US       1000  // radio start up from sleep
+#define RX_DUTY_MIN_SLEEP_US  5000  // shorter sleeps save less than continuous RX
+#define RX_DUTY_LOOP_IDLE_MS  10    // loop() pause that lets the idle task light sleep
+
+enum RxMode : uint8_t {
+  RX_CONTINUOUS,
+  RX_SNIFF,       // the radio duty cycles itself (sx126x)
+  RX_CAD_SCAN,    // CAD, sleep, CAD... driven by the RX task, RX only after a detection
+};
+
+// Counters of the duty cycled modes. In sniff mode the radio does not tell
+// when it wakes, only the configured duty cycle is known.
+struct RxDutyStats {
+  uint32_t scans = 0;       // CADs run
+  uint32_t detections = 0;  // CADs that saw a preamble
+  uint32_t missed = 0;      // detections with no packet before the listen window closed
+  uint64_t awakeUs = 0;     // radio in CAD or RX
+  int64_t since = 0;        // esp_timer us when the counters started
+};
 
 enum RadioModelNum {
   RADIO_SX1278 = 1,
@@ -39,13 +79,19 @@ enum RadioModelNum {
   RADIO_SX1280 = 8
 };
 
+// One instance per radio module, each with its own bus, interrupt, RX task,
+// queue and modem settings. The first one keeps its settings and last packet
+// in status, where the display and the web panel read them.
 class Radio {
 public:
-  static Radio& getInstance()
+  static Radio& getInstance(uint8_t index = 0)
   {
-    static Radio instance; 
-    return instance;
+    if (!instances[index])
+      instances[index] = new Radio(index);
+    return *instances[index];
   }
+  static uint8_t count() { return ConfigManager::getInstance().getRadioCount(); }
+  static bool anyPending();
 
   void init();
   int16_t begin();
@@ -55,7 +101,17 @@ public:
   void currentRssi();
   int16_t moduleSleep();
   uint8_t listen();
-  bool isReady() { return status.radio_ready; }
+  uint32_t getRxDropped() { return rx.dropped(); }
+  bool rxPending() { return rx.pending(); }
+  const HdlcStats& getHdlcStats() { return rx.deframer().stats(); }
+  bool isReady() { return ready; }
+  uint8_t getIndex() { return index; }
+  ModemInfo& getModem() { return modem; }
+  const PacketInfo& getLastPacket() { return lastPacket; }
+  const ModemTiming& getTiming() { return timing; }
+  RxMode getRxMode() { return rxMode; }
+  uint16_t getDutyCycle();
+  const RxDutyStats& getDutyStats() { return dutyStats; }
   int16_t remote_freq(char* payload, size_t payload_len);
   int16_t remote_bw(char* payload, size_t payload_len);
   int16_t remote_sf(char* payload, size_t payload_len);
@@ -81,11 +137,55 @@ public:
 
    
 private:
-  Radio();
-  PhysicalLayer* lora; // TODO: Remove this
-  IRadioHal* radioHal;
+  Radio(uint8_t index);
+  const uint8_t index;
+  ModemInfo ownModem;     // used by the radios after the first one
+  PacketInfo ownPacket;
+  ModemInfo& modem;
+  PacketInfo& lastPacket;
+  void (*const irqHandler)();
+  static Radio* instances[MAX_RADIOS];
+  static void (*const irqHandlers[MAX_RADIOS])();
+
+  IRadioHal* radioHal = nullptr;
   void readState(int state);
-  static void setFlag();
+  template <uint8_t N> static void setFlag();
+  void interrupt();
+  static void rxTask(void* param);
+  void readPacket();
+  uint8_t processPacket(RxPacket* pkt);
+  uint8_t publishFrame(const uint8_t* frame, size_t len, bool noisy);
+  uint8_t publishHdlcFrame();
+  void updateTiming();
+  void setRxMode();
+  void restartRx();
+  void startScan();
+  void scanStep(bool irq);
+  TickType_t scanTimeout();
+  void allowLightSleep(bool allow);
+  uint32_t timeError(uint32_t resolution);
+  RxPath rx;
+  SemaphoreHandle_t radioLock = NULL;
+  TaskHandle_t rxTaskHandle = NULL;
+  volatile bool received = false;
+  volatile bool eInterrupt = true;
+  volatile bool noisyInterrupt = false;
+  volatile int64_t irqTime = 0;
+  bool ready = false;
+  ModemTiming timing;
+  RxMode rxMode = RX_CONTINUOUS;
+  enum : uint8_t { SCAN_CAD, SCAN_SLEEP, SCAN_LISTEN } scanState = SCAN_CAD;
+  uint32_t dutyRxUs = 0;      // RX window (sniff) or CAD length
+  uint32_t dutySleepUs = 0;
+  int64_t scanPhaseStart = 0;
+  RxDutyStats dutyStats;
+  esp_pm_lock_handle_t pmLock = NULL;  // held whenever the CPU must not light sleep
+  bool sleepAllowed = false;
+  bool hdlcNoisy = false;
+  int64_t hdlcSyncUs = 0;     // end of the sync word of the capture the pending frames come from
+  uint32_t hdlcSyncBits = 0;  // deframer line bits up to there
+  uint32_t hdlcErrorUs = 0;   // error estimate of the frames of the capture
+  bool hdlcPlaced = false;    // frame offsets are line bits, not FEC output
   SPIClass spi;
   const char* TEST_STRING = "TinyGS-test "; // make sure this always start with "TinyGS-test"!!!
   const char* moduleNameString = "Uninitalised";
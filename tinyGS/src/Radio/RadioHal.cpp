@@ -220,6 +220,36 @@ int16_t RadioHal<SX1280>::startReceive(uint8_t len, uint8_t mode)
     return radio->startReceive(len);
 }
 
+template<>
+int16_t RadioHal<SX1278>::startReceiveDutyCycle(uint32_t rxPeriod, uint32_t sleepPeriod)
+{
+    return RADIOLIB_ERR_UNSUPPORTED;
+}
+
+template<>
+int16_t RadioHal<SX1276>::startReceiveDutyCycle(uint32_t rxPeriod, uint32_t sleepPeriod)
+{
+    return RADIOLIB_ERR_UNSUPPORTED;
+}
+
+template<>
+int16_t RadioHal<SX1268>::startReceiveDutyCycle(uint32_t rxPeriod, uint32_t sleepPeriod)
+{
+    return radio->startReceiveDutyCycle(rxPeriod, sleepPeriod);
+}
+
+template<>
+int16_t RadioHal<SX1262>::startReceiveDutyCycle(uint32_t rxPeriod, uint32_t sleepPeriod)
+{
+    return radio->startReceiveDutyCycle(rxPeriod, sleepPeriod);
+}
+
+template<>
+int16_t RadioHal<SX1280>::startReceiveDutyCycle(uint32_t rxPeriod, uint32_t sleepPeriod)
+{
+    return RADIOLIB_ERR_UNSUPPORTED;
+}
+
 template<>
 int16_t RadioHal<SX1280>::autoLDRO()
 {
@@ -384,4 +414,124 @@ int16_t RadioHal<SX1280>::setEncoding(uint8_t encoding)
         encoding = 1;
 
     return radio->setEncoding(encoding);
-}
\ No newline at end of file
+}
+
+template<>
+int16_t RadioHal<SX1278>::setSyncWord(uint8_t syncWord)
+{
+    return radio->setSyncWord(syncWord);
+}
+
+template<>
+int16_t RadioHal<SX1276>::setSyncWord(uint8_t syncWord)
+{
+    return radio->setSyncWord(syncWord);
+}
+
+template<>
+int16_t RadioHal<SX1268>::setSyncWord(uint8_t syncWord)
+{
+    return radio->setSyncWord(syncWord, 0x44);
+}
+
+template<>
+int16_t RadioHal<SX1262>::setSyncWord(uint8_t syncWord)
+{
+    return radio->setSyncWord(syncWord, 0x44);
+}
+
+template<>
+int16_t RadioHal<SX1280>::setSyncWord(uint8_t syncWord)
+{
+    return radio->setSyncWord(syncWord, 0x44);
+}
+
+template<>
+int16_t RadioHal<SX1278>::setRxBandwidth(float rxBw)
+{
+    return radio->setRxBandwidth(rxBw);
+}
+
+template<>
+int16_t RadioHal<SX1276>::setRxBandwidth(float rxBw)
+{
+    return radio->setRxBandwidth(rxBw);
+}
+
+template<>
+int16_t RadioHal<SX1268>::setRxBandwidth(float rxBw)
+{
+    return radio->setRxBandwidth(rxBw);
+}
+
+template<>
+int16_t RadioHal<SX1262>::setRxBandwidth(float rxBw)
+{
+    return radio->setRxBandwidth(rxBw);
+}
+
+template<>
+int16_t RadioHal<SX1280>::setRxBandwidth(float rxBw)
+{
+    return RADIOLIB_ERR_UNSUPPORTED;
+}
+
+template<>
+int16_t RadioHal<SX1278>::setOOK(bool enableOOK)
+{
+    return radio->setOOK(enableOOK);
+}
+
+template<>
+int16_t RadioHal<SX1276>::setOOK(bool enableOOK)
+{
+    return radio->setOOK(enableOOK);
+}
+
+template<>
+int16_t RadioHal<SX1268>::setOOK(bool enableOOK)
+{
+    return RADIOLIB_ERR_UNSUPPORTED;
+}
+
+template<>
+int16_t RadioHal<SX1262>::setOOK(bool enableOOK)
+{
+    return RADIOLIB_ERR_UNSUPPORTED;
+}
+
+template<>
+int16_t RadioHal<SX1280>::setOOK(bool enableOOK)
+{
+    return RADIOLIB_ERR_UNSUPPORTED;
+}
+
+template<>
+int16_t RadioHal<SX1278>::setDataShapingOOK(uint8_t sh)
+{
+    return radio->setDataShapingOOK(sh);
+}
+
+template<>
+int16_t RadioHal<SX1276>::setDataShapingOOK(uint8_t sh)
+{
+    return radio->setDataShapingOOK(sh);
+}
+
+template<>
+int16_t RadioHal<SX1268>::setDataShapingOOK(uint8_t sh)
+{
+    return RADIOLIB_ERR_UNSUPPORTED;
+}
+
+template<>
+int16_t RadioHal<SX1262>::setDataShapingOOK(uint8_t sh)
+{
+    return RADIOLIB_ERR_UNSUPPORTED;
+}
+
+template<>
+int16_t RadioHal<SX1280>::setDataShapingOOK(uint8_t sh)
+{
+    return RADIOLIB_ERR_UNSUPPORTED;
+}
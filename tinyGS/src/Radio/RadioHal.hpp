@@ -15,6 +15,9 @@ public:
   virtual int16_t setDataShaping(uint8_t sh) = 0;
   virtual void setDio0Action(void (*func)(void)) = 0;
   virtual int16_t startReceive(uint8_t len = 0, uint8_t mode = RADIOLIB_SX127X_RXCONTINUOUS) = 0;
+  virtual int16_t startReceiveDutyCycle(uint32_t rxPeriod, uint32_t sleepPeriod) = 0;
+  virtual int16_t startChannelScan() = 0;
+  virtual int16_t getChannelScanResult() = 0;
   virtual int16_t transmit(uint8_t* data, size_t len, uint8_t addr = 0) = 0;
   virtual int16_t sleep() = 0;
   virtual size_t getPacketLength(bool update = true) = 0;
@@ -26,6 +29,16 @@ public:
   virtual int16_t setSyncWord(uint8_t* syncWord, uint8_t len) = 0;
   virtual int16_t setFrequency(float freq) = 0;
   virtual int16_t setEncoding(uint8_t encoding) = 0;
+  virtual int16_t setBandwidth(float bw) = 0;
+  virtual int16_t setSpreadingFactor(uint8_t sf) = 0;
+  virtual int16_t setCodingRate(uint8_t cr) = 0;
+  virtual int16_t setSyncWord(uint8_t syncWord) = 0;
+  virtual int16_t setPreambleLength(uint16_t preambleLength) = 0;
+  virtual int16_t setBitRate(float br) = 0;
+  virtual int16_t setFrequencyDeviation(float freqDev) = 0;
+  virtual int16_t setRxBandwidth(float rxBw) = 0;
+  virtual int16_t setOOK(bool enableOOK) = 0;
+  virtual int16_t setDataShapingOOK(uint8_t sh) = 0;
   virtual void setRfSwitchPins(uint8_t rxEnPin, uint8_t txEnPin) = 0;
 };
 
@@ -57,6 +70,20 @@ public:
 
   int16_t startReceive(uint8_t len = 0, uint8_t mode = RADIOLIB_SX127X_RXCONTINUOUS);
 
+  // the radio alternates rxPeriod us listening and sleepPeriod us asleep on its own (sx126x)
+  int16_t startReceiveDutyCycle(uint32_t rxPeriod, uint32_t sleepPeriod);
+
+  // one CAD, the DIO interrupt comes when it is done
+  int16_t startChannelScan()
+  {
+    return radio->startChannelScan();
+  }
+
+  int16_t getChannelScanResult()
+  {
+    return radio->getChannelScanResult();
+  }
+
   int16_t transmit(uint8_t* data, size_t len, uint8_t addr = 0)
   {
     return radio->transmit(data, len, addr);
@@ -101,6 +128,46 @@ public:
 
   int16_t setEncoding(uint8_t encoding);
 
+  int16_t setBandwidth(float bw)
+  {
+    return radio->setBandwidth(bw);
+  }
+
+  int16_t setSpreadingFactor(uint8_t sf)
+  {
+    return radio->setSpreadingFactor(sf);
+  }
+
+  int16_t setCodingRate(uint8_t cr)
+  {
+    return radio->setCodingRate(cr);
+  }
+
+  // LoRa sync word
+  int16_t setSyncWord(uint8_t syncWord);
+
+  int16_t setPreambleLength(uint16_t preambleLength)
+  {
+    return radio->setPreambleLength(preambleLength);
+  }
+
+  int16_t setBitRate(float br)
+  {
+    return radio->setBitRate(br);
+  }
+
+  int16_t setFrequencyDeviation(float freqDev)
+  {
+    return radio->setFrequencyDeviation(freqDev);
+  }
+
+  int16_t setRxBandwidth(float rxBw);
+
+  // only the sx127x do OOK
+  int16_t setOOK(bool enableOOK);
+
+  int16_t setDataShapingOOK(uint8_t sh);
+
   void setRfSwitchPins(uint8_t rxEnPin, uint8_t txEnPin)
   {
     radio->setRfSwitchPins(rxEnPin, txEnPin);
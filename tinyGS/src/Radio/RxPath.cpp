@@ -0,0 +1,127 @@
+/*
+  RxPath.cpp - Per radio path of a received packet, from the FIFO to the frame to publish
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "RxPath.h"
+#include "../BitCode/BitCode.h"
+#include "../Satellites/Satellites.h"
+#include "../Logger/Logger.h"
+
+RxPath::~RxPath()
+{
+  while (front())
+    pop();
+}
+
+RxPacket *RxPath::prepare()
+{
+  RxPacket *pkt = queue.prepare();
+  FrameHandle frame;
+  if (pkt)
+    frame = FramePool::getInstance().borrow();
+  if (!frame.valid())
+  {
+    rxDropped++;
+    return nullptr;
+  }
+  pkt->frame = frame;
+  return pkt;
+}
+
+void RxPath::pop()
+{
+  // give the frame back and release the slot to the RX task
+  FramePool::getInstance().release(queue.front()->frame);
+  queue.pop();
+}
+
+void RxPath::logHex(const uint8_t *data, size_t len)
+{
+  Log::console(PSTR("Packet (%u bytes):"), len);
+  uint16_t buffSize = len * 2 + 1;
+  if (buffSize > 255)
+    buffSize = 255;
+  PooledBuffer<char> byteStr;
+  for (int i = 0; byteStr.valid() && i < len; i++)
+  {
+    sprintf(byteStr.get() + i * 2 % (buffSize - 1), "%02x", data[i]);
+    if (i * 2 % buffSize == buffSize - 3 || i == len - 1)
+      Log::console(PSTR("%s"), byteStr.get()); // print before the buffer is going to loop back
+  }
+}
+
+RxDecode RxPath::decode(RxFrame &frame, uint8_t decoder, uint8_t fec, uint8_t rsDepth, const uint8_t *sync, size_t syncLen)
+{
+  // optional FEC stage, CCSDS satellites get the usual stack unless configured
+  if (decoder == DECODER_CCSDS && !fec)
+    fec = FEC_CCSDS_DEFAULT;
+  if (fec && frame.len < PooledBuffer<uint8_t>::capacity())
+  {
+    if (!frame.fecFrame.acquire())
+    {
+      Log::error(PSTR("Frame pool exhausted, packet dropped"));
+      return RX_DECODE_NO_POOL;
+    }
+    frame.len = Fec::decode(fec, rsDepth, frame.data, frame.len, frame.fecFrame.get(), &frame.fecResult);
+    frame.data = frame.fecFrame.get();
+    frame.fec = true;
+    Log::console(PSTR("FEC: %d RS symbols corrected, %u channel bit errors"), frame.fecResult.rsCorrected, frame.fecResult.bitErrors);
+  }
+
+  switch (decoder)
+  {
+  case DECODER_AX25_NRZI:
+  case DECODER_AX25_G3RUH:
+  {
+    // a fixed length capture may hold several frames, the first one is
+    // published now and the rest on the next calls to listen(). The
+    // bit state does not go from one capture to the next: the radio
+    // hunts for the sync word again, so the bits in between are lost.
+    uint32_t crcErrors = hdlc.stats().crcErrors;
+    hdlc.resync(decoder == DECODER_AX25_G3RUH);
+    hdlc.feed(sync, syncLen);
+    hdlc.feed(frame.data, frame.len);
+    if (hdlc.available())
+      return RX_DECODE_HDLC;
+    // the error text is sent in place of the frame
+    const char *error = hdlc.stats().crcErrors != crcErrors ? "CRC error!" : "Frame error!";
+    Log::console(PSTR("%s"), error);
+    frame.data = (const uint8_t *)error;
+    frame.len = strlen(error);
+    break;
+  }
+  case DECODER_MANCHESTER:
+  {
+    size_t errors = 0;
+    if (!frame.decodedFrame.acquire())
+    {
+      Log::error(PSTR("Frame pool exhausted, packet dropped"));
+      return RX_DECODE_NO_POOL;
+    }
+    frame.len = BitCode::manchesterDecode(frame.data, frame.len, frame.decodedFrame.get(), &errors);
+    frame.data = frame.decodedFrame.get();
+    if (errors)
+      Log::console(PSTR("Manchester: %u invalid symbols"), errors);
+    break;
+  }
+  default:
+    // raw and CCSDS, the frame goes as it comes out of the FEC stage
+    break;
+  }
+  return RX_DECODE_FRAME;
+}
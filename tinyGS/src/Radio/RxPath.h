@@ -0,0 +1,109 @@
+/*
+  RxPath.h - Per radio path of a received packet, from the FIFO to the frame to publish
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef RX_PATH_H
+#define RX_PATH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "RxQueue.h"
+#include "../FramePool/FramePool.h"
+#include "../BitCode/HdlcDeframer.h"
+#include "../Fec/Fec.h"
+#include "../ConfigManager/BoardTemplate.h"
+
+#define RX_FRAME_MAX_LEN FRAME_POOL_SLOT_SIZE // largest FIFO of the supported modules
+#define RX_QUEUE_SIZE    8      // packets buffered between the RX task and the loop
+#define RX_WORK_FRAMES   2      // pool slots decode() holds at once: FEC and line decoding
+
+// Worst case of the pool: every radio with a full RX queue and a deframer
+// holding its pending frames and work slot, while the loop works on a packet
+static_assert(FRAME_POOL_SLOTS >= MAX_RADIOS * (RX_QUEUE_SIZE + HDLC_PENDING_FRAMES + 1) + RX_WORK_FRAMES,
+              "FramePool too small for MAX_RADIOS radios");
+
+// Packet as read from the radio FIFO by the RX task, the payload lives in a FramePool slot
+struct RxPacket {
+  FrameHandle frame;
+  size_t len = 0;
+  int16_t state = 0;
+  float rssi = 0;
+  float snr = 0;
+  float frequencyerror = 0;
+  bool noisy = false;
+  int64_t irqTime = 0;    // esp_timer us of the DIO interrupt
+  int64_t usecTime = 0;   // the same instant on the station clock, us since the epoch
+  uint32_t perfRead = 0;  // esp_timer us of the FIFO read, for Perf
+};
+
+// A packet on its way through decode(), it ends pointing to what is published.
+// The buffers of the stages go back to the pool with it.
+struct RxFrame {
+  RxFrame(const uint8_t* data, size_t len) : data(data), len(len) {}
+
+  const uint8_t* data;
+  size_t len;
+  bool fec = false;
+  FecResult fecResult;
+  PooledBuffer<uint8_t> fecFrame{false};
+  PooledBuffer<uint8_t> decodedFrame{false};
+};
+
+enum RxDecode : uint8_t {
+  RX_DECODE_FRAME,      // the frame is ready to publish
+  RX_DECODE_HDLC,       // the frames of the capture wait in the deframer
+  RX_DECODE_NO_POOL,    // no pool slot for a stage, packet dropped
+};
+
+// The part of Radio every instance has of its own and that does not touch
+// the module: the queue the RX task fills, the pool slots of the packets and
+// the FSK decoding of the loop. Only needs the pool, the FEC and the bit
+// coding, so the host tests run the same code as the station.
+class RxPath {
+public:
+  ~RxPath();
+
+  // RX task: a queue slot with a pool frame for the next packet. nullptr, and
+  // one more drop, when the loop is not keeping up.
+  RxPacket* prepare();
+  uint8_t* data(const RxPacket* pkt) { return FramePool::getInstance().data(pkt->frame); }
+  void commit() { queue.commit(); }
+
+  // loop: oldest packet, given back with its frame by pop()
+  RxPacket* front() { return queue.front(); }
+  void pop();
+  bool pending() { return !queue.empty() || hdlc.available(); }
+  size_t queued() const { return queue.size(); }
+
+  // packet bytes to the log, in lines that fit a pool slot
+  static void logHex(const uint8_t* data, size_t len);
+
+  // optional FEC stage and the line decoding of the satellite. sync is fed to
+  // the deframer before the packet, the radio has already taken it out.
+  RxDecode decode(RxFrame& frame, uint8_t decoder, uint8_t fec, uint8_t rsDepth, const uint8_t* sync, size_t syncLen);
+
+  HdlcDeframer& deframer() { return hdlc; }
+  uint32_t dropped() const { return rxDropped; }
+
+private:
+  RxQueue<RxPacket, RX_QUEUE_SIZE> queue;
+  HdlcDeframer hdlc;
+  uint32_t rxDropped = 0;
+};
+
+#endif
@@ -0,0 +1,81 @@
+/*
+  RxQueue.h - Lock-free single producer / single consumer ring
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef RX_QUEUE_H
+#define RX_QUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+// Fixed size ring shared between the radio RX task (producer) and the loop
+// (consumer). Slots are filled in place: the producer gets a free slot with
+// prepare(), writes the packet into it and publishes it with commit(); the
+// consumer reads front() and releases it with pop(). No locks, no copies.
+// It only depends on <atomic> so it can be built on the host as well.
+template <typename T, size_t N>
+class RxQueue {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "RxQueue size must be a power of two");
+
+public:
+  RxQueue() : head(0), tail(0) {}
+
+  // producer side
+  T* prepare()
+  {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t - head.load(std::memory_order_acquire) >= N)
+      return nullptr; // full
+    return &slots[t & (N - 1)];
+  }
+
+  void commit()
+  {
+    tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  // consumer side
+  T* front()
+  {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h == tail.load(std::memory_order_acquire))
+      return nullptr; // empty
+    return &slots[h & (N - 1)];
+  }
+
+  void pop()
+  {
+    head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  size_t size() const
+  {
+    return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+  }
+
+  bool empty() const { return size() == 0; }
+  static constexpr size_t capacity() { return N; }
+
+private:
+  T slots[N];
+  std::atomic<uint32_t> head;
+  std::atomic<uint32_t> tail;
+};
+
+#endif
@@ -18,34 +18,62 @@
 */
 
 #include "Satellites.h"
+#include <string.h>
+
+// Must stay sorted by NORAD
+Satellites::Entry Satellites::entries[SATELLITES_MAX] = {
+  { 43798, DECODER_AX25_NRZI },  // ASTROCAST 0.1
+  { 46276, DECODER_AX25_NRZI },  // UPMSAT-2
+  { 51658, DECODER_AX25_NRZI },  // INS-2TD
+};
+size_t Satellites::count = 3;
+
+// first entry with norad >= noradid
+Satellites::Entry* Satellites::find(uint32_t noradid){
+  size_t lo=0;
+  size_t hi=count;
+  while (lo<hi){
+    size_t mid=(lo+hi)/2;
+    if (entries[mid].norad<noradid){lo=mid+1;}else{hi=mid;}
+  }
+  return &entries[lo];
+}
 
 /*
-Output:
+Output: SatDecoder
 0: Raw
 1: AX25
+...
 */
 int Satellites::coding(int noradid){
-    int aux=0;
-  switch (noradid)
-  {
-  case 46276://UPMSAT-2
-    aux=1;
-    /* code */
-    break;
-  
-  case 51658://INS-2TD
-    aux=1;
-    /* code */
-    break;
-
-  case 43798://ASTROCAST 0.1
-    aux=1;
-    /* code */
-    break;
-
-  default:
-    aux=0;
-    break;
+  Entry* e=find(noradid);
+  if (e<entries+count && e->norad==(uint32_t)noradid){
+    return e->decoder;
   }
-  return aux;
+  return DECODER_RAW;
+}
+
+bool Satellites::setDecoder(uint32_t noradid, uint8_t decoder){
+  if (decoder>=DECODER_COUNT){return false;}
+  if (decoder==DECODER_RAW){removeDecoder(noradid);return true;}
+
+  Entry* e=find(noradid);
+  if (e<entries+count && e->norad==noradid){
+    e->decoder=decoder;
+    return true;
+  }
+  if (count==SATELLITES_MAX){return false;}
+  memmove(e+1,e,(entries+count-e)*sizeof(Entry));
+  e->norad=noradid;
+  e->decoder=decoder;
+  count++;
+  return true;
+}
+
+bool Satellites::removeDecoder(uint32_t noradid){
+  Entry* e=find(noradid);
+  if (e==entries+count || e->norad!=noradid){return false;}
+  memmove(e,e+1,(entries+count-e-1)*sizeof(Entry));
+  count--;
+  return true;
 }
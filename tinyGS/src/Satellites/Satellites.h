@@ -19,8 +19,43 @@
 
 #ifndef SATELLITES_H
 #define SATELLITES_H
+#include <stdint.h>
+#include <stddef.h>
+
+#define SATELLITES_MAX 64   // entries in the decoder registry
+#define SATELLITES_OVERRIDES_FILE "/satdec"  // decoders set with the dec command
+
+// Decoder pipeline applied to the FSK packets of a satellite
+enum SatDecoder : uint8_t {
+  DECODER_RAW = 0,         // packet sent as received
+  DECODER_AX25_NRZI = 1,   // AX.25 / HDLC, NRZI
+  DECODER_AX25_G3RUH = 2,  // AX.25 / HDLC, G3RUH scrambled NRZI
+  DECODER_MANCHESTER = 3,  // Manchester (IEEE 802.3, 01 -> 1)
+  DECODER_CCSDS = 4,       // CCSDS
+  DECODER_COUNT
+};
+
+// Registry of decoders by NORAD ID, kept as a flat array sorted by NORAD so
+// the lookup done for every packet is a binary search. It starts with the
+// satellites that used to be hard coded and is updated from MQTT (begine,
+// batch_conf) and from the saved modem config. The entries set with the dec
+// command are also saved in flash and replayed at boot (SatellitesStore.cpp).
 class Satellites{
     public:
     static int coding(int noradid);
+    static bool setDecoder(uint32_t noradid, uint8_t decoder);
+    static bool removeDecoder(uint32_t noradid);
+    static size_t size() { return count; }
+    static void loadOverrides();
+    static bool saveOverride(uint32_t noradid, uint8_t decoder);
+
+    private:
+    struct Entry {
+      uint32_t norad;
+      uint8_t decoder;
+    };
+    static Entry* find(uint32_t noradid);
+    static Entry entries[SATELLITES_MAX];
+    static size_t count;
 };
 #endif
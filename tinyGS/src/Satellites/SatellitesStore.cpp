@@ -0,0 +1,78 @@
+/*
+  SatellitesStore.cpp - Decoder overrides kept in flash
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Kept apart from Satellites.cpp so the registry itself builds on the host.
+
+#include "Satellites.h"
+#include <LittleFS.h>
+#include "../Logger/Logger.h"
+
+struct __attribute__((packed)) Override {
+  uint32_t norad;
+  uint8_t decoder;   // DECODER_RAW removes the entry
+};
+
+// Replays the overrides saved by saveOverride, the data partition is mounted by Journal::begin
+void Satellites::loadOverrides()
+{
+  File f = LittleFS.open(SATELLITES_OVERRIDES_FILE, FILE_READ);
+  if (!f)
+    return;
+
+  Override o;
+  size_t n = 0;
+  while (f.read((uint8_t *)&o, sizeof(o)) == sizeof(o))
+  {
+    if (setDecoder(o.norad, o.decoder))
+      n++;
+  }
+  f.close();
+  Log::debug(PSTR("Sat Decoder: %u overrides loaded, %u entries"), n, count);
+}
+
+// One record per NORAD: the file is rewritten without the previous record of the satellite
+bool Satellites::saveOverride(uint32_t noradid, uint8_t decoder)
+{
+  Override list[SATELLITES_MAX];
+  size_t n = 0;
+  File f = LittleFS.open(SATELLITES_OVERRIDES_FILE, FILE_READ);
+  if (f)
+  {
+    Override o;
+    while (n < SATELLITES_MAX - 1 && f.read((uint8_t *)&o, sizeof(o)) == sizeof(o))
+    {
+      if (o.norad != noradid)
+        list[n++] = o;
+    }
+    f.close();
+  }
+  list[n].norad = noradid;
+  list[n].decoder = decoder;
+  n++;
+
+  f = LittleFS.open(SATELLITES_OVERRIDES_FILE, FILE_WRITE);
+  if (!f)
+  {
+    Log::error(PSTR("Sat Decoder: unable to save the override of %u"), noradid);
+    return false;
+  }
+  bool ok = f.write((uint8_t *)list, n * sizeof(Override)) == n * sizeof(Override);
+  f.close();
+  return ok;
+}
@@ -30,6 +30,11 @@ struct PacketInfo {
   float snr = 0;
   float frequencyerror = 0;    // Hz 
   bool crc_error = false;
+  bool fec = false;            // the FEC stage ran on this packet
+  int16_t fecCorrected = 0;    // RS symbols corrected, -1 uncorrectable
+  uint32_t fecBitErrors = 0;   // channel bits corrected by the Viterbi decoder
+  int64_t usecTime = 0;        // end of the sync word, us since the epoch
+  uint32_t usecError = 0;      // error estimate of usecTime in us
 };
 
 struct ModemInfo {
@@ -54,6 +59,8 @@ struct ModemInfo {
   uint8_t   swSize    = 0;
   uint8_t   filter[8] = {0,0,0,0,0,0,0,0};
   uint8_t   len       = 64;     // FSK expected lenght in packet mode
+  uint8_t   fec       = 0;      // FSK FEC stages (Fec.h), 0 -> none
+  uint8_t   rsDepth   = 1;      // RS interleaving depth
   uint8_t   enc       = 0;      // FSK  transmission encoding. (0 -> NRZ(sx127x, sx126x)(defaul).  1 -> MANCHESTER(sx127x), WHITENING(sx126x).  2 -> WHITENING(sx127x, sx126x). 10 -> NRZ(sx127x), WHITENING(sx126x).
   float currentRssi = 0;
 };
@@ -78,6 +85,7 @@ struct Status {
   uint8_t remoteTextFrameLength[4] = {0, 0, 0, 0};
   TextFrame remoteTextFrame[4][15];
   float time_offset = 0;
+  int64_t lastTimeSync = 0;    // esp_timer us of the last SNTP sync, 0 -> not synced yet
  };
 
 #endif
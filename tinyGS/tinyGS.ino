@@ -77,7 +77,10 @@
 #include "src/ArduinoOTA/ArduinoOTA.h"
 #include "src/OTA/OTA.h"
 #include "src/Logger/Logger.h"
+#include "src/Journal/Journal.h"
+#include "src/Satellites/Satellites.h"
 #include "time.h"
+#include "esp_sntp.h"
 
 
 #if  RADIOLIB_VERSION_MAJOR != (0x06) || RADIOLIB_VERSION_MINOR != (0x04) || RADIOLIB_VERSION_PATCH != (0x00) || RADIOLIB_VERSION_EXTRA != (0x00)
@@ -108,7 +111,8 @@ void configured()
 {
   configManager.setConfiguredCallback(NULL);
   configManager.printConfig();
-  radio.init();
+  for (uint8_t i = 0; i < Radio::count(); i++)
+    Radio::getInstance(i).init();
 }
 
 void wifiConnected()
@@ -157,6 +161,8 @@ void setup()
   displayInit();
   displayShowInitialCredits();
   configManager.delay(1000);
+  Journal::getInstance().begin();
+  Satellites::loadOverrides();
   mqtt.begin();
 
   if (configManager.getOledBright() == 0)
@@ -168,6 +174,7 @@ void setup()
 }
 
 void loop() {  
+  Log::loop();
   configManager.doLoop();
   if (configManager.isFailSafeActive())
   {
@@ -202,6 +209,10 @@ void loop() {
   else {
     status.radio_ready = false;
   }
+  for (uint8_t i = 1; i < Radio::count(); i++)
+    if (Radio::getInstance(i).isReady())
+      Radio::getInstance(i).listen();
+  Journal::getInstance().loop();
 
   if (configManager.getState() < 4) // connection or ap mode
   {
@@ -214,10 +225,22 @@ void loop() {
   mqtt.loop();
   OTA::loop();
   if (configManager.getOledBright() != 0) displayUpdate();
+
+  // with duty cycled RX there is nothing to poll, give the idle task a chance to light sleep
+  bool continuous = false;
+  for (uint8_t i = 0; i < Radio::count(); i++)
+    continuous |= Radio::getInstance(i).getRxMode() == RX_CONTINUOUS;
+  if (!continuous) delay(RX_DUTY_LOOP_IDLE_MS);
+}
+
+void timeSynced(struct timeval *tv)
+{
+  status.lastTimeSync = esp_timer_get_time();
 }
 
 void setupNTP()
 {
+  sntp_set_time_sync_notification_cb(timeSynced);
   configTime(0, 0, ntpServer);
   setenv("TZ", configManager.getTZ(), 1); 
   tzset();
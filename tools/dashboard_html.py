@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""Generates tinyGS/src/ConfigManager/dashboard.h, the dashboard page.
+
+tinyGS/src/ConfigManager/dashboard.html is the page shell. Every {{NAME}}
+marker in it is replaced by the C string NAME taken from the firmware
+headers (the IotWebConf2 page parts, the logo and the URLs), so the shell
+keeps the look of the other pages. The result is gzipped and stored as a
+PROGMEM array that the web server sends as is. Run it again after editing
+the shell or any of those strings:
+
+    python3 tools/dashboard_html.py
+"""
+
+import codecs
+import gzip
+import os
+import re
+import zlib
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+CM = os.path.join(ROOT, "tinyGS", "src", "ConfigManager")
+TEMPLATE = os.path.join(CM, "dashboard.html")
+OUTPUT = os.path.join(CM, "dashboard.h")
+SOURCES = [
+    os.path.join(ROOT, "lib", "IotWebConf2", "src", "IotWebConf2.h"),
+    os.path.join(CM, "logos.h"),
+    os.path.join(CM, "ConfigManager.h"),
+]
+
+HEADER = """/*
+  dashboard.h - Dashboard page, generated by tools/dashboard_html.py
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Do not edit, generated from dashboard.html by tools/dashboard_html.py
+"""
+
+LITERAL = r'"(?:[^"\\]|\\.)*"'
+DEFINITION = re.compile(
+    r"(?:const\s+char\s+(\w+)\s*\[\]\s*PROGMEM|constexpr\s+auto\s+(\w+))\s*=\s*((?:\s*%s)+)\s*;" % LITERAL)
+
+
+def read_strings():
+    """name -> value of every string constant defined in SOURCES"""
+    strings = {}
+    for path in SOURCES:
+        for m in DEFINITION.finditer(open(path, encoding="utf-8").read()):
+            name = m.group(1) or m.group(2)
+            raw = "".join(s[1:-1] for s in re.findall(LITERAL, m.group(3)))
+            strings[name] = codecs.escape_decode(raw.encode("utf-8"))[0].decode("utf-8")
+    return strings
+
+
+def render():
+    strings = read_strings()
+    strings["IOTWEBCONF_HTML_HEAD"] = strings["IOTWEBCONF_HTML_HEAD"].replace("{v}", strings["TITLE_TEXT"])
+    page = open(TEMPLATE, encoding="utf-8").read()
+    page = re.sub(r"<!--.*?-->\n?", "", page, flags=re.S)
+    return re.sub(r"\{\{(\w+)\}\}", lambda m: strings[m.group(1)], page)
+
+
+def main():
+    page = render().encode("utf-8")
+    # mtime=0 so the output only changes when the page does
+    data = gzip.compress(page, compresslevel=9, mtime=0)
+    etag = '"%08x"' % zlib.crc32(data)
+    with open(OUTPUT, "w") as out:
+        out.write(HEADER)
+        out.write("\n#ifndef DASHBOARD_H\n#define DASHBOARD_H\n\n")
+        out.write("#define DASHBOARD_HTML_ETAG \"%s\"\n\n" % etag.replace('"', '\\"'))
+        out.write("const uint8_t DASHBOARD_HTML_GZ[] PROGMEM = {\n")
+        for i in range(0, len(data), 16):
+            out.write("  %s,\n" % ", ".join("0x%02x" % b for b in data[i:i + 16]))
+        out.write("};\n\n#endif\n")
+    print("%s: %u bytes, %u gzipped" % (os.path.relpath(OUTPUT, ROOT), len(page), len(data)))
+
+
+if __name__ == "__main__":
+    main()
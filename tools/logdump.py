@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+"""Decoder for binary log dumps (firmware built with -DLOG_BINARY=1).
+
+Download the dump from the station dashboard (/log.bin) and decode it with
+the ELF of the exact firmware that produced it, the format strings are only
+stored as addresses:
+
+    python3 tools/logdump.py log.bin .pio/build/<env>/firmware.elf
+
+Mirrors Log::formatRecord() in tinyGS/src/Logger/Logger.cpp. Times are
+printed in UTC, the station prints them in its own time zone.
+"""
+
+import re
+import struct
+import sys
+import time
+
+MAGIC = b"TGLB"
+# magic, version, pointer size, reserved, firmware version, first sequence number
+HEADER = struct.Struct("<4sBBHII")
+
+CONVERSION = re.compile(r"%([-+ #0-9.*]*)[hlLqjzt]*([diouxXcsfFeEgGaAp%])")
+
+
+class Elf:
+    """Loadable sections of an ELF file, enough to read strings by address"""
+
+    def __init__(self, path):
+        data = open(path, "rb").read()
+        if data[:4] != b"\x7fELF":
+            raise ValueError("%s is not an ELF file" % path)
+        is64 = data[4] == 2
+        end = "<" if data[5] == 1 else ">"
+        if is64:
+            shoff, = struct.unpack_from(end + "Q", data, 0x28)
+            shentsize, shnum = struct.unpack_from(end + "HH", data, 0x3A)
+            section = struct.Struct(end + "IIQQQQIIQQ")
+        else:
+            shoff, = struct.unpack_from(end + "I", data, 0x20)
+            shentsize, shnum = struct.unpack_from(end + "HH", data, 0x2E)
+            section = struct.Struct(end + "IIIIIIIIII")
+        self.sections = []
+        for i in range(shnum):
+            _, sh_type, flags, addr, offset, size = section.unpack_from(data, shoff + i * shentsize)[:6]
+            if sh_type == 1 and flags & 2 and addr:  # SHT_PROGBITS, SHF_ALLOC
+                self.sections.append((addr, data[offset:offset + size]))
+
+    def string(self, addr):
+        for start, content in self.sections:
+            if start <= addr < start + len(content):
+                pos = addr - start
+                return content[pos:content.index(b"\0", pos)].decode("utf-8", "replace")
+        return None
+
+
+def read_args(record, pos, ptr_size):
+    args = []
+    while pos < len(record):
+        tag = chr(record[pos])
+        pos += 1
+        if tag == "i":
+            args.append(("i", struct.unpack_from("<I", record, pos)[0]))
+            pos += 4
+        elif tag == "I":
+            args.append(("I", struct.unpack_from("<Q", record, pos)[0]))
+            pos += 8
+        elif tag == "d":
+            args.append(("d", struct.unpack_from("<d", record, pos)[0]))
+            pos += 8
+        elif tag == "s":
+            n = record[pos]
+            args.append(("s", record[pos + 1:pos + 1 + n].decode("utf-8", "replace")))
+            pos += n + 2
+        elif tag == "p":
+            args.append(("p", int.from_bytes(record[pos:pos + ptr_size], "little")))
+            pos += ptr_size
+        else:
+            break
+    return args
+
+
+def signed(value, bits):
+    return value - (1 << bits) if value >> (bits - 1) else value
+
+
+def format_record(fmt, args):
+    args = list(args)
+    out = []
+    pos = 0
+    for m in CONVERSION.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        pos = m.end()
+        flags, conversion = m.groups()
+        if conversion == "%":
+            out.append("%")
+            continue
+        values = []
+        for _ in range(flags.count("*")):
+            values.append(signed(args.pop(0)[1], 32) if args and args[0][0] == "i" else 0)
+        if not args:
+            out.append("?")
+            continue
+        kind, value = args.pop(0)
+        bits = 64 if kind == "I" else 32
+        if kind in "iI" and conversion in "diouxXc":
+            if conversion in "di":
+                value = signed(value, bits)
+            spec = "%" + flags + ("d" if conversion == "u" else conversion)
+        elif kind == "d" and conversion in "fFeEgG":
+            spec = "%" + flags + conversion
+        elif kind == "s" and conversion == "s":
+            spec = "%" + flags + "s"
+        elif kind == "p" and conversion == "p":
+            spec, value = "0x%x", value
+        else:
+            out.append("?")
+            continue
+        out.append(spec % tuple(values + [value]))
+    out.append(fmt[pos:])
+    return "".join(out)
+
+
+def decode(dump, elf):
+    magic, version, ptr_size, _, firmware, seq = HEADER.unpack_from(dump, 0)
+    if magic != MAGIC or version != 1:
+        raise ValueError("not a binary log dump")
+    pos = HEADER.size
+    git_len = dump[pos]
+    git = dump[pos + 1:pos + 1 + git_len].decode()
+    pos += 1 + git_len
+    yield "# firmware %u %s" % (firmware, git)
+
+    while pos + 2 <= len(dump):
+        n, = struct.unpack_from("<H", dump, pos)
+        record = dump[pos + 2:pos + 2 + n]
+        pos += 2 + n
+        addr = int.from_bytes(record[:ptr_size], "little")
+        t, = struct.unpack_from("<I", record, ptr_size)
+        fmt = elf.string(addr)
+        stamp = time.strftime("%H:%M:%S ", time.gmtime(t)) if t > 0 else ""
+        if fmt is None:
+            line = "<format at 0x%x not in the ELF, wrong firmware?>" % addr
+        else:
+            line = format_record(fmt, read_args(record, ptr_size + 4, ptr_size))
+        yield "%u %s%s" % (seq, stamp, line)
+        seq += 1
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    dump = open(sys.argv[1], "rb").read()
+    for line in decode(dump, Elf(sys.argv[2])):
+        print(line)
+
+
+if __name__ == "__main__":
+    main()
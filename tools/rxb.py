@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Encoder/decoder for the binary RX uplink (tele/rxb).
+
+Mirrors tinyGS/src/Mqtt/RxBinary.h. Run it without arguments to compare
+the size and the encode/decode time of both uplink formats:
+
+    python3 tools/rxb.py [frame sizes...]
+"""
+
+import base64
+import json
+import struct
+import sys
+import timeit
+
+RXB_VERSION = 1
+RXB_TIME_ERROR_UNKNOWN = 0xFFFFFFFF
+
+RXB_CRC_ERROR = 0x01
+RXB_NOISY = 0x02
+RXB_LORA = 0x04
+RXB_FEC = 0x08
+RXB_REPLAY = 0x10
+
+# version flags headerLen sf norad usecTime timeOffset frequency freqOffset bw
+# bitrate freqDev rssi snr frequencyError latitude longitude fecCorrected cr
+# radio fecBitErrors dataLen usecError
+HEADER = struct.Struct("<BBBBIqfffffffffffhBBIHI")
+FIELDS = ("version", "flags", "headerLen", "sf", "norad", "usecTime", "timeOffset",
+          "frequency", "freqOffset", "bw", "bitrate", "freqDev", "rssi", "snr",
+          "frequencyError", "latitude", "longitude", "fecCorrected", "cr",
+          "radio", "fecBitErrors", "dataLen", "usecError")
+assert HEADER.size == 74
+
+
+def encode(header, data, version=RXB_VERSION):
+    """header is a dict with any of FIELDS, the missing ones are 0."""
+    if version != RXB_VERSION:
+        raise ValueError("unsupported rxb version")
+    h = dict.fromkeys(FIELDS, 0)
+    h.update(header)
+    h.update(version=version, headerLen=HEADER.size, dataLen=len(data))
+    return HEADER.pack(*(h[f] for f in FIELDS)) + bytes(data)
+
+
+def decode(msg):
+    """Returns (header dict, frame bytes), raises ValueError if malformed."""
+    if len(msg) < HEADER.size or msg[0] == 0 or msg[2] < HEADER.size or msg[2] > len(msg):
+        raise ValueError("short or unknown rxb header")
+    header = dict(zip(FIELDS, HEADER.unpack_from(bytes(msg))))
+    start = header["headerLen"]
+    end = start + header["dataLen"]
+    if end > len(msg):
+        raise ValueError("truncated rxb frame")
+    return header, bytes(msg[start:end])
+
+
+def to_json(header, data, satellite="Waiting"):
+    """The tele/rx JSON the station would have sent for the same packet."""
+    lora = header["flags"] & RXB_LORA
+    doc = {
+        "station_location": [header["latitude"], header["longitude"]],
+        "mode": "LoRa" if lora else "FSK",
+        "frequency": header["frequency"],
+        "frequency_offset": header["freqOffset"],
+        "satellite": satellite,
+    }
+    if lora:
+        doc.update(sf=header["sf"], cr=header["cr"], bw=header["bw"])
+    else:
+        doc.update(bitrate=header["bitrate"], freqdev=header["freqDev"], rxBw=header["bw"])
+    doc.update({
+        "rssi": header["rssi"],
+        "snr": header["snr"],
+        "frequency_error": header["frequencyError"],
+        "unix_GS_time": header["usecTime"] // 1000000,
+        "usec_time": header["usecTime"],
+        "time_offset": header["timeOffset"],
+        "crc_error": bool(header["flags"] & RXB_CRC_ERROR),
+        "data": base64.b64encode(data).decode(),
+        "NORAD": header["norad"],
+        "noisy": bool(header["flags"] & RXB_NOISY),
+    })
+    if header["usecError"] != RXB_TIME_ERROR_UNKNOWN:
+        doc["usec_err"] = header["usecError"]
+    if header["flags"] & RXB_FEC:
+        doc.update(fec_corrected=header["fecCorrected"], fec_bit_errors=header["fecBitErrors"])
+    if header["flags"] & RXB_REPLAY:
+        doc["replay"] = True
+    if header["radio"]:
+        doc["radio"] = header["radio"]
+    return json.dumps(doc, separators=(",", ":"))
+
+
+def from_json(text):
+    doc = json.loads(text)
+    return doc, base64.b64decode(doc["data"])
+
+
+def bench(sizes):
+    sample = {"flags": RXB_LORA, "sf": 10, "cr": 5, "norad": 46494,
+              "usecTime": 1700000000123456, "frequency": 436.703, "bw": 125.0,
+              "rssi": -121.5, "snr": -7.25, "frequencyError": 1532.2,
+              "latitude": 40.4168, "longitude": -3.7038}
+    print("%6s %8s %8s %7s %12s %12s" % ("frame", "json", "rxb", "saved", "json us", "rxb us"))
+    for size in sizes:
+        data = bytes(range(256)) * (size // 256) + bytes(range(size % 256))
+        msg = encode(sample, data)
+        header, frame = decode(msg)
+        assert frame == data
+        text = to_json(header, data, "Norbi")
+        n = 2000
+        t_json = timeit.timeit(lambda: from_json(to_json(header, data, "Norbi")), number=n) / n * 1e6
+        t_rxb = timeit.timeit(lambda: decode(encode(sample, data)), number=n) / n * 1e6
+        print("%6u %8u %8u %6.0f%% %12.1f %12.1f" % (size, len(text), len(msg),
+              100.0 * (len(text) - len(msg)) / len(text), t_json, t_rxb))
+
+
+if __name__ == "__main__":
+    bench([int(a) for a in sys.argv[1:]] or [16, 64, 128, 255])
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+"""Generates tinyGS/src/ConfigManager/worldmap.h, the dashboard world map.
+
+The land pixels of earth_bits (tinyGS/src/Display/graphics.h) are turned
+into one horizontal 2 px high rectangle per run, the same drawing the
+dashboard used to build on every request, and stored as a PROGMEM string
+so the web server only has to stream it. Run it again if the bitmap
+changes:
+
+    python3 tools/worldmap_svg.py
+"""
+
+import os
+import re
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+GRAPHICS = os.path.join(ROOT, "tinyGS", "src", "Display", "graphics.h")
+OUTPUT = os.path.join(ROOT, "tinyGS", "src", "ConfigManager", "worldmap.h")
+
+HEADER = """/*
+  worldmap.h - World map of the dashboard, generated by tools/worldmap_svg.py
+
+  Copyright (C) 2020 -2021 @G4lile0, @gmag12 and @dev_4m1g0
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// Do not edit, generated from earth_bits by tools/worldmap_svg.py
+"""
+
+
+def read_bitmap():
+    src = open(GRAPHICS).read()
+    width = int(re.search(r"#define\s+earth_width\s+(\d+)", src).group(1))
+    height = int(re.search(r"#define\s+earth_height\s+(\d+)", src).group(1))
+    body = re.search(r"earth_bits\[\]\s*PROGMEM\s*=\s*\{(.*?)\}", src, re.S).group(1)
+    bits = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", body)]
+    assert len(bits) == width * height // 8
+    return width, height, bits
+
+
+def runs(width, height, bits):
+    """(x, y, length) of every run of land pixels, XBM is LSB first"""
+    for y in range(height):
+        x = 0
+        while x < width:
+            if bits[(y * width + x) // 8] >> (x % 8) & 1:
+                start = x
+                while x < width and bits[(y * width + x) // 8] >> (x % 8) & 1:
+                    x += 1
+                yield start, y, x - start
+            else:
+                x += 1
+
+
+def svg(width, height, bits):
+    # 2 px per map pixel with a 3 px margin, same coordinates as the satellite marker
+    path = "".join("M%d %dh%dv2h-%dz" % (x * 2 + 3, y * 2 + 3, n * 2, n * 2)
+                   for x, y, n in runs(width, height, bits))
+    return ("<svg xmlns='http://www.w3.org/2000/svg' width='262' height='134' viewBox='0 0 262 134'>"
+            "<rect x='1' y='1' width='262' height='134' stroke='gray' fill='none' stroke-width='2'/>"
+            "<path d='%s'/></svg>" % path)
+
+
+def main():
+    data = svg(*read_bitmap())
+    lines = [data[i:i + 100] for i in range(0, len(data), 100)]
+    with open(OUTPUT, "w") as out:
+        out.write(HEADER)
+        out.write("\n#ifndef WORLDMAP_H\n#define WORLDMAP_H\n\n")
+        out.write("const char WORLDMAP_SVG[] PROGMEM =\n")
+        out.write("\n".join('  "%s"' % line for line in lines))
+        out.write(";\n\n#endif\n")
+    print("%s: %u bytes" % (os.path.relpath(OUTPUT, ROOT), len(data)))
+
+
+if __name__ == "__main__":
+    main()